@@ -1,5 +1,7 @@
 #include "Commands/SpirrowBridgeAICommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 
 // BehaviorTree runtime includes
 #include "BehaviorTree/BehaviorTree.h"
@@ -334,12 +336,7 @@ static void FinalizeAndSaveBTGraph(UBehaviorTreeGraph* BTGraph, UBehaviorTree* B
 	BehaviorTree->MarkPackageDirty();
 
 	// Save package
-	UPackage* Package = BehaviorTree->GetOutermost();
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(
-		Package->GetName(), FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, BehaviorTree, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(BehaviorTree);
 }
 
 // ===== Phase G: BT Node Creation Handlers (Graph-Based) =====
@@ -392,7 +389,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAddBTCompositeNode(
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
@@ -606,7 +603,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAddBTTaskNode(
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
@@ -800,7 +797,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAddBTDecoratorNode(
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
@@ -924,7 +921,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAddBTServiceNode(
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
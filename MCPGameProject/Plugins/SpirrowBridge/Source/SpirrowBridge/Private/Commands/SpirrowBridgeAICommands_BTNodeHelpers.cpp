@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeAICommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeClassIndex.h"
 
 // Phase G: BT Node Operation includes
 #include "BehaviorTree/BehaviorTree.h"
@@ -50,8 +51,6 @@
 #include "EditorAssetLibrary.h"
 #include "Engine/Blueprint.h"
 
-// For C++ class search
-#include "UObject/UObjectIterator.h"
 
 // ===== Phase G: BT Node Operation Helper Functions =====
 
@@ -86,21 +85,10 @@ UClass* FSpirrowBridgeAICommands::GetBTTaskNodeClass(const FString& TypeString)
 		}
 	}
 
-	// 3. Class name only - search all modules
+	// 3. Class name (with or without U prefix, or a Blueprint class name) - class index
+	if (UClass* FoundClass = FSpirrowBridgeClassIndex::Get().FindClass(TypeString, UBTTaskNode::StaticClass()))
 	{
-		FString ClassNameWithU = TypeString.StartsWith(TEXT("U")) ? TypeString : FString::Printf(TEXT("U%s"), *TypeString);
-
-		for (TObjectIterator<UClass> It; It; ++It)
-		{
-			UClass* Class = *It;
-			if (Class->GetName() == ClassNameWithU || Class->GetName() == TypeString)
-			{
-				if (Class->IsChildOf(UBTTaskNode::StaticClass()))
-				{
-					return Class;
-				}
-			}
-		}
+		return FoundClass;
 	}
 
 	// 4. Custom BP task search (fallback)
@@ -140,21 +128,10 @@ UClass* FSpirrowBridgeAICommands::GetBTDecoratorClass(const FString& TypeString)
 		}
 	}
 
-	// 3. Class name only - search all modules
+	// 3. Class name (with or without U prefix, or a Blueprint class name) - class index
+	if (UClass* FoundClass = FSpirrowBridgeClassIndex::Get().FindClass(TypeString, UBTDecorator::StaticClass()))
 	{
-		FString ClassNameWithU = TypeString.StartsWith(TEXT("U")) ? TypeString : FString::Printf(TEXT("U%s"), *TypeString);
-
-		for (TObjectIterator<UClass> It; It; ++It)
-		{
-			UClass* Class = *It;
-			if (Class->GetName() == ClassNameWithU || Class->GetName() == TypeString)
-			{
-				if (Class->IsChildOf(UBTDecorator::StaticClass()))
-				{
-					return Class;
-				}
-			}
-		}
+		return FoundClass;
 	}
 
 	// 4. Custom BP decorator search (fallback)
@@ -185,21 +162,10 @@ UClass* FSpirrowBridgeAICommands::GetBTServiceClass(const FString& TypeString)
 		}
 	}
 
-	// 3. Class name only - search all modules
+	// 3. Class name (with or without U prefix, or a Blueprint class name) - class index
+	if (UClass* FoundClass = FSpirrowBridgeClassIndex::Get().FindClass(TypeString, UBTService::StaticClass()))
 	{
-		FString ClassNameWithU = TypeString.StartsWith(TEXT("U")) ? TypeString : FString::Printf(TEXT("U%s"), *TypeString);
-
-		for (TObjectIterator<UClass> It; It; ++It)
-		{
-			UClass* Class = *It;
-			if (Class->GetName() == ClassNameWithU || Class->GetName() == TypeString)
-			{
-				if (Class->IsChildOf(UBTService::StaticClass()))
-				{
-					return Class;
-				}
-			}
-		}
+		return FoundClass;
 	}
 
 	// 4. Custom BP service search (fallback)
@@ -1,5 +1,7 @@
 #include "Commands/SpirrowBridgeAICommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 
 // BehaviorTree runtime includes
 #include "BehaviorTree/BehaviorTree.h"
@@ -167,12 +169,7 @@ static void FinalizeAndSaveBTGraphInternal(UBehaviorTreeGraph* BTGraph, UBehavio
 	BehaviorTree->MarkPackageDirty();
 
 	// Save package
-	UPackage* Package = BehaviorTree->GetOutermost();
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(
-		Package->GetName(), FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, BehaviorTree, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(BehaviorTree);
 }
 
 // ===== Phase G: BT Node Operation Handlers (Graph-Based) =====
@@ -209,7 +206,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleConnectBTNodes(
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
@@ -340,7 +337,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleSetBTNodeProperty(
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
@@ -501,7 +498,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleDeleteBTNode(
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
@@ -661,7 +658,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleSetBTNodePosition(
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
@@ -852,7 +849,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAutoLayoutBT(
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
@@ -1057,7 +1054,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleListBTNodes(
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
@@ -1,5 +1,7 @@
 #include "Commands/SpirrowBridgeAICommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 
 // BehaviorTree includes
 #include "BehaviorTree/BehaviorTree.h"
@@ -8,15 +10,13 @@
 // Asset management includes
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "UObject/SavePackage.h"
-#include "EditorAssetLibrary.h"
 #include "Misc/PackageName.h"
 
 // ===== Helper Functions =====
 
 UBehaviorTree* FSpirrowBridgeAICommands::FindBehaviorTreeAsset(const FString& Name, const FString& Path)
 {
-	FString FullPath = Path / Name + TEXT(".") + Name;
-	return Cast<UBehaviorTree>(UEditorAssetLibrary::LoadAsset(FullPath));
+	return FSpirrowBridgeAssetResolver::Get().Resolve<UBehaviorTree>(Name, Path);
 }
 
 // ===== BehaviorTree Commands Implementation =====
@@ -83,11 +83,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleCreateBehaviorTree(
 	Package->MarkPackageDirty();
 	FAssetRegistryModule::AssetCreated(BehaviorTree);
 
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(
-		PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, BehaviorTree, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(BehaviorTree);
 
 	// レスポンス作成
 	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
@@ -131,7 +127,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleSetBehaviorTreeBlackboar
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, BtPath);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BehaviorTreeName, BtPath, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *BtPath));
 	}
@@ -140,7 +136,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleSetBehaviorTreeBlackboar
 	UBlackboardData* Blackboard = FindBlackboardAsset(BlackboardName, BbPath);
 	if (!Blackboard)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlackboardName, BbPath, UBlackboardData::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("Blackboard not found: %s at %s"), *BlackboardName, *BbPath));
 	}
@@ -150,12 +146,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleSetBehaviorTreeBlackboar
 
 	// 保存
 	BehaviorTree->MarkPackageDirty();
-	UPackage* Package = BehaviorTree->GetOutermost();
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(
-		Package->GetName(), FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, BehaviorTree, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(BehaviorTree);
 
 	// レスポンス作成
 	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
@@ -184,7 +175,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleGetBehaviorTreeStructure
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(Name, Path);
 	if (!BehaviorTree)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(Name, Path, UBehaviorTree::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *Name, *Path));
 	}
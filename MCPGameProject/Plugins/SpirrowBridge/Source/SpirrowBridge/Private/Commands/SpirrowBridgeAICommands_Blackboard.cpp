@@ -1,5 +1,7 @@
 #include "Commands/SpirrowBridgeAICommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 
 // Blackboard includes
 #include "BehaviorTree/BlackboardData.h"
@@ -17,15 +19,13 @@
 // Asset management includes
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "UObject/SavePackage.h"
-#include "EditorAssetLibrary.h"
 #include "Misc/PackageName.h"
 
 // ===== Helper Functions =====
 
 UBlackboardData* FSpirrowBridgeAICommands::FindBlackboardAsset(const FString& Name, const FString& Path)
 {
-	FString FullPath = Path / Name + TEXT(".") + Name;
-	return Cast<UBlackboardData>(UEditorAssetLibrary::LoadAsset(FullPath));
+	return FSpirrowBridgeAssetResolver::Get().Resolve<UBlackboardData>(Name, Path);
 }
 
 UClass* FSpirrowBridgeAICommands::GetBlackboardKeyTypeClass(const FString& TypeString)
@@ -121,11 +121,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleCreateBlackboard(
 	Package->MarkPackageDirty();
 	FAssetRegistryModule::AssetCreated(BlackboardData);
 
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(
-		PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, BlackboardData, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(BlackboardData);
 
 	// レスポンス作成
 	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
@@ -174,7 +170,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAddBlackboardKey(
 	UBlackboardData* Blackboard = FindBlackboardAsset(BlackboardName, Path);
 	if (!Blackboard)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlackboardName, Path, UBlackboardData::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("Blackboard not found: %s at %s"), *BlackboardName, *Path));
 	}
@@ -256,12 +252,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAddBlackboardKey(
 
 	// 保存
 	Blackboard->MarkPackageDirty();
-	UPackage* Package = Blackboard->GetOutermost();
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(
-		Package->GetName(), FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blackboard, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Blackboard);
 
 	// レスポンス作成
 	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
@@ -299,7 +290,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleRemoveBlackboardKey(
 	UBlackboardData* Blackboard = FindBlackboardAsset(BlackboardName, Path);
 	if (!Blackboard)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlackboardName, Path, UBlackboardData::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("Blackboard not found: %s at %s"), *BlackboardName, *Path));
 	}
@@ -325,12 +316,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleRemoveBlackboardKey(
 
 	// 保存
 	Blackboard->MarkPackageDirty();
-	UPackage* Package = Blackboard->GetOutermost();
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(
-		Package->GetName(), FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, Blackboard, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Blackboard);
 
 	// レスポンス作成
 	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
@@ -360,7 +346,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleListBlackboardKeys(
 	UBlackboardData* Blackboard = FindBlackboardAsset(BlackboardName, Path);
 	if (!Blackboard)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlackboardName, Path, UBlackboardData::StaticClass(),
 			ESpirrowErrorCode::AssetNotFound,
 			FString::Printf(TEXT("Blackboard not found: %s at %s"), *BlackboardName, *Path));
 	}
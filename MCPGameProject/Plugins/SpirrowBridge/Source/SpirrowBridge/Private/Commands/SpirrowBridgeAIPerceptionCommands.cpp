@@ -1,5 +1,8 @@
 #include "Commands/SpirrowBridgeAIPerceptionCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 
 // Actor includes
 #include "GameFramework/Actor.h"
@@ -11,7 +14,6 @@
 #include "Engine/SCS_Node.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
-#include "EditorAssetLibrary.h"
 
 // AI Perception includes
 #include "Perception/AIPerceptionComponent.h"
@@ -80,14 +82,13 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleAddAIPerceptio
 	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Blueprints"));
 
 	// Find the Blueprint
-	FString FullPath = FString::Printf(TEXT("%s/%s.%s"), *Path, *BlueprintName, *BlueprintName);
-	UBlueprint* Blueprint = Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+	UBlueprint* Blueprint = FSpirrowBridgeAssetResolver::Get().Resolve<UBlueprint>(BlueprintName, Path);
 
 	if (!Blueprint)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlueprintName, Path, UBlueprint::StaticClass(),
 			ESpirrowErrorCode::BlueprintNotFound,
-			FString::Printf(TEXT("Blueprint not found: %s"), *FullPath)
+			FString::Printf(TEXT("Blueprint not found: %s/%s.%s"), *Path, *BlueprintName, *BlueprintName)
 		);
 	}
 
@@ -124,10 +125,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleAddAIPerceptio
 
 	// Mark Blueprint as modified and compile
 	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(Blueprint);
 
 	// Save the asset
-	UEditorAssetLibrary::SaveAsset(FullPath, false);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Blueprint);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
@@ -176,14 +177,13 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleConfigureSight
 	}
 
 	// Find the Blueprint
-	FString FullPath = FString::Printf(TEXT("%s/%s.%s"), *Path, *BlueprintName, *BlueprintName);
-	UBlueprint* Blueprint = Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+	UBlueprint* Blueprint = FSpirrowBridgeAssetResolver::Get().Resolve<UBlueprint>(BlueprintName, Path);
 
 	if (!Blueprint)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlueprintName, Path, UBlueprint::StaticClass(),
 			ESpirrowErrorCode::BlueprintNotFound,
-			FString::Printf(TEXT("Blueprint not found: %s"), *FullPath)
+			FString::Printf(TEXT("Blueprint not found: %s/%s.%s"), *Path, *BlueprintName, *BlueprintName)
 		);
 	}
 
@@ -192,6 +192,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleConfigureSight
 	if (!PerceptionComp)
 	{
 		// Try to find it in the CDO
+		FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
 		UClass* GeneratedClass = Blueprint->GeneratedClass;
 		if (GeneratedClass)
 		{
@@ -245,10 +246,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleConfigureSight
 
 	// Mark Blueprint as modified and compile
 	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(Blueprint);
 
 	// Save the asset
-	UEditorAssetLibrary::SaveAsset(FullPath, false);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Blueprint);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
@@ -294,14 +295,13 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleConfigureHeari
 	}
 
 	// Find the Blueprint
-	FString FullPath = FString::Printf(TEXT("%s/%s.%s"), *Path, *BlueprintName, *BlueprintName);
-	UBlueprint* Blueprint = Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+	UBlueprint* Blueprint = FSpirrowBridgeAssetResolver::Get().Resolve<UBlueprint>(BlueprintName, Path);
 
 	if (!Blueprint)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlueprintName, Path, UBlueprint::StaticClass(),
 			ESpirrowErrorCode::BlueprintNotFound,
-			FString::Printf(TEXT("Blueprint not found: %s"), *FullPath)
+			FString::Printf(TEXT("Blueprint not found: %s/%s.%s"), *Path, *BlueprintName, *BlueprintName)
 		);
 	}
 
@@ -343,10 +343,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleConfigureHeari
 
 	// Mark Blueprint as modified and compile
 	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(Blueprint);
 
 	// Save the asset
-	UEditorAssetLibrary::SaveAsset(FullPath, false);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Blueprint);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
@@ -376,14 +376,13 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleConfigureDamag
 	FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("max_age"), MaxAge, 5.0);
 
 	// Find the Blueprint
-	FString FullPath = FString::Printf(TEXT("%s/%s.%s"), *Path, *BlueprintName, *BlueprintName);
-	UBlueprint* Blueprint = Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+	UBlueprint* Blueprint = FSpirrowBridgeAssetResolver::Get().Resolve<UBlueprint>(BlueprintName, Path);
 
 	if (!Blueprint)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlueprintName, Path, UBlueprint::StaticClass(),
 			ESpirrowErrorCode::BlueprintNotFound,
-			FString::Printf(TEXT("Blueprint not found: %s"), *FullPath)
+			FString::Printf(TEXT("Blueprint not found: %s/%s.%s"), *Path, *BlueprintName, *BlueprintName)
 		);
 	}
 
@@ -421,10 +420,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleConfigureDamag
 
 	// Mark Blueprint as modified and compile
 	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(Blueprint);
 
 	// Save the asset
-	UEditorAssetLibrary::SaveAsset(FullPath, false);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Blueprint);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
@@ -455,14 +454,13 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleSetPerceptionD
 	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Blueprints"));
 
 	// Find the Blueprint
-	FString FullPath = FString::Printf(TEXT("%s/%s.%s"), *Path, *BlueprintName, *BlueprintName);
-	UBlueprint* Blueprint = Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+	UBlueprint* Blueprint = FSpirrowBridgeAssetResolver::Get().Resolve<UBlueprint>(BlueprintName, Path);
 
 	if (!Blueprint)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlueprintName, Path, UBlueprint::StaticClass(),
 			ESpirrowErrorCode::BlueprintNotFound,
-			FString::Printf(TEXT("Blueprint not found: %s"), *FullPath)
+			FString::Printf(TEXT("Blueprint not found: %s/%s.%s"), *Path, *BlueprintName, *BlueprintName)
 		);
 	}
 
@@ -506,10 +504,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleSetPerceptionD
 
 	// Mark Blueprint as modified and compile
 	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(Blueprint);
 
 	// Save the asset
-	UEditorAssetLibrary::SaveAsset(FullPath, false);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Blueprint);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
@@ -555,14 +553,13 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleAddPerceptionS
 	}
 
 	// Find the Blueprint
-	FString FullPath = FString::Printf(TEXT("%s/%s.%s"), *Path, *BlueprintName, *BlueprintName);
-	UBlueprint* Blueprint = Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(FullPath));
+	UBlueprint* Blueprint = FSpirrowBridgeAssetResolver::Get().Resolve<UBlueprint>(BlueprintName, Path);
 
 	if (!Blueprint)
 	{
-		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+		return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlueprintName, Path, UBlueprint::StaticClass(),
 			ESpirrowErrorCode::BlueprintNotFound,
-			FString::Printf(TEXT("Blueprint not found: %s"), *FullPath)
+			FString::Printf(TEXT("Blueprint not found: %s/%s.%s"), *Path, *BlueprintName, *BlueprintName)
 		);
 	}
 
@@ -616,10 +613,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleAddPerceptionS
 
 	// Mark Blueprint as modified and compile
 	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(Blueprint);
 
 	// Save the asset
-	UEditorAssetLibrary::SaveAsset(FullPath, false);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Blueprint);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
@@ -0,0 +1,359 @@
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "UObject/ObjectRedirector.h"
+#include "Misc/PackageName.h"
+
+FSpirrowBridgeAssetResolver& FSpirrowBridgeAssetResolver::Get()
+{
+    static FSpirrowBridgeAssetResolver Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeAssetResolver::Startup()
+{
+    if (!AssetRemovedHandle.IsValid())
+    {
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FSpirrowBridgeAssetResolver::OnAssetAdded);
+        AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FSpirrowBridgeAssetResolver::OnAssetRemoved);
+        AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FSpirrowBridgeAssetResolver::OnAssetRenamed);
+    }
+}
+
+void FSpirrowBridgeAssetResolver::Shutdown()
+{
+    // The registry may already be gone during editor shutdown
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    Clear();
+    NameIndex.Reset();
+    bNameIndexBuilt = false;
+}
+
+UObject* FSpirrowBridgeAssetResolver::Resolve(const FString& Name, const FString& Path, UClass* Class)
+{
+    if (Name.IsEmpty() || !Class)
+    {
+        return nullptr;
+    }
+
+    FKey Key{ Name, Path, Class };
+    if (const FEntry* Entry = Entries.Find(Key))
+    {
+        UObject* Object = Entry->Object.Get();
+        if (IsValid(Object))
+        {
+            ++Hits;
+            return Object;
+        }
+        Entries.Remove(Key);
+    }
+
+    ++Misses;
+
+    UObject* Object = nullptr;
+    if (!Path.IsEmpty())
+    {
+        // Construct asset path: /Path/Name.Name
+        FString ObjectPath = Path;
+        while (ObjectPath.EndsWith(TEXT("/")))
+        {
+            ObjectPath.LeftChopInline(1);
+        }
+        ObjectPath = FString::Printf(TEXT("%s/%s.%s"), *ObjectPath, *Name, *Name);
+        Object = StaticLoadObject(Class, nullptr, *ObjectPath, nullptr, LOAD_NoWarn);
+    }
+
+    // Not at the expected path: accept a unique match anywhere in the project
+    if (!Object)
+    {
+        TArray<FSoftObjectPath> Candidates;
+        if (FindByName(Name, Class, Candidates) == ESpirrowAssetLookup::Found)
+        {
+            Object = StaticLoadObject(Class, nullptr, *Candidates[0].ToString(), nullptr, LOAD_NoWarn);
+        }
+    }
+    if (!Object)
+    {
+        return nullptr;
+    }
+
+    FEntry& NewEntry = Entries.Add(MoveTemp(Key));
+    NewEntry.Object = Object;
+    NewEntry.ObjectPath = Object->GetPathName();
+    return Object;
+}
+
+ESpirrowAssetLookup FSpirrowBridgeAssetResolver::FindByName(const FString& Name, UClass* Class, TArray<FSoftObjectPath>& OutObjectPaths)
+{
+    EnsureNameIndex();
+    ++IndexLookups;
+
+    if (const auto* Assets = NameIndex.Find(FName(*Name, FNAME_Find)))
+    {
+        for (const FIndexedAsset& Asset : *Assets)
+        {
+            if (ClassMatches(Asset.ClassPath, Class))
+            {
+                OutObjectPaths.Add(Asset.ObjectPath);
+            }
+        }
+    }
+
+    if (OutObjectPaths.Num() == 0)
+    {
+        return ESpirrowAssetLookup::NotFound;
+    }
+    return OutObjectPaths.Num() == 1 ? ESpirrowAssetLookup::Found : ESpirrowAssetLookup::Ambiguous;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeAssetResolver::MakeResolveError(const FString& Name, const FString& Path, UClass* Class,
+    int32 NotFoundCode, const FString& Message)
+{
+    TArray<FSoftObjectPath> Candidates;
+    const bool bAmbiguous = FindByName(Name, Class, Candidates) == ESpirrowAssetLookup::Ambiguous;
+
+    TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
+    Details->SetStringField(TEXT("name"), Name);
+    Details->SetStringField(TEXT("path"), Path);
+    if (Class)
+    {
+        Details->SetStringField(TEXT("class"), Class->GetName());
+    }
+
+    if (!bAmbiguous)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(NotFoundCode, Message, Details);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> CandidateArray;
+    for (const FSoftObjectPath& Candidate : Candidates)
+    {
+        CandidateArray.Add(MakeShared<FJsonValueString>(Candidate.GetLongPackageName()));
+    }
+    Details->SetArrayField(TEXT("candidates"), CandidateArray);
+
+    return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+        ESpirrowErrorCode::AssetAmbiguous,
+        FString::Printf(TEXT("'%s' is not at %s and matches %d assets; pass the path of one of the candidates"),
+            *Name, *Path, Candidates.Num()),
+        Details);
+}
+
+void FSpirrowBridgeAssetResolver::Invalidate(const FString& ObjectPath)
+{
+    Invalidations += Entries.Num();
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (It.Value().ObjectPath == ObjectPath)
+        {
+            It.RemoveCurrent();
+        }
+    }
+    Invalidations -= Entries.Num();
+}
+
+void FSpirrowBridgeAssetResolver::InvalidateName(const FString& Name)
+{
+    Invalidations += Entries.Num();
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (It.Key().Name == Name)
+        {
+            It.RemoveCurrent();
+        }
+    }
+    Invalidations -= Entries.Num();
+}
+
+void FSpirrowBridgeAssetResolver::Clear()
+{
+    Entries.Reset();
+}
+
+void FSpirrowBridgeAssetResolver::EnsureNameIndex()
+{
+    if (bNameIndexBuilt)
+    {
+        return;
+    }
+    bNameIndexBuilt = true;
+
+    const double StartTime = FPlatformTime::Seconds();
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    // Assets discovered later (registry still scanning) arrive through OnAssetAdded
+    TArray<FAssetData> AssetDataList;
+    AssetRegistry.GetAssetsByPath(FName(TEXT("/Game")), AssetDataList, true);
+    NameIndex.Reserve(AssetDataList.Num());
+    for (const FAssetData& AssetData : AssetDataList)
+    {
+        AddToNameIndex(AssetData);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("SpirrowBridge: Indexed %d asset names in %.1f ms"),
+        NameIndex.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FSpirrowBridgeAssetResolver::AddToNameIndex(const FAssetData& AssetData)
+{
+    if (AssetData.AssetClassPath == UObjectRedirector::StaticClass()->GetClassPathName() ||
+        !AssetData.PackagePath.ToString().StartsWith(TEXT("/Game")))
+    {
+        return;
+    }
+
+    auto& Assets = NameIndex.FindOrAdd(AssetData.AssetName);
+    const FSoftObjectPath ObjectPath = AssetData.GetSoftObjectPath();
+    if (!Assets.ContainsByPredicate([&ObjectPath](const FIndexedAsset& Asset) { return Asset.ObjectPath == ObjectPath; }))
+    {
+        Assets.Add({ ObjectPath, AssetData.AssetClassPath });
+    }
+}
+
+void FSpirrowBridgeAssetResolver::RemoveFromNameIndex(FName AssetName, const FSoftObjectPath& ObjectPath)
+{
+    if (auto* Assets = NameIndex.Find(AssetName))
+    {
+        Assets->RemoveAll([&ObjectPath](const FIndexedAsset& Asset) { return Asset.ObjectPath == ObjectPath; });
+        if (Assets->Num() == 0)
+        {
+            NameIndex.Remove(AssetName);
+        }
+    }
+}
+
+bool FSpirrowBridgeAssetResolver::ClassMatches(const FTopLevelAssetPath& ClassPath, UClass* Class)
+{
+    if (!Class || Class == UObject::StaticClass())
+    {
+        return true;
+    }
+
+    // Asset classes of Blueprints, Behavior Trees and data assets are native and therefore loaded
+    const UClass* AssetClass = FindObject<UClass>(ClassPath);
+    return AssetClass && AssetClass->IsChildOf(Class);
+}
+
+void FSpirrowBridgeAssetResolver::OnAssetAdded(const FAssetData& AssetData)
+{
+    // The new asset may sit at a path that a cached lookup of this name resolved elsewhere
+    if (Entries.Num() > 0)
+    {
+        InvalidateName(AssetData.AssetName.ToString());
+    }
+    if (bNameIndexBuilt)
+    {
+        AddToNameIndex(AssetData);
+    }
+}
+
+void FSpirrowBridgeAssetResolver::OnAssetRemoved(const FAssetData& AssetData)
+{
+    Invalidate(AssetData.GetObjectPathString());
+    if (bNameIndexBuilt)
+    {
+        RemoveFromNameIndex(AssetData.AssetName, AssetData.GetSoftObjectPath());
+    }
+}
+
+void FSpirrowBridgeAssetResolver::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    // The weak pointer would still follow the renamed object, so the old name must miss
+    Invalidate(OldObjectPath);
+    if (bNameIndexBuilt)
+    {
+        const FSoftObjectPath OldPath(OldObjectPath);
+        RemoveFromNameIndex(FName(*OldPath.GetAssetName()), OldPath);
+        AddToNameIndex(AssetData);
+    }
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeAssetResolver::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("get_asset_cache_status"))
+    {
+        bool bClear = false;
+        FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("clear"), bClear, false);
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetBoolField(TEXT("success"), true);
+        ResultObj->SetNumberField(TEXT("entries"), Entries.Num());
+        ResultObj->SetNumberField(TEXT("hits"), Hits);
+        ResultObj->SetNumberField(TEXT("misses"), Misses);
+        ResultObj->SetNumberField(TEXT("invalidations"), Invalidations);
+        ResultObj->SetBoolField(TEXT("name_index_built"), bNameIndexBuilt);
+        ResultObj->SetNumberField(TEXT("indexed_names"), NameIndex.Num());
+        ResultObj->SetNumberField(TEXT("index_lookups"), IndexLookups);
+
+        if (bClear)
+        {
+            Clear();
+            Hits = 0;
+            Misses = 0;
+            Invalidations = 0;
+            IndexLookups = 0;
+        }
+        ResultObj->SetBoolField(TEXT("cleared"), bClear);
+        return ResultObj;
+    }
+
+    else if (CommandType == TEXT("find_assets_by_name"))
+    {
+        FString Name;
+        if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("name"), Name))
+        {
+            return Error;
+        }
+
+        FString ClassName;
+        FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("class_name"), ClassName, TEXT(""));
+
+        UClass* Class = nullptr;
+        if (!ClassName.IsEmpty())
+        {
+            Class = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::None);
+            if (!Class)
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::ClassNotFound,
+                    FString::Printf(TEXT("Class not found: %s"), *ClassName));
+            }
+        }
+
+        TArray<FSoftObjectPath> ObjectPaths;
+        const ESpirrowAssetLookup Lookup = FindByName(Name, Class, ObjectPaths);
+
+        TArray<TSharedPtr<FJsonValue>> AssetArray;
+        for (const FSoftObjectPath& ObjectPath : ObjectPaths)
+        {
+            TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
+            AssetObj->SetStringField(TEXT("asset_path"), ObjectPath.GetLongPackageName());
+            AssetObj->SetStringField(TEXT("object_path"), ObjectPath.ToString());
+            AssetObj->SetStringField(TEXT("path"), FPackageName::GetLongPackagePath(ObjectPath.GetLongPackageName()));
+            AssetArray.Add(MakeShared<FJsonValueObject>(AssetObj));
+        }
+
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetBoolField(TEXT("success"), true);
+        ResultObj->SetStringField(TEXT("name"), Name);
+        ResultObj->SetBoolField(TEXT("found"), Lookup != ESpirrowAssetLookup::NotFound);
+        ResultObj->SetBoolField(TEXT("ambiguous"), Lookup == ESpirrowAssetLookup::Ambiguous);
+        ResultObj->SetArrayField(TEXT("assets"), AssetArray);
+        return ResultObj;
+    }
+
+    return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+        ESpirrowErrorCode::UnknownCommand,
+        FString::Printf(TEXT("Unknown asset cache command: %s"), *CommandType));
+}
@@ -2,6 +2,7 @@
 #include "Commands/SpirrowBridgeBlueprintCoreCommands.h"
 #include "Commands/SpirrowBridgeBlueprintComponentCommands.h"
 #include "Commands/SpirrowBridgeBlueprintPropertyCommands.h"
+#include "Commands/SpirrowBridgeBlueprintPerformanceCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
 
 FSpirrowBridgeBlueprintCommands::FSpirrowBridgeBlueprintCommands()
@@ -9,6 +10,7 @@ FSpirrowBridgeBlueprintCommands::FSpirrowBridgeBlueprintCommands()
     CoreCommands = MakeShared<FSpirrowBridgeBlueprintCoreCommands>();
     ComponentCommands = MakeShared<FSpirrowBridgeBlueprintComponentCommands>();
     PropertyCommands = MakeShared<FSpirrowBridgeBlueprintPropertyCommands>();
+    PerformanceCommands = MakeShared<FSpirrowBridgeBlueprintPerformanceCommands>();
 }
 
 FSpirrowBridgeBlueprintCommands::~FSpirrowBridgeBlueprintCommands()
@@ -16,6 +18,7 @@ FSpirrowBridgeBlueprintCommands::~FSpirrowBridgeBlueprintCommands()
     CoreCommands.Reset();
     ComponentCommands.Reset();
     PropertyCommands.Reset();
+    PerformanceCommands.Reset();
 }
 
 TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
@@ -43,6 +46,13 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCommands::HandleCommand(const FSt
         return Result;
     }
 
+    // Try PerformanceCommands (analyze_performance, tick_policy)
+    Result = PerformanceCommands->HandleCommand(CommandType, Params);
+    if (Result.IsValid())
+    {
+        return Result;
+    }
+
     // Unknown command
     return FSpirrowBridgeCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint command: %s"), *CommandType));
 }
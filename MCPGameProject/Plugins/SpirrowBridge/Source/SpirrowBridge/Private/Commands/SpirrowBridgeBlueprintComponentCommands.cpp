@@ -1,5 +1,7 @@
 #include "Commands/SpirrowBridgeBlueprintComponentCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeClassIndex.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Components/StaticMeshComponent.h"
@@ -11,7 +13,6 @@
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
 #include "EditorAssetLibrary.h"
-#include "UObject/UObjectIterator.h"
 #include "AbilitySystemComponent.h"
 
 FSpirrowBridgeBlueprintComponentCommands::FSpirrowBridgeBlueprintComponentCommands()
@@ -93,7 +94,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintComponentCommands::HandleAddCompo
         ComponentClass = UAbilitySystemComponent::StaticClass();
     }
 
-    // Method 1: Try TObjectIterator to search all loaded classes
+    // Method 1: Class index lookup of the likely spellings
     if (!ComponentClass)
     {
         TArray<FString> ClassNamesToTry;
@@ -114,15 +115,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintComponentCommands::HandleAddCompo
 
         for (const FString& ClassName : ClassNamesToTry)
         {
-            for (TObjectIterator<UClass> It; It; ++It)
-            {
-                UClass* Class = *It;
-                if (Class->GetName() == ClassName && Class->IsChildOf(UActorComponent::StaticClass()))
-                {
-                    ComponentClass = Class;
-                    break;
-                }
-            }
+            ComponentClass = FSpirrowBridgeClassIndex::Get().FindClass(ClassName, UActorComponent::StaticClass());
             if (ComponentClass) break;
         }
     }
@@ -588,7 +581,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintComponentCommands::HandleSetPawnP
         return Error;
     }
 
-    // Get the default object
+    // Get the default object; a queued compile would replace it
+    FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
     UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
     if (!DefaultObject)
     {
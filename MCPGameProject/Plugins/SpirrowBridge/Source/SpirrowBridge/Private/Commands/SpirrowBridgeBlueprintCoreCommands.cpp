@@ -1,11 +1,14 @@
 #include "Commands/SpirrowBridgeBlueprintCoreCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeClassIndex.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
 #include "EdGraphSchema_K2.h"
 #include "K2Node_Event.h"
 #include "K2Node_CallFunction.h"
+#include "K2Node_Variable.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
 #include "Kismet2/BlueprintEditorUtils.h"
@@ -20,10 +23,195 @@
 #include "Blueprint/UserWidget.h"
 #include "Misc/App.h"
 #include "UObject/UObjectIterator.h"
+#include "Misc/PackageName.h"
 #include "AssetToolsModule.h"
 #include "IAssetTools.h"
 #include "WidgetBlueprint.h"
 #include "WidgetBlueprintFactory.h"
+#include "Hash/xxhash.h"
+
+namespace
+{
+    /** Which optional parts of a node a get_blueprint_graph call serializes */
+    struct FGraphViewOptions
+    {
+        bool bIncludePins = true;
+        bool bIncludePinDefaults = false;
+        bool bIncludeTitles = false;
+
+        uint8 ToFlags() const
+        {
+            return (bIncludePins ? 1 : 0) | (bIncludePinDefaults ? 2 : 0) | (bIncludeTitles ? 4 : 0);
+        }
+    };
+
+    template<typename T>
+    void HashValue(FXxHash64Builder& Builder, const T& Value)
+    {
+        Builder.Update(&Value, sizeof(T));
+    }
+
+    void HashString(FXxHash64Builder& Builder, const FString& Value)
+    {
+        const int32 Len = Value.Len();
+        HashValue(Builder, Len);
+        Builder.Update(*Value, Len * sizeof(TCHAR));
+    }
+
+    /** Name of the member a node refers to (event, function or variable), empty for other nodes */
+    FString GetNodeMemberName(const UEdGraphNode* Node)
+    {
+        if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+        {
+            return EventNode->GetFunctionName().ToString();
+        }
+        if (const UK2Node_CallFunction* FuncNode = Cast<UK2Node_CallFunction>(Node))
+        {
+            return FuncNode->GetFunctionName().ToString();
+        }
+        if (const UK2Node_Variable* VarNode = Cast<UK2Node_Variable>(Node))
+        {
+            return VarNode->GetVarName().ToString();
+        }
+        return FString();
+    }
+
+    /**
+     * Content hash of a graph: node identity, placement, member references, pins, defaults and links.
+     * Derived data such as titles is left out. The view flags are mixed in so that the same graph
+     * serialized with different options never shares a hash.
+     */
+    FString ComputeGraphHash(const UEdGraph* Graph, const FGraphViewOptions& Options)
+    {
+        FXxHash64Builder Builder;
+        HashValue(Builder, Options.ToFlags());
+        HashString(Builder, Graph->GetName());
+
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node) continue;
+
+            HashString(Builder, Node->GetClass()->GetPathName());
+            HashValue(Builder, Node->NodeGuid);
+            HashValue(Builder, Node->NodePosX);
+            HashValue(Builder, Node->NodePosY);
+            HashString(Builder, Node->NodeComment);
+            HashString(Builder, GetNodeMemberName(Node));
+
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                if (!Pin) continue;
+
+                HashValue(Builder, Pin->PinId);
+                HashString(Builder, Pin->PinName.ToString());
+                HashValue(Builder, static_cast<uint8>(Pin->Direction));
+                HashString(Builder, Pin->PinType.PinCategory.ToString());
+                HashString(Builder, Pin->PinType.PinSubCategory.ToString());
+                HashString(Builder, Pin->PinType.PinSubCategoryObject.IsValid() ? Pin->PinType.PinSubCategoryObject->GetPathName() : FString());
+                HashValue(Builder, static_cast<uint8>(Pin->PinType.ContainerType));
+                HashString(Builder, Pin->DefaultValue);
+                HashString(Builder, Pin->DefaultObject ? Pin->DefaultObject->GetPathName() : FString());
+                HashString(Builder, Pin->DefaultTextValue.ToString());
+
+                const int32 LinkCount = Pin->LinkedTo.Num();
+                HashValue(Builder, LinkCount);
+                for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+                {
+                    if (LinkedPin)
+                    {
+                        HashValue(Builder, LinkedPin->PinId);
+                    }
+                }
+            }
+        }
+
+        return FString::Printf(TEXT("%016llx"), Builder.Finalize().Hash);
+    }
+
+    TSharedPtr<FJsonObject> NodeToJson(const UEdGraphNode* Node, const FGraphViewOptions& Options, TArray<TSharedPtr<FJsonValue>>& OutConnections)
+    {
+        TSharedPtr<FJsonObject> NodeObj = MakeShareable(new FJsonObject());
+        NodeObj->SetStringField(TEXT("id"), Node->NodeGuid.ToString());
+        NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+        if (Options.bIncludeTitles)
+        {
+            // Title formatting walks schema and member metadata; only on request
+            NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
+        }
+        NodeObj->SetNumberField(TEXT("pos_x"), Node->NodePosX);
+        NodeObj->SetNumberField(TEXT("pos_y"), Node->NodePosY);
+
+        // Get node type info
+        if (Cast<UK2Node_Event>(Node))
+        {
+            NodeObj->SetStringField(TEXT("type"), TEXT("Event"));
+            NodeObj->SetStringField(TEXT("event_name"), GetNodeMemberName(Node));
+        }
+        else if (Cast<UK2Node_CallFunction>(Node))
+        {
+            NodeObj->SetStringField(TEXT("type"), TEXT("Function"));
+            NodeObj->SetStringField(TEXT("function_name"), GetNodeMemberName(Node));
+        }
+        else if (Cast<UK2Node_VariableGet>(Node))
+        {
+            NodeObj->SetStringField(TEXT("type"), TEXT("VariableGet"));
+            NodeObj->SetStringField(TEXT("variable_name"), GetNodeMemberName(Node));
+        }
+        else if (Cast<UK2Node_VariableSet>(Node))
+        {
+            NodeObj->SetStringField(TEXT("type"), TEXT("VariableSet"));
+            NodeObj->SetStringField(TEXT("variable_name"), GetNodeMemberName(Node));
+        }
+        else
+        {
+            NodeObj->SetStringField(TEXT("type"), TEXT("Other"));
+        }
+
+        // Get pin information
+        TArray<TSharedPtr<FJsonValue>> PinsArray;
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin) continue;
+
+            if (Options.bIncludePins)
+            {
+                TSharedPtr<FJsonObject> PinObj = MakeShareable(new FJsonObject());
+                PinObj->SetStringField(TEXT("name"), Pin->PinName.ToString());
+                PinObj->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("Input") : TEXT("Output"));
+                PinObj->SetStringField(TEXT("type"), Pin->PinType.PinCategory.ToString());
+                if (Options.bIncludePinDefaults && Pin->Direction == EGPD_Input && Pin->LinkedTo.Num() == 0)
+                {
+                    const FString DefaultValue = Pin->GetDefaultAsString();
+                    if (!DefaultValue.IsEmpty())
+                    {
+                        PinObj->SetStringField(TEXT("default_value"), DefaultValue);
+                    }
+                }
+                PinsArray.Add(MakeShareable(new FJsonValueObject(PinObj)));
+            }
+
+            // Record connections
+            if (Pin->Direction != EGPD_Output) continue;
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                if (!LinkedPin || !LinkedPin->GetOwningNode()) continue;
+
+                TSharedPtr<FJsonObject> ConnObj = MakeShareable(new FJsonObject());
+                ConnObj->SetStringField(TEXT("source_node"), Node->NodeGuid.ToString());
+                ConnObj->SetStringField(TEXT("source_pin"), Pin->PinName.ToString());
+                ConnObj->SetStringField(TEXT("target_node"), LinkedPin->GetOwningNode()->NodeGuid.ToString());
+                ConnObj->SetStringField(TEXT("target_pin"), LinkedPin->PinName.ToString());
+                OutConnections.Add(MakeShareable(new FJsonValueObject(ConnObj)));
+            }
+        }
+        if (Options.bIncludePins)
+        {
+            NodeObj->SetArrayField(TEXT("pins"), PinsArray);
+        }
+
+        return NodeObj;
+    }
+}
 
 FSpirrowBridgeBlueprintCoreCommands::FSpirrowBridgeBlueprintCoreCommands()
 {
@@ -39,6 +227,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleCommand(const
     {
         return HandleCompileBlueprint(Params);
     }
+    else if (CommandType == TEXT("compile_blueprints_batch"))
+    {
+        return HandleCompileBlueprintsBatch(Params);
+    }
     else if (CommandType == TEXT("spawn_blueprint_actor"))
     {
         return HandleSpawnBlueprintActor(Params);
@@ -123,48 +315,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleCreateBluepri
             FoundClass = UUserWidget::StaticClass();
         }
 
-        // Method 2: Search through all loaded classes using TObjectIterator
+        // Method 2: Class index (name with or without A/U prefix, native or Blueprint)
         if (!FoundClass)
         {
-            for (TObjectIterator<UClass> It; It; ++It)
-            {
-                UClass* Class = *It;
-                if (Class->GetName() == ClassName)
-                {
-                    FoundClass = Class;
-                    break;
-                }
-            }
-        }
-
-        // Method 2b: Try with 'A' prefix for Actor classes
-        if (!FoundClass && !ClassName.StartsWith(TEXT("A")) && !ClassName.StartsWith(TEXT("U")))
-        {
-            FString ClassNameWithA = TEXT("A") + ClassName;
-            for (TObjectIterator<UClass> It; It; ++It)
-            {
-                UClass* Class = *It;
-                if (Class->GetName() == ClassNameWithA)
-                {
-                    FoundClass = Class;
-                    break;
-                }
-            }
-        }
-
-        // Method 2c: Try with 'U' prefix for UObject classes
-        if (!FoundClass && !ClassName.StartsWith(TEXT("U")))
-        {
-            FString ClassNameWithU = TEXT("U") + ClassName;
-            for (TObjectIterator<UClass> It; It; ++It)
-            {
-                UClass* Class = *It;
-                if (Class->GetName() == ClassNameWithU)
-                {
-                    FoundClass = Class;
-                    break;
-                }
-            }
+            FoundClass = FSpirrowBridgeClassIndex::Get().FindClass(ClassName);
         }
 
         // Method 3: Try LoadObject with various module paths
@@ -243,6 +397,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleCreateBluepri
             ResultObj->SetStringField(TEXT("name"), AssetName);
             ResultObj->SetStringField(TEXT("path"), PackagePath + AssetName);
             ResultObj->SetStringField(TEXT("type"), TEXT("Blueprint"));
+            ResultObj->SetStringField(TEXT("parent_class"), SelectedParentClass->GetName());
             return ResultObj;
         }
 
@@ -272,8 +427,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleCompileBluepr
         return Error;
     }
 
-    // Compile the blueprint
-    FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    // Compile the blueprint (also drops it from the deferred compile queue)
+    FSpirrowBridgeCompileScheduler::Get().RequestCompile(Blueprint, true);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetBoolField(TEXT("success"), true);
@@ -283,6 +438,163 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleCompileBluepr
     return ResultObj;
 }
 
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleCompileBlueprintsBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    // Get optional parameters
+    FString Path, Folder, Mode;
+    bool bRecursive = true;
+    bool bDirtyOnly = false;
+    bool bIncludeMessages = true;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Blueprints"));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("folder"), Folder, TEXT(""));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("mode"), Mode, TEXT("batch"));
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("recursive"), bRecursive, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("dirty_only"), bDirtyOnly, false);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_messages"), bIncludeMessages, true);
+
+    const bool bSequential = Mode.Equals(TEXT("sequential"), ESearchCase::IgnoreCase);
+    if (!bSequential && !Mode.Equals(TEXT("batch"), ESearchCase::IgnoreCase))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            FString::Printf(TEXT("Invalid mode '%s' (expected batch or sequential)"), *Mode));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* BlueprintNames = nullptr;
+    Params->TryGetArrayField(TEXT("blueprints"), BlueprintNames);
+
+    TArray<UBlueprint*> Candidates;
+    TArray<TSharedPtr<FJsonValue>> NotFoundArray;
+
+    // Explicit list: short names resolve under path, entries starting with '/' are object paths
+    if (BlueprintNames)
+    {
+        for (const TSharedPtr<FJsonValue>& NameValue : *BlueprintNames)
+        {
+            const FString Name = NameValue->AsString();
+            UBlueprint* Blueprint = nullptr;
+            if (Name.StartsWith(TEXT("/")))
+            {
+                FString ObjectPath = Name;
+                if (!ObjectPath.Contains(TEXT(".")))
+                {
+                    ObjectPath += TEXT(".") + FPackageName::GetShortName(ObjectPath);
+                }
+                Blueprint = LoadObject<UBlueprint>(nullptr, *ObjectPath);
+            }
+            else
+            {
+                Blueprint = FSpirrowBridgeCommonUtils::FindBlueprintByName(Name, Path);
+            }
+
+            if (Blueprint)
+            {
+                Candidates.AddUnique(Blueprint);
+            }
+            else
+            {
+                NotFoundArray.Add(MakeShared<FJsonValueString>(Name));
+            }
+        }
+    }
+
+    // Folder: every Blueprint asset (including Widget/Anim Blueprints) under the content path
+    if (!Folder.IsEmpty())
+    {
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        FARFilter Filter;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        Filter.bRecursiveClasses = true;
+        Filter.PackagePaths.Add(FName(*Folder));
+        Filter.bRecursivePaths = bRecursive;
+
+        TArray<FAssetData> AssetDataList;
+        AssetRegistry.GetAssets(Filter, AssetDataList);
+        for (const FAssetData& AssetData : AssetDataList)
+        {
+            // dirty_only never needs to load Blueprints that are not in memory
+            if (bDirtyOnly && !AssetData.IsAssetLoaded())
+            {
+                continue;
+            }
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset()))
+            {
+                Candidates.AddUnique(Blueprint);
+            }
+        }
+    }
+
+    // Neither list nor folder: dirty_only scans the loaded Blueprints
+    if (!BlueprintNames && Folder.IsEmpty())
+    {
+        if (!bDirtyOnly)
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParams,
+                TEXT("Specify 'blueprints', 'folder' or 'dirty_only'"));
+        }
+        for (TObjectIterator<UBlueprint> It; It; ++It)
+        {
+            UBlueprint* Blueprint = *It;
+            if (Blueprint->IsAsset() && !Blueprint->HasAnyFlags(RF_Transient | RF_ClassDefaultObject))
+            {
+                Candidates.Add(Blueprint);
+            }
+        }
+    }
+
+    TArray<UBlueprint*> BlueprintsToCompile;
+    for (UBlueprint* Blueprint : Candidates)
+    {
+        const bool bOutOfDate = Blueprint->Status != BS_UpToDate && Blueprint->Status != BS_UpToDateWithWarnings;
+        const bool bDirty = Blueprint->GetOutermost()->IsDirty();
+        if (!bDirtyOnly || bOutOfDate || bDirty || FSpirrowBridgeCompileScheduler::Get().IsPending(Blueprint))
+        {
+            BlueprintsToCompile.Add(Blueprint);
+        }
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    TArray<FSpirrowBlueprintCompileResult> Results;
+    if (bSequential)
+    {
+        for (UBlueprint* Blueprint : BlueprintsToCompile)
+        {
+            // One Blueprint per pass gives individual times at the cost of repeated shared work
+            FSpirrowBridgeCompileScheduler::Get().CompileBlueprints({ Blueprint }, Results);
+        }
+    }
+    else
+    {
+        FSpirrowBridgeCompileScheduler::Get().CompileBlueprints(BlueprintsToCompile, Results);
+    }
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    TArray<TSharedPtr<FJsonValue>> ResultArray;
+    int32 CompiledCount = 0;
+    int32 FailedCount = 0;
+    int32 WarningCount = 0;
+    for (const FSpirrowBlueprintCompileResult& Result : Results)
+    {
+        ResultArray.Add(MakeShared<FJsonValueObject>(FSpirrowBridgeCompileScheduler::CompileResultToJson(Result, bIncludeMessages)));
+        CompiledCount += Result.bSuccess ? 1 : 0;
+        FailedCount += Result.bSuccess ? 0 : 1;
+        WarningCount += Result.NumWarnings;
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("mode"), bSequential ? TEXT("sequential") : TEXT("batch"));
+    ResultObj->SetArrayField(TEXT("blueprints"), ResultArray);
+    ResultObj->SetNumberField(TEXT("compiled"), CompiledCount);
+    ResultObj->SetNumberField(TEXT("failed"), FailedCount);
+    ResultObj->SetNumberField(TEXT("warnings"), WarningCount);
+    ResultObj->SetNumberField(TEXT("skipped"), Candidates.Num() - BlueprintsToCompile.Num());
+    ResultObj->SetArrayField(TEXT("not_found"), NotFoundArray);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), ElapsedMs);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
 {
     // Validate required parameters
@@ -369,7 +681,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleSetBlueprintP
         return Error;
     }
 
-    // Get the default object
+    // Get the default object; a queued compile would replace it
+    FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
     UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
     if (!DefaultObject)
     {
@@ -498,6 +811,26 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleGetBlueprintG
     FString Path;
     FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Blueprints"));
 
+    FGraphViewOptions Options;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_pins"), Options.bIncludePins, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_pin_defaults"), Options.bIncludePinDefaults, false);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_titles"), Options.bIncludeTitles, false);
+
+    // Optional graph name filter
+    TSet<FString> GraphFilter;
+    const TArray<TSharedPtr<FJsonValue>>* GraphNamesArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("graphs"), GraphNamesArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *GraphNamesArray)
+        {
+            GraphFilter.Add(Value->AsString());
+        }
+    }
+
+    // Hashes the client already holds, keyed by graph name
+    const TSharedPtr<FJsonObject>* IfNoneMatch = nullptr;
+    Params->TryGetObjectField(TEXT("if_none_match"), IfNoneMatch);
+
     // Validate and load Blueprint
     UBlueprint* Blueprint = nullptr;
     if (auto Error = FSpirrowBridgeCommonUtils::ValidateBlueprint(BlueprintName, Path, Blueprint))
@@ -509,87 +842,77 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleGetBlueprintG
     ResultData->SetStringField(TEXT("blueprint_name"), BlueprintName);
     ResultData->SetStringField(TEXT("parent_class"), Blueprint->ParentClass ? Blueprint->ParentClass->GetName() : TEXT("None"));
 
-    // Get Event Graph nodes
-    TArray<TSharedPtr<FJsonValue>> NodesArray;
-    TArray<TSharedPtr<FJsonValue>> ConnectionsArray;
-
+    // Event graph pages, functions and macros
+    TArray<TPair<UEdGraph*, const TCHAR*>> Graphs;
     for (UEdGraph* Graph : Blueprint->UbergraphPages)
     {
+        Graphs.Emplace(Graph, TEXT("Ubergraph"));
+    }
+    for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+    {
+        Graphs.Emplace(Graph, TEXT("Function"));
+    }
+    for (UEdGraph* Graph : Blueprint->MacroGraphs)
+    {
+        Graphs.Emplace(Graph, TEXT("Macro"));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> GraphsArray;
+    TSet<FString> FoundGraphs;
+    int32 UnchangedCount = 0;
+    for (const TPair<UEdGraph*, const TCHAR*>& Entry : Graphs)
+    {
+        UEdGraph* Graph = Entry.Key;
         if (!Graph) continue;
 
-        for (UEdGraphNode* Node : Graph->Nodes)
-        {
-            if (!Node) continue;
+        const FString GraphName = Graph->GetName();
+        if (GraphFilter.Num() > 0 && !GraphFilter.Contains(GraphName)) continue;
+        FoundGraphs.Add(GraphName);
 
-            TSharedPtr<FJsonObject> NodeObj = MakeShareable(new FJsonObject());
-            NodeObj->SetStringField(TEXT("id"), Node->NodeGuid.ToString());
-            NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
-            NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
-            NodeObj->SetNumberField(TEXT("pos_x"), Node->NodePosX);
-            NodeObj->SetNumberField(TEXT("pos_y"), Node->NodePosY);
+        const FString Hash = ComputeGraphHash(Graph, Options);
 
-            // Get node type info
-            if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
-            {
-                NodeObj->SetStringField(TEXT("type"), TEXT("Event"));
-                NodeObj->SetStringField(TEXT("event_name"), EventNode->GetFunctionName().ToString());
-            }
-            else if (UK2Node_CallFunction* FuncNode = Cast<UK2Node_CallFunction>(Node))
-            {
-                NodeObj->SetStringField(TEXT("type"), TEXT("Function"));
-                NodeObj->SetStringField(TEXT("function_name"), FuncNode->GetFunctionName().ToString());
-            }
-            else if (UK2Node_VariableGet* VarGetNode = Cast<UK2Node_VariableGet>(Node))
-            {
-                NodeObj->SetStringField(TEXT("type"), TEXT("VariableGet"));
-                NodeObj->SetStringField(TEXT("variable_name"), VarGetNode->GetVarName().ToString());
-            }
-            else if (UK2Node_VariableSet* VarSetNode = Cast<UK2Node_VariableSet>(Node))
-            {
-                NodeObj->SetStringField(TEXT("type"), TEXT("VariableSet"));
-                NodeObj->SetStringField(TEXT("variable_name"), VarSetNode->GetVarName().ToString());
-            }
-            else
-            {
-                NodeObj->SetStringField(TEXT("type"), TEXT("Other"));
-            }
+        TSharedPtr<FJsonObject> GraphObj = MakeShareable(new FJsonObject());
+        GraphObj->SetStringField(TEXT("name"), GraphName);
+        GraphObj->SetStringField(TEXT("graph_type"), Entry.Value);
+        GraphObj->SetStringField(TEXT("hash"), Hash);
+        GraphObj->SetNumberField(TEXT("node_count"), Graph->Nodes.Num());
 
-            // Get pin information
-            TArray<TSharedPtr<FJsonValue>> PinsArray;
-            for (UEdGraphPin* Pin : Node->Pins)
+        FString KnownHash;
+        if (IfNoneMatch && (*IfNoneMatch)->TryGetStringField(GraphName, KnownHash) && KnownHash == Hash)
+        {
+            GraphObj->SetStringField(TEXT("status"), TEXT("unchanged"));
+            ++UnchangedCount;
+        }
+        else
+        {
+            TArray<TSharedPtr<FJsonValue>> NodesArray;
+            TArray<TSharedPtr<FJsonValue>> ConnectionsArray;
+            for (UEdGraphNode* Node : Graph->Nodes)
             {
-                if (!Pin) continue;
-
-                TSharedPtr<FJsonObject> PinObj = MakeShareable(new FJsonObject());
-                PinObj->SetStringField(TEXT("name"), Pin->PinName.ToString());
-                PinObj->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("Input") : TEXT("Output"));
-                PinObj->SetStringField(TEXT("type"), Pin->PinType.PinCategory.ToString());
-                PinsArray.Add(MakeShareable(new FJsonValueObject(PinObj)));
+                if (!Node) continue;
+                NodesArray.Add(MakeShareable(new FJsonValueObject(NodeToJson(Node, Options, ConnectionsArray))));
+            }
 
-                // Record connections
-                for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-                {
-                    if (!LinkedPin || !LinkedPin->GetOwningNode()) continue;
+            GraphObj->SetStringField(TEXT("status"), TEXT("full"));
+            GraphObj->SetArrayField(TEXT("nodes"), NodesArray);
+            GraphObj->SetArrayField(TEXT("connections"), ConnectionsArray);
+        }
 
-                    if (Pin->Direction == EGPD_Output)
-                    {
-                        TSharedPtr<FJsonObject> ConnObj = MakeShareable(new FJsonObject());
-                        ConnObj->SetStringField(TEXT("source_node"), Node->NodeGuid.ToString());
-                        ConnObj->SetStringField(TEXT("source_pin"), Pin->PinName.ToString());
-                        ConnObj->SetStringField(TEXT("target_node"), LinkedPin->GetOwningNode()->NodeGuid.ToString());
-                        ConnObj->SetStringField(TEXT("target_pin"), LinkedPin->PinName.ToString());
-                        ConnectionsArray.Add(MakeShareable(new FJsonValueObject(ConnObj)));
-                    }
-                }
-            }
-            NodeObj->SetArrayField(TEXT("pins"), PinsArray);
+        GraphsArray.Add(MakeShareable(new FJsonValueObject(GraphObj)));
+    }
 
-            NodesArray.Add(MakeShareable(new FJsonValueObject(NodeObj)));
+    for (const FString& RequestedGraph : GraphFilter)
+    {
+        if (!FoundGraphs.Contains(RequestedGraph))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::GraphNotFound,
+                FString::Printf(TEXT("Graph not found: %s"), *RequestedGraph));
         }
     }
 
-    ResultData->SetArrayField(TEXT("nodes"), NodesArray);
-    ResultData->SetArrayField(TEXT("connections"), ConnectionsArray);
+    ResultData->SetArrayField(TEXT("graphs"), GraphsArray);
+    ResultData->SetNumberField(TEXT("unchanged_count"), UnchangedCount);
 
     // Get Variables
     TArray<TSharedPtr<FJsonValue>> VariablesArray;
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeBlueprintNodeCoreCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeNodeIndex.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EdGraph/EdGraph.h"
@@ -98,36 +99,28 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleConnectBl
         return Error;
     }
 
-    UEdGraph* EventGraph = FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::GraphNotFound,
-            TEXT("Failed to get event graph"));
-    }
-
+    // Nodes may live in any graph of the Blueprint (event graph, functions, macros)
     UEdGraphNode* SourceNode = nullptr;
     UEdGraphNode* TargetNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
+    if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, SourceNodeId, SourceNode, TEXT("Source node")))
     {
-        if (Node->NodeGuid.ToString() == SourceNodeId) SourceNode = Node;
-        else if (Node->NodeGuid.ToString() == TargetNodeId) TargetNode = Node;
+        return Error;
     }
-
-    if (!SourceNode)
+    if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, TargetNodeId, TargetNode, TEXT("Target node")))
     {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Source node not found: %s"), *SourceNodeId));
+        return Error;
     }
-    if (!TargetNode)
+
+    UEdGraph* Graph = SourceNode->GetGraph();
+    if (TargetNode->GetGraph() != Graph)
     {
         return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Target node not found: %s"), *TargetNodeId));
+            ESpirrowErrorCode::ConnectionFailed,
+            FString::Printf(TEXT("Nodes are in different graphs: %s, %s"),
+                *Graph->GetName(), *TargetNode->GetGraph()->GetName()));
     }
 
-    if (FSpirrowBridgeCommonUtils::ConnectGraphNodes(EventGraph, SourceNode, SourcePinName, TargetNode, TargetPinName))
+    if (FSpirrowBridgeCommonUtils::ConnectGraphNodes(Graph, SourceNode, SourcePinName, TargetNode, TargetPinName))
     {
         FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -174,30 +167,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleDisconnec
         return Error;
     }
 
-    UEdGraph* EventGraph = FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::GraphNotFound,
-            TEXT("Failed to get event graph"));
-    }
-
     // Find the source node
     UEdGraphNode* SourceNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
-    {
-        if (Node->NodeGuid.ToString() == NodeId)
-        {
-            SourceNode = Node;
-            break;
-        }
-    }
-
-    if (!SourceNode)
+    if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, NodeId, SourceNode))
     {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Node not found: %s"), *NodeId));
+        return Error;
     }
 
     int32 DisconnectedCount = 0;
@@ -207,20 +181,9 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleDisconnec
     if (!PinName.IsEmpty() && !TargetNodeId.IsEmpty() && !TargetPinName.IsEmpty())
     {
         UEdGraphNode* TargetNode = nullptr;
-        for (UEdGraphNode* Node : EventGraph->Nodes)
-        {
-            if (Node->NodeGuid.ToString() == TargetNodeId)
-            {
-                TargetNode = Node;
-                break;
-            }
-        }
-
-        if (!TargetNode)
+        if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, TargetNodeId, TargetNode, TEXT("Target node")))
         {
-            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-                ESpirrowErrorCode::NodeNotFound,
-                FString::Printf(TEXT("Target node not found: %s"), *TargetNodeId));
+            return Error;
         }
 
         UEdGraphPin* SourcePin = FSpirrowBridgeCommonUtils::FindPin(SourceNode, PinName, EGPD_MAX);
@@ -465,25 +428,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleSetNodePi
         return Error;
     }
 
-    UEdGraph* EventGraph = FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::GraphNotFound,
-            TEXT("Failed to get event graph"));
-    }
-
     UEdGraphNode* TargetNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
-    {
-        if (Node->NodeGuid.ToString() == NodeId) { TargetNode = Node; break; }
-    }
-
-    if (!TargetNode)
+    if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, NodeId, TargetNode))
     {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Node not found: %s"), *NodeId));
+        return Error;
     }
 
     UEdGraphPin* TargetPin = FSpirrowBridgeCommonUtils::FindPin(TargetNode, PinName, EGPD_Input);
@@ -549,32 +497,17 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleDeleteNod
         return Error;
     }
 
-    UEdGraph* EventGraph = FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::GraphNotFound,
-            TEXT("Failed to get event graph"));
-    }
-
     UEdGraphNode* TargetNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
+    if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, NodeId, TargetNode))
     {
-        if (Node->NodeGuid.ToString() == NodeId) { TargetNode = Node; break; }
-    }
-
-    if (!TargetNode)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Node not found: %s"), *NodeId));
+        return Error;
     }
 
     for (UEdGraphPin* Pin : TargetNode->Pins)
     {
         Pin->BreakAllPinLinks();
     }
-    EventGraph->RemoveNode(TargetNode);
+    TargetNode->GetGraph()->RemoveNode(TargetNode);
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -616,25 +549,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleMoveNode(
         return Error;
     }
 
-    UEdGraph* EventGraph = FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::GraphNotFound,
-            TEXT("Failed to get event graph"));
-    }
-
     UEdGraphNode* TargetNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
+    if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, NodeId, TargetNode))
     {
-        if (Node->NodeGuid.ToString() == NodeId) { TargetNode = Node; break; }
-    }
-
-    if (!TargetNode)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Node not found: %s"), *NodeId));
+        return Error;
     }
 
     TargetNode->NodePosX = NewPosition.X;
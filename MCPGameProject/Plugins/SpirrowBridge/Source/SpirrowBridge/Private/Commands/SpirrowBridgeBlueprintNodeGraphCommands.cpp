@@ -0,0 +1,1708 @@
+#include "Commands/SpirrowBridgeBlueprintNodeGraphCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeClassIndex.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeNodeIndex.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphNode_Comment.h"
+#include "K2Node_Event.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_ExecutionSequence.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_Self.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet/KismetStringLibrary.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "EdGraphSchema_K2.h"
+#include "ScopedTransaction.h"
+#include "Editor.h"
+
+namespace
+{
+    enum class EPatchNodeKind : uint8
+    {
+        Existing,
+        Event,
+        CustomEvent,
+        Function,
+        VariableGet,
+        VariableSet,
+        Branch,
+        Sequence,
+        Macro,
+        Self
+    };
+
+    /** One entry of the patch "nodes" list, resolved before anything is modified */
+    struct FPatchNode
+    {
+        FString Id;
+        EPatchNodeKind Kind = EPatchNodeKind::Existing;
+        FString TypeName;
+        FName MemberName;
+        UFunction* Function = nullptr;
+        UEdGraph* MacroGraph = nullptr;
+        int32 NumOutputs = 2;
+        bool bHasPosition = false;
+        FVector2D Position = FVector2D::ZeroVector;
+        const TSharedPtr<FJsonObject>* Pins = nullptr;
+        UEdGraphNode* Node = nullptr;
+        bool bCreated = false;
+    };
+
+    /** State of a pin on a node that existed before the patch, restored if the patch fails */
+    struct FPatchPinBackup
+    {
+        FString DefaultValue;
+        TObjectPtr<UObject> DefaultObject;
+        FText DefaultTextValue;
+        TArray<UEdGraphPin*> LinkedTo;
+    };
+
+    void BackupPatchPin(UEdGraphPin* Pin, TMap<UEdGraphPin*, FPatchPinBackup>& Backups)
+    {
+        if (Pin && !Backups.Contains(Pin))
+        {
+            Backups.Add(Pin, FPatchPinBackup{Pin->DefaultValue, Pin->DefaultObject, Pin->DefaultTextValue, Pin->LinkedTo});
+        }
+    }
+
+    struct FPatchLink
+    {
+        int32 FromIndex = INDEX_NONE;
+        int32 ToIndex = INDEX_NONE;
+        FString FromPin;
+        FString ToPin;
+    };
+
+    UFunction* FindFunctionIn(UClass* Class, const FString& FunctionName)
+    {
+        if (!Class)
+        {
+            return nullptr;
+        }
+        if (UFunction* Function = Class->FindFunctionByName(*FunctionName))
+        {
+            return Function;
+        }
+        for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+        {
+            if (It->GetName().Equals(FunctionName, ESearchCase::IgnoreCase))
+            {
+                return *It;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Target class when given; otherwise the Blueprint (skeleton, so uncompiled functions count) and the common libraries */
+    UFunction* ResolveFunction(UBlueprint* Blueprint, const FString& FunctionName, const FString& Target)
+    {
+        if (!Target.IsEmpty())
+        {
+            return FindFunctionIn(FSpirrowBridgeClassIndex::Get().FindClass(Target), FunctionName);
+        }
+        if (UFunction* Function = FindFunctionIn(Blueprint->SkeletonGeneratedClass, FunctionName))
+        {
+            return Function;
+        }
+
+        UClass* const Libraries[] = {
+            UKismetSystemLibrary::StaticClass(),
+            UKismetMathLibrary::StaticClass(),
+            UKismetStringLibrary::StaticClass(),
+            UGameplayStatics::StaticClass()
+        };
+        for (UClass* Library : Libraries)
+        {
+            if (UFunction* Function = Library->FindFunctionByName(*FunctionName))
+            {
+                return Function;
+            }
+        }
+        return nullptr;
+    }
+
+    UEdGraph* FindMacroGraph(UBlueprint* Blueprint, const FString& MacroName)
+    {
+        for (UEdGraph* Graph : Blueprint->MacroGraphs)
+        {
+            if (Graph && Graph->GetName() == MacroName)
+            {
+                return Graph;
+            }
+        }
+
+        UBlueprint* MacroLibrary = LoadObject<UBlueprint>(nullptr,
+            TEXT("/Engine/EditorBlueprintResources/StandardMacros.StandardMacros"));
+        if (MacroLibrary)
+        {
+            for (UEdGraph* Graph : MacroLibrary->MacroGraphs)
+            {
+                if (Graph && Graph->GetName() == MacroName)
+                {
+                    return Graph;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    /** Event node already handling this event (override or custom) anywhere in the ubergraph */
+    UK2Node_Event* FindExistingEvent(UBlueprint* Blueprint, FName EventName)
+    {
+        for (UEdGraph* Graph : Blueprint->UbergraphPages)
+        {
+            for (UEdGraphNode* Node : Graph->Nodes)
+            {
+                if (UK2Node_CustomEvent* CustomEvent = Cast<UK2Node_CustomEvent>(Node))
+                {
+                    if (CustomEvent->CustomFunctionName == EventName)
+                    {
+                        return CustomEvent;
+                    }
+                }
+                else if (UK2Node_Event* Event = Cast<UK2Node_Event>(Node))
+                {
+                    if (Event->EventReference.GetMemberName() == EventName)
+                    {
+                        return Event;
+                    }
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    template<typename TNode>
+    TNode* SpawnNode(UEdGraph* Graph, const FVector2D& Position, TFunctionRef<void(TNode*)> Setup)
+    {
+        TNode* Node = NewObject<TNode>(Graph);
+        Node->SetFlags(RF_Transactional);
+        Setup(Node);
+        Node->NodePosX = Position.X;
+        Node->NodePosY = Position.Y;
+        Graph->AddNode(Node, false, false);
+        Node->CreateNewGuid();
+        Node->PostPlacedNewNode();
+        Node->AllocateDefaultPins();
+        return Node;
+    }
+
+    UEdGraphNode* CreatePatchNode(UEdGraph* Graph, const FPatchNode& Spec)
+    {
+        switch (Spec.Kind)
+        {
+        case EPatchNodeKind::Event:
+            return SpawnNode<UK2Node_Event>(Graph, Spec.Position, [&Spec](UK2Node_Event* Node)
+            {
+                Node->EventReference.SetFromField<UFunction>(Spec.Function, false);
+                Node->bOverrideFunction = true;
+            });
+        case EPatchNodeKind::CustomEvent:
+            return SpawnNode<UK2Node_CustomEvent>(Graph, Spec.Position, [&Spec](UK2Node_CustomEvent* Node)
+            {
+                Node->CustomFunctionName = Spec.MemberName;
+            });
+        case EPatchNodeKind::Function:
+            return SpawnNode<UK2Node_CallFunction>(Graph, Spec.Position, [&Spec](UK2Node_CallFunction* Node)
+            {
+                Node->SetFromFunction(Spec.Function);
+            });
+        case EPatchNodeKind::VariableGet:
+            return SpawnNode<UK2Node_VariableGet>(Graph, Spec.Position, [&Spec](UK2Node_VariableGet* Node)
+            {
+                Node->VariableReference.SetSelfMember(Spec.MemberName);
+            });
+        case EPatchNodeKind::VariableSet:
+            return SpawnNode<UK2Node_VariableSet>(Graph, Spec.Position, [&Spec](UK2Node_VariableSet* Node)
+            {
+                Node->VariableReference.SetSelfMember(Spec.MemberName);
+            });
+        case EPatchNodeKind::Branch:
+            return SpawnNode<UK2Node_IfThenElse>(Graph, Spec.Position, [](UK2Node_IfThenElse*) {});
+        case EPatchNodeKind::Sequence:
+        {
+            UK2Node_ExecutionSequence* Node = SpawnNode<UK2Node_ExecutionSequence>(Graph, Spec.Position, [](UK2Node_ExecutionSequence*) {});
+            for (int32 Index = 2; Index < Spec.NumOutputs; ++Index)
+            {
+                Node->AddInputPin();
+            }
+            return Node;
+        }
+        case EPatchNodeKind::Macro:
+            return SpawnNode<UK2Node_MacroInstance>(Graph, Spec.Position, [&Spec](UK2Node_MacroInstance* Node)
+            {
+                Node->SetMacroGraph(Spec.MacroGraph);
+            });
+        case EPatchNodeKind::Self:
+            return SpawnNode<UK2Node_Self>(Graph, Spec.Position, [](UK2Node_Self*) {});
+        default:
+            return Spec.Node;
+        }
+    }
+
+    /** Named pin, or the first exec pin of the direction when no name is given */
+    UEdGraphPin* FindPatchPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction)
+    {
+        if (PinName.IsEmpty())
+        {
+            for (UEdGraphPin* Pin : Node->Pins)
+            {
+                if (Pin->Direction == Direction && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+                {
+                    return Pin;
+                }
+            }
+            return nullptr;
+        }
+        return Node->FindPin(FName(*PinName), Direction);
+    }
+
+    FString DescribePins(UEdGraphNode* Node, EEdGraphPinDirection Direction)
+    {
+        TArray<FString> Names;
+        for (UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin->bHidden && (Direction == EGPD_MAX || Pin->Direction == Direction))
+            {
+                Names.Add(Pin->PinName.ToString());
+            }
+        }
+        return FString::Join(Names, TEXT(", "));
+    }
+
+    /** Validate and set a pin default from JSON: numbers, bools, strings, [x,y,z] arrays and asset paths */
+    bool ApplyPinDefault(const UEdGraphSchema_K2* Schema, UEdGraphPin* Pin, const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+    {
+        const FName Category = Pin->PinType.PinCategory;
+        if (Category == UEdGraphSchema_K2::PC_Object || Category == UEdGraphSchema_K2::PC_Class ||
+            Category == UEdGraphSchema_K2::PC_SoftObject || Category == UEdGraphSchema_K2::PC_SoftClass ||
+            Category == UEdGraphSchema_K2::PC_Interface)
+        {
+            const FString ObjectPath = Value->AsString();
+            UObject* Object = nullptr;
+            if (!ObjectPath.IsEmpty() && ObjectPath != TEXT("None"))
+            {
+                Object = LoadObject<UObject>(nullptr, *ObjectPath);
+                if (!Object && (Category == UEdGraphSchema_K2::PC_Class || Category == UEdGraphSchema_K2::PC_SoftClass))
+                {
+                    Object = FSpirrowBridgeClassIndex::Get().FindClass(ObjectPath);
+                }
+                if (!Object)
+                {
+                    OutErrorMessage = FString::Printf(TEXT("Object not found: %s"), *ObjectPath);
+                    return false;
+                }
+            }
+            Pin->Modify();
+            Schema->TrySetDefaultObject(*Pin, Object);
+            return true;
+        }
+
+        FString DefaultValue;
+        switch (Value->Type)
+        {
+        case EJson::Number:
+            DefaultValue = Category == UEdGraphSchema_K2::PC_Int || Category == UEdGraphSchema_K2::PC_Int64 || Category == UEdGraphSchema_K2::PC_Byte
+                ? LexToString(FMath::RoundToInt64(Value->AsNumber()))
+                : FString::SanitizeFloat(Value->AsNumber());
+            break;
+        case EJson::Boolean:
+            DefaultValue = Value->AsBool() ? TEXT("true") : TEXT("false");
+            break;
+        case EJson::Array:
+        {
+            // Vector and rotator pins store "X,Y,Z"
+            TArray<FString> Components;
+            for (const TSharedPtr<FJsonValue>& Component : Value->AsArray())
+            {
+                Components.Add(FString::SanitizeFloat(Component->AsNumber()));
+            }
+            DefaultValue = FString::Join(Components, TEXT(","));
+            break;
+        }
+        default:
+            DefaultValue = Value->AsString();
+            break;
+        }
+
+        if (Category == UEdGraphSchema_K2::PC_Text)
+        {
+            Pin->Modify();
+            Schema->TrySetDefaultText(*Pin, FText::FromString(DefaultValue));
+            return true;
+        }
+
+        const FString ValidationError = Schema->IsPinDefaultValid(Pin, DefaultValue, nullptr, FText::GetEmpty());
+        if (!ValidationError.IsEmpty())
+        {
+            OutErrorMessage = ValidationError;
+            return false;
+        }
+        Pin->Modify();
+        Schema->TrySetDefaultValue(*Pin, DefaultValue);
+        return true;
+    }
+
+    // ===== Graph layout =====
+
+    bool HasExecPin(const UEdGraphNode* Node)
+    {
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Approximate on-screen size from title and pin labels (Slate geometry is not available outside the editor widget) */
+    FVector2D EstimateNodeSize(const UEdGraphNode* Node)
+    {
+        int32 Inputs = 0, Outputs = 0, InputChars = 0, OutputChars = 0;
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin || Pin->bHidden) continue;
+
+            int32 Chars = Pin->PinFriendlyName.IsEmpty() ? Pin->PinName.GetStringLength() : Pin->PinFriendlyName.ToString().Len();
+            if (Pin->Direction == EGPD_Input)
+            {
+                // Unlinked data inputs show an inline default value box
+                if (Pin->LinkedTo.Num() == 0 && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+                {
+                    Chars += 8;
+                }
+                ++Inputs;
+                InputChars = FMath::Max(InputChars, Chars);
+            }
+            else
+            {
+                ++Outputs;
+                OutputChars = FMath::Max(OutputChars, Chars);
+            }
+        }
+
+        TArray<FString> TitleLines;
+        Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString().ParseIntoArrayLines(TitleLines);
+        int32 TitleChars = 0;
+        for (const FString& Line : TitleLines)
+        {
+            TitleChars = FMath::Max(TitleChars, Line.Len());
+        }
+
+        const double Width = Node->NodeWidth > 0
+            ? Node->NodeWidth
+            : FMath::Clamp(FMath::Max(TitleChars * 7.0 + 48.0, (InputChars + OutputChars) * 7.0 + 64.0), 96.0, 640.0);
+        const double Height = Node->NodeHeight > 0
+            ? Node->NodeHeight
+            : 28.0 + 16.0 * FMath::Max(TitleLines.Num(), 1) + 24.0 * FMath::Max(Inputs, Outputs);
+        return FVector2D(Width, Height);
+    }
+
+    struct FLayoutNode
+    {
+        UEdGraphNode* Node = nullptr;
+        FVector2D Size = FVector2D::ZeroVector;
+        FVector2D Original = FVector2D::ZeroVector;
+        bool bExec = false;
+        /** Exec successors with the source pin's relative rank (0..1), back edges removed */
+        TArray<TPair<int32, double>> Next;
+        TArray<TPair<int32, double>> Prev;
+        /** Pure nodes feeding this node, in input pin order, and the nodes reading this one */
+        TArray<int32> DataInputs;
+        TArray<int32> DataConsumers;
+
+        /** Cells are exec nodes and pure nodes that feed nothing; every other pure node sits in a cell's data block */
+        bool bCell = false;
+        int32 Anchor = INDEX_NONE;
+        int32 Depth = 0;
+        /** Block members in placement order (cells only) */
+        TArray<int32> Block;
+        FVector2D BlockSize = FVector2D::ZeroVector;
+
+        int32 Layer = 0;
+        int32 Order = 0;
+        double SortKey = 0.0;
+        int32 Component = INDEX_NONE;
+        FVector2D Position = FVector2D::ZeroVector;
+    };
+
+    /**
+     * Sugiyama-style layout of a K2 graph:
+     *  1. exec edges only, back edges dropped by DFS, layers by longest path (left to right)
+     *  2. order inside each layer by alternating barycenter sweeps (pin rank breaks Then/Else ties)
+     *  3. pure nodes grouped into a block to the left of the first exec node that reads them, one column per depth
+     *  4. exec-connected components stacked top to bottom in their original order
+     * Every step is linear in nodes + links except the per-layer sorts, so the whole pass is O(E + N log N).
+     */
+    class FGraphLayout
+    {
+    public:
+        FGraphLayout(const TArray<UEdGraphNode*>& InNodes, double InHorizontalSpacing, double InVerticalSpacing)
+            : HorizontalSpacing(InHorizontalSpacing)
+            , VerticalSpacing(InVerticalSpacing)
+        {
+            Nodes.SetNum(InNodes.Num());
+            for (int32 Index = 0; Index < InNodes.Num(); ++Index)
+            {
+                FLayoutNode& Item = Nodes[Index];
+                Item.Node = InNodes[Index];
+                Item.Size = EstimateNodeSize(Item.Node);
+                Item.Original = FVector2D(Item.Node->NodePosX, Item.Node->NodePosY);
+                Item.bExec = HasExecPin(Item.Node);
+                IndexOf.Add(Item.Node, Index);
+            }
+        }
+
+        TArray<FLayoutNode> Nodes;
+        TMap<const UEdGraphNode*, int32> IndexOf;
+        /** Per component: member cells and bounds after layout (component-local until placed) */
+        TArray<TArray<int32>> Components;
+        TArray<FBox2D> ComponentBounds;
+        int32 LayerCount = 0;
+
+        void Run()
+        {
+            BuildEdges();
+            RemoveCycles();
+            AssignLayers();
+            AssignDataBlocks();
+            BuildComponents();
+            for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ++ComponentIndex)
+            {
+                OrderLayers(Components[ComponentIndex]);
+                PlaceComponent(ComponentIndex);
+            }
+        }
+
+        /** Shift a whole component (cells and their data blocks) */
+        void MoveComponent(int32 ComponentIndex, const FVector2D& Delta)
+        {
+            for (int32 Cell : Components[ComponentIndex])
+            {
+                Nodes[Cell].Position += Delta;
+                for (int32 Member : Nodes[Cell].Block)
+                {
+                    Nodes[Member].Position += Delta;
+                }
+            }
+            ComponentBounds[ComponentIndex] = ComponentBounds[ComponentIndex].ShiftBy(Delta);
+        }
+
+        template <typename FunctorType>
+        void ForEachComponentNode(int32 ComponentIndex, FunctorType&& Functor) const
+        {
+            for (int32 Cell : Components[ComponentIndex])
+            {
+                Functor(Cell);
+                for (int32 Member : Nodes[Cell].Block)
+                {
+                    Functor(Member);
+                }
+            }
+        }
+
+    private:
+        double HorizontalSpacing;
+        double VerticalSpacing;
+
+        void BuildEdges()
+        {
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                FLayoutNode& Item = Nodes[Index];
+                int32 ExecOutputs = 0;
+                for (const UEdGraphPin* Pin : Item.Node->Pins)
+                {
+                    ExecOutputs += (Pin && Pin->Direction == EGPD_Output && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec) ? 1 : 0;
+                }
+
+                int32 ExecRank = 0;
+                for (const UEdGraphPin* Pin : Item.Node->Pins)
+                {
+                    if (!Pin) continue;
+
+                    const bool bExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+                    if (bExecPin && Pin->Direction == EGPD_Output)
+                    {
+                        const double Rank = (ExecRank++ + 0.5) / ExecOutputs;
+                        for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+                        {
+                            const int32* Target = LinkedPin ? IndexOf.Find(LinkedPin->GetOwningNode()) : nullptr;
+                            if (Target && *Target != Index)
+                            {
+                                Item.Next.Emplace(*Target, Rank);
+                            }
+                        }
+                    }
+                    else if (!bExecPin && Pin->Direction == EGPD_Input)
+                    {
+                        for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+                        {
+                            const int32* Source = LinkedPin ? IndexOf.Find(LinkedPin->GetOwningNode()) : nullptr;
+                            if (Source && *Source != Index && !Nodes[*Source].bExec && !Item.DataInputs.Contains(*Source))
+                            {
+                                Item.DataInputs.Add(*Source);
+                                Nodes[*Source].DataConsumers.Add(Index);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /** Iterative DFS from the roots in original top-to-bottom order; links back into the current path are dropped */
+        void RemoveCycles()
+        {
+            TArray<int32> Roots;
+            TArray<int32> Incoming;
+            Incoming.SetNumZeroed(Nodes.Num());
+            for (const FLayoutNode& Item : Nodes)
+            {
+                for (const TPair<int32, double>& Edge : Item.Next)
+                {
+                    ++Incoming[Edge.Key];
+                }
+            }
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                if (Nodes[Index].bExec)
+                {
+                    Roots.Add(Index);
+                }
+            }
+            Roots.StableSort([this, &Incoming](int32 A, int32 B)
+            {
+                if ((Incoming[A] == 0) != (Incoming[B] == 0)) return Incoming[A] == 0;
+                return Nodes[A].Original.Y < Nodes[B].Original.Y;
+            });
+
+            enum : uint8 { Unvisited, OnPath, Done };
+            TArray<uint8> State;
+            State.SetNumZeroed(Nodes.Num());
+            TArray<TPair<int32, int32>> Stack;
+            for (int32 Root : Roots)
+            {
+                if (State[Root] != Unvisited) continue;
+                State[Root] = OnPath;
+                Stack.Emplace(Root, 0);
+                while (Stack.Num() > 0)
+                {
+                    TPair<int32, int32>& Top = Stack.Last();
+                    TArray<TPair<int32, double>>& Next = Nodes[Top.Key].Next;
+                    if (Top.Value >= Next.Num())
+                    {
+                        State[Top.Key] = Done;
+                        Stack.Pop(EAllowShrinking::No);
+                        continue;
+                    }
+                    const int32 Target = Next[Top.Value].Key;
+                    if (State[Target] == OnPath)
+                    {
+                        Next.RemoveAt(Top.Value, EAllowShrinking::No);
+                        continue;
+                    }
+                    ++Top.Value;
+                    if (State[Target] == Unvisited)
+                    {
+                        State[Target] = OnPath;
+                        Stack.Emplace(Target, 0);
+                    }
+                }
+            }
+
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                for (const TPair<int32, double>& Edge : Nodes[Index].Next)
+                {
+                    Nodes[Edge.Key].Prev.Emplace(Index, Edge.Value);
+                }
+            }
+        }
+
+        /** Longest path from the roots (Kahn order over the acyclic exec links) */
+        void AssignLayers()
+        {
+            TArray<int32> Incoming;
+            Incoming.SetNumZeroed(Nodes.Num());
+            TArray<int32> Queue;
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                Incoming[Index] = Nodes[Index].Prev.Num();
+                if (Nodes[Index].bExec && Incoming[Index] == 0)
+                {
+                    Queue.Add(Index);
+                }
+            }
+            for (int32 Head = 0; Head < Queue.Num(); ++Head)
+            {
+                const FLayoutNode& Item = Nodes[Queue[Head]];
+                for (const TPair<int32, double>& Edge : Item.Next)
+                {
+                    Nodes[Edge.Key].Layer = FMath::Max(Nodes[Edge.Key].Layer, Item.Layer + 1);
+                    if (--Incoming[Edge.Key] == 0)
+                    {
+                        Queue.Add(Edge.Key);
+                    }
+                }
+            }
+        }
+
+        /** Claim pure nodes for the earliest exec node (by layer, then original Y) that reads them */
+        void AssignDataBlocks()
+        {
+            TArray<int32> ExecNodes;
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                if (Nodes[Index].bExec)
+                {
+                    ExecNodes.Add(Index);
+                }
+            }
+            ExecNodes.Sort([this](int32 A, int32 B)
+            {
+                return Nodes[A].Layer != Nodes[B].Layer ? Nodes[A].Layer < Nodes[B].Layer : Nodes[A].Original.Y < Nodes[B].Original.Y;
+            });
+            for (int32 Index : ExecNodes)
+            {
+                ClaimBlock(Index);
+            }
+
+            // Pure nodes no exec node reads: each sink heads its own block
+            TArray<int32> Leftovers;
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                if (!Nodes[Index].bExec && Nodes[Index].Anchor == INDEX_NONE)
+                {
+                    Leftovers.Add(Index);
+                }
+            }
+            Leftovers.Sort([this](int32 A, int32 B) { return Nodes[A].Original.Y < Nodes[B].Original.Y; });
+            for (int32 Pass = 0; Pass < 2; ++Pass)
+            {
+                for (int32 Index : Leftovers)
+                {
+                    if (Nodes[Index].Anchor != INDEX_NONE)
+                    {
+                        continue;
+                    }
+                    bool bFeedsUnclaimed = false;
+                    for (int32 Consumer : Nodes[Index].DataConsumers)
+                    {
+                        bFeedsUnclaimed |= Nodes[Consumer].Anchor == INDEX_NONE && !Nodes[Consumer].bExec;
+                    }
+                    // Second pass: whatever is left is a data cycle; any member can head it
+                    if (!bFeedsUnclaimed || Pass == 1)
+                    {
+                        ClaimBlock(Index);
+                    }
+                }
+            }
+        }
+
+        /** Depth-first over pure inputs; every column of the block stacks its members in visit order */
+        void ClaimBlock(int32 CellIndex)
+        {
+            FLayoutNode& Cell = Nodes[CellIndex];
+            Cell.bCell = true;
+            Cell.Anchor = CellIndex;
+
+            TArray<int32> Stack;
+            for (int32 Input = Cell.DataInputs.Num() - 1; Input >= 0; --Input)
+            {
+                if (Nodes[Cell.DataInputs[Input]].Anchor == INDEX_NONE)
+                {
+                    Nodes[Cell.DataInputs[Input]].Depth = 1;
+                    Stack.Add(Cell.DataInputs[Input]);
+                }
+            }
+            while (Stack.Num() > 0)
+            {
+                const int32 Index = Stack.Pop(EAllowShrinking::No);
+                FLayoutNode& Item = Nodes[Index];
+                if (Item.Anchor != INDEX_NONE)
+                {
+                    continue;
+                }
+                Item.Anchor = CellIndex;
+                Cell.Block.Add(Index);
+                for (int32 Input = Item.DataInputs.Num() - 1; Input >= 0; --Input)
+                {
+                    if (Nodes[Item.DataInputs[Input]].Anchor == INDEX_NONE)
+                    {
+                        Nodes[Item.DataInputs[Input]].Depth = Item.Depth + 1;
+                        Stack.Add(Item.DataInputs[Input]);
+                    }
+                }
+            }
+
+            // Columns right to left: depth 1 is next to the cell
+            TArray<double> ColumnWidths;
+            TArray<double> ColumnHeights;
+            for (int32 Member : Cell.Block)
+            {
+                const int32 Column = Nodes[Member].Depth - 1;
+                if (ColumnWidths.Num() <= Column)
+                {
+                    ColumnWidths.SetNumZeroed(Column + 1);
+                    ColumnHeights.SetNumZeroed(Column + 1);
+                }
+                ColumnWidths[Column] = FMath::Max(ColumnWidths[Column], Nodes[Member].Size.X);
+            }
+            const double DataSpacing = HorizontalSpacing * 0.5;
+            TArray<double> ColumnX;
+            double Offset = 0.0;
+            for (double ColumnWidth : ColumnWidths)
+            {
+                Offset += ColumnWidth + DataSpacing;
+                ColumnX.Add(-Offset);
+            }
+            for (int32 Member : Cell.Block)
+            {
+                FLayoutNode& Item = Nodes[Member];
+                const int32 Column = Item.Depth - 1;
+                // Local to the cell's top-left; the right edge of each column lines up
+                Item.Position = FVector2D(ColumnX[Column] + ColumnWidths[Column] - Item.Size.X, ColumnHeights[Column]);
+                ColumnHeights[Column] += Item.Size.Y + VerticalSpacing * 0.5;
+            }
+
+            double BlockHeight = 0.0;
+            for (double ColumnHeight : ColumnHeights)
+            {
+                BlockHeight = FMath::Max(BlockHeight, ColumnHeight - VerticalSpacing * 0.5);
+            }
+            Cell.BlockSize = FVector2D(Offset, BlockHeight);
+        }
+
+        /** Weakly connected cells over exec links, ordered by where their topmost node was */
+        void BuildComponents()
+        {
+            TArray<int32> Parent;
+            Parent.SetNum(Nodes.Num());
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                Parent[Index] = Index;
+            }
+            auto FindRoot = [&Parent](int32 Index)
+            {
+                while (Parent[Index] != Index)
+                {
+                    Parent[Index] = Parent[Parent[Index]];
+                    Index = Parent[Index];
+                }
+                return Index;
+            };
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                for (const TPair<int32, double>& Edge : Nodes[Index].Next)
+                {
+                    Parent[FindRoot(Index)] = FindRoot(Edge.Key);
+                }
+            }
+
+            TMap<int32, int32> ComponentOfRoot;
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                if (!Nodes[Index].bCell) continue;
+
+                const int32 Root = FindRoot(Index);
+                int32* Existing = ComponentOfRoot.Find(Root);
+                if (!Existing)
+                {
+                    Existing = &ComponentOfRoot.Add(Root, Components.Num());
+                    Components.AddDefaulted();
+                }
+                Nodes[Index].Component = *Existing;
+                Components[*Existing].Add(Index);
+            }
+
+            auto TopOf = [this](const TArray<int32>& Cells)
+            {
+                double Top = TNumericLimits<double>::Max();
+                for (int32 Cell : Cells)
+                {
+                    Top = FMath::Min(Top, Nodes[Cell].Original.Y);
+                }
+                return Top;
+            };
+            Components.StableSort([&TopOf](const TArray<int32>& A, const TArray<int32>& B) { return TopOf(A) < TopOf(B); });
+            for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ++ComponentIndex)
+            {
+                for (int32 Cell : Components[ComponentIndex])
+                {
+                    Nodes[Cell].Component = ComponentIndex;
+                }
+            }
+            ComponentBounds.SetNum(Components.Num());
+        }
+
+        TArray<TArray<int32>> LayersOf(const TArray<int32>& Cells)
+        {
+            TArray<TArray<int32>> Layers;
+            for (int32 Cell : Cells)
+            {
+                if (Layers.Num() <= Nodes[Cell].Layer)
+                {
+                    Layers.SetNum(Nodes[Cell].Layer + 1);
+                }
+                Layers[Nodes[Cell].Layer].Add(Cell);
+            }
+            LayerCount = FMath::Max(LayerCount, Layers.Num());
+            return Layers;
+        }
+
+        void OrderLayers(const TArray<int32>& Cells)
+        {
+            TArray<TArray<int32>> Layers = LayersOf(Cells);
+            auto Renumber = [this](TArray<int32>& Layer)
+            {
+                for (int32 Order = 0; Order < Layer.Num(); ++Order)
+                {
+                    Nodes[Layer[Order]].Order = Order;
+                }
+            };
+            for (TArray<int32>& Layer : Layers)
+            {
+                Layer.StableSort([this](int32 A, int32 B) { return Nodes[A].Original.Y < Nodes[B].Original.Y; });
+                Renumber(Layer);
+            }
+
+            // Barycenter of the neighbours' order in the previous (down) or next (up) sweep direction
+            auto SortByNeighbours = [this, &Renumber](TArray<int32>& Layer, bool bDown)
+            {
+                for (int32 Cell : Layer)
+                {
+                    const TArray<TPair<int32, double>>& Neighbours = bDown ? Nodes[Cell].Prev : Nodes[Cell].Next;
+                    if (Neighbours.Num() == 0)
+                    {
+                        Nodes[Cell].SortKey = Nodes[Cell].Order;
+                        continue;
+                    }
+                    double Sum = 0.0;
+                    for (const TPair<int32, double>& Edge : Neighbours)
+                    {
+                        Sum += Nodes[Edge.Key].Order + (bDown ? Edge.Value : 0.5);
+                    }
+                    Nodes[Cell].SortKey = Sum / Neighbours.Num();
+                }
+                Layer.StableSort([this](int32 A, int32 B) { return Nodes[A].SortKey < Nodes[B].SortKey; });
+                Renumber(Layer);
+            };
+
+            constexpr int32 SweepCount = 4;
+            for (int32 Sweep = 0; Sweep < SweepCount; ++Sweep)
+            {
+                for (int32 LayerIndex = 1; LayerIndex < Layers.Num(); ++LayerIndex)
+                {
+                    SortByNeighbours(Layers[LayerIndex], true);
+                }
+                for (int32 LayerIndex = Layers.Num() - 2; LayerIndex >= 0; --LayerIndex)
+                {
+                    SortByNeighbours(Layers[LayerIndex], false);
+                }
+            }
+            // End on a down sweep so branches read Then above Else
+            for (int32 LayerIndex = 1; LayerIndex < Layers.Num(); ++LayerIndex)
+            {
+                SortByNeighbours(Layers[LayerIndex], true);
+            }
+        }
+
+        /** Columns sized by the widest node and data block of each layer; each cell aims for its predecessors' row */
+        void PlaceComponent(int32 ComponentIndex)
+        {
+            TArray<TArray<int32>> Layers = LayersOf(Components[ComponentIndex]);
+            for (TArray<int32>& Layer : Layers)
+            {
+                Layer.Sort([this](int32 A, int32 B) { return Nodes[A].Order < Nodes[B].Order; });
+            }
+
+            double ColumnStart = 0.0;
+            for (TArray<int32>& Layer : Layers)
+            {
+                double BlockWidth = 0.0, NodeWidth = 0.0;
+                for (int32 Cell : Layer)
+                {
+                    BlockWidth = FMath::Max(BlockWidth, Nodes[Cell].BlockSize.X);
+                    NodeWidth = FMath::Max(NodeWidth, Nodes[Cell].Size.X);
+                }
+                const double NodeX = ColumnStart + BlockWidth;
+
+                double Cursor = 0.0;
+                for (int32 Cell : Layer)
+                {
+                    FLayoutNode& Item = Nodes[Cell];
+                    double Desired = Cursor;
+                    if (Item.Prev.Num() > 0)
+                    {
+                        double Sum = 0.0;
+                        for (const TPair<int32, double>& Edge : Item.Prev)
+                        {
+                            Sum += Nodes[Edge.Key].Position.Y;
+                        }
+                        Desired = Sum / Item.Prev.Num();
+                    }
+                    Item.Position = FVector2D(NodeX, FMath::Max(Cursor, Desired));
+                    Cursor = Item.Position.Y + FMath::Max(Item.Size.Y, Item.BlockSize.Y) + VerticalSpacing;
+                }
+                ColumnStart = NodeX + NodeWidth + HorizontalSpacing;
+            }
+
+            FBox2D Bounds(ForceInit);
+            for (int32 Cell : Components[ComponentIndex])
+            {
+                const FLayoutNode& Item = Nodes[Cell];
+                for (int32 Member : Item.Block)
+                {
+                    Nodes[Member].Position += Item.Position;
+                    Bounds += Nodes[Member].Position;
+                    Bounds += Nodes[Member].Position + Nodes[Member].Size;
+                }
+                Bounds += Item.Position;
+                Bounds += Item.Position + Item.Size;
+            }
+            ComponentBounds[ComponentIndex] = Bounds;
+        }
+    };
+
+    bool BoxesOverlap(const FBox2D& A, const FBox2D& B)
+    {
+        return A.Min.X < B.Max.X && B.Min.X < A.Max.X && A.Min.Y < B.Max.Y && B.Min.Y < A.Max.Y;
+    }
+}
+
+FSpirrowBridgeBlueprintNodeGraphCommands::FSpirrowBridgeBlueprintNodeGraphCommands()
+{
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeGraphCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("apply_graph_patch"))
+    {
+        return HandleApplyGraphPatch(Params);
+    }
+    else if (CommandType == TEXT("auto_layout_blueprint_graph"))
+    {
+        return HandleAutoLayoutBlueprintGraph(Params);
+    }
+
+    return nullptr;
+}
+
+UEdGraph* FSpirrowBridgeBlueprintNodeGraphCommands::FindGraph(UBlueprint* Blueprint, const FString& GraphName)
+{
+    if (GraphName.IsEmpty())
+    {
+        return FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
+    }
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (Graph && Graph->GetName() == GraphName)
+        {
+            return Graph;
+        }
+    }
+    return nullptr;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeGraphCommands::HandleApplyGraphPatch(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Validate required parameters
+    FString BlueprintName;
+    if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("blueprint_name"), BlueprintName))
+    {
+        return Error;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* NodesArray = nullptr;
+    if (!Params->TryGetArrayField(TEXT("nodes"), NodesArray))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("Missing 'nodes' parameter"));
+    }
+    const TArray<TSharedPtr<FJsonValue>>* LinksArray = nullptr;
+    Params->TryGetArrayField(TEXT("links"), LinksArray);
+
+    // Get optional parameters
+    FString Path, GraphName;
+    bool bCompile = true;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Blueprints"));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("graph_name"), GraphName);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("compile"), bCompile, true);
+
+    // Validate and load Blueprint
+    UBlueprint* Blueprint = nullptr;
+    if (auto Error = FSpirrowBridgeCommonUtils::ValidateBlueprint(BlueprintName, Path, Blueprint))
+    {
+        return Error;
+    }
+
+    UEdGraph* Graph = FindGraph(Blueprint, GraphName);
+    if (!Graph)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::GraphNotFound,
+            FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+    const bool bIsEventGraph = Blueprint->UbergraphPages.Contains(Graph);
+
+    // Resolve every node before touching the Blueprint, so a bad entry costs no rollback
+    TArray<FPatchNode> PatchNodes;
+    TMap<FString, int32> IdToIndex;
+    for (int32 Index = 0; Index < NodesArray->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* NodeObj = nullptr;
+        FPatchNode Spec;
+        if (!(*NodesArray)[Index]->TryGetObject(NodeObj) || !(*NodeObj)->TryGetStringField(TEXT("id"), Spec.Id) || Spec.Id.IsEmpty())
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParams,
+                FString::Printf(TEXT("nodes[%d] needs an 'id'"), Index));
+        }
+        if (IdToIndex.Contains(Spec.Id))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParams,
+                FString::Printf(TEXT("Duplicate node id: %s"), *Spec.Id));
+        }
+
+        (*NodeObj)->TryGetObjectField(TEXT("pins"), Spec.Pins);
+        if ((*NodeObj)->HasField(TEXT("position")))
+        {
+            Spec.bHasPosition = true;
+            Spec.Position = FSpirrowBridgeCommonUtils::GetVector2DFromJson(*NodeObj, TEXT("position"));
+        }
+
+        FString ExistingId, Name, Target;
+        (*NodeObj)->TryGetStringField(TEXT("type"), Spec.TypeName);
+        (*NodeObj)->TryGetStringField(TEXT("node_id"), ExistingId);
+        (*NodeObj)->TryGetStringField(TEXT("name"), Name);
+        (*NodeObj)->TryGetStringField(TEXT("target"), Target);
+
+        FString Error;
+        int32 ErrorCode = ESpirrowErrorCode::InvalidParamValue;
+        if (!ExistingId.IsEmpty() || Spec.TypeName == TEXT("existing"))
+        {
+            FGuid Guid;
+            if (!FGuid::Parse(ExistingId, Guid))
+            {
+                Error = FString::Printf(TEXT("Invalid node_id: '%s'"), *ExistingId);
+            }
+            else
+            {
+                UEdGraphNode* Node = FSpirrowBridgeNodeIndex::Get().FindNode(Blueprint, Guid);
+                if (Node && Node->GetGraph() == Graph)
+                {
+                    Spec.Node = Node;
+                }
+                else
+                {
+                    ErrorCode = ESpirrowErrorCode::NodeNotFound;
+                    Error = Node
+                        ? FString::Printf(TEXT("Node %s is in graph '%s', not '%s'"), *ExistingId, *Node->GetGraph()->GetName(), *Graph->GetName())
+                        : FString::Printf(TEXT("Node not found: %s"), *ExistingId);
+                }
+            }
+            Spec.Kind = EPatchNodeKind::Existing;
+        }
+        else if (Spec.TypeName == TEXT("event"))
+        {
+            Spec.Kind = EPatchNodeKind::Event;
+            Spec.MemberName = FName(*Name);
+            Spec.Node = FindExistingEvent(Blueprint, Spec.MemberName);
+            if (Spec.Node && Spec.Node->GetGraph() != Graph)
+            {
+                // Events exist once per Blueprint, and links cannot cross graphs
+                Error = FString::Printf(TEXT("Event '%s' already exists in graph '%s'"), *Name, *Spec.Node->GetGraph()->GetName());
+            }
+            else if (Spec.Node)
+            {
+                // Events exist once per Blueprint; reuse the handler that is already there
+                Spec.Kind = EPatchNodeKind::Existing;
+            }
+            else if (!bIsEventGraph)
+            {
+                Error = TEXT("Event nodes can only be added to an event graph");
+            }
+            else
+            {
+                Spec.Function = Blueprint->ParentClass ? Blueprint->ParentClass->FindFunctionByName(Spec.MemberName) : nullptr;
+                if (!Spec.Function || !Spec.Function->HasAnyFunctionFlags(FUNC_BlueprintEvent))
+                {
+                    ErrorCode = ESpirrowErrorCode::FunctionNotFound;
+                    Error = FString::Printf(TEXT("'%s' is not an overridable event of %s; use type 'custom_event'"),
+                        *Name, *GetNameSafe(Blueprint->ParentClass));
+                }
+            }
+        }
+        else if (Spec.TypeName == TEXT("custom_event"))
+        {
+            Spec.Kind = EPatchNodeKind::CustomEvent;
+            Spec.MemberName = FName(*Name);
+            Spec.Node = FindExistingEvent(Blueprint, Spec.MemberName);
+            if (Spec.Node && Spec.Node->GetGraph() != Graph)
+            {
+                Error = FString::Printf(TEXT("Event '%s' already exists in graph '%s'"), *Name, *Spec.Node->GetGraph()->GetName());
+            }
+            else if (Spec.Node)
+            {
+                Spec.Kind = EPatchNodeKind::Existing;
+            }
+            else if (Name.IsEmpty() || !bIsEventGraph)
+            {
+                Error = Name.IsEmpty() ? TEXT("custom_event needs a 'name'") : TEXT("Event nodes can only be added to an event graph");
+            }
+        }
+        else if (Spec.TypeName == TEXT("function"))
+        {
+            Spec.Kind = EPatchNodeKind::Function;
+            Spec.Function = ResolveFunction(Blueprint, Name, Target);
+            if (!Spec.Function)
+            {
+                ErrorCode = ESpirrowErrorCode::FunctionNotFound;
+                Error = FString::Printf(TEXT("Function not found: %s in target %s"), *Name, Target.IsEmpty() ? TEXT("Blueprint") : *Target);
+            }
+        }
+        else if (Spec.TypeName == TEXT("variable_get") || Spec.TypeName == TEXT("variable_set"))
+        {
+            Spec.Kind = Spec.TypeName == TEXT("variable_get") ? EPatchNodeKind::VariableGet : EPatchNodeKind::VariableSet;
+            Spec.MemberName = FName(*Name);
+            if (!FindFProperty<FProperty>(Blueprint->SkeletonGeneratedClass, Spec.MemberName))
+            {
+                ErrorCode = ESpirrowErrorCode::VariableNotFound;
+                Error = FString::Printf(TEXT("Variable not found: %s"), *Name);
+            }
+        }
+        else if (Spec.TypeName == TEXT("branch"))
+        {
+            Spec.Kind = EPatchNodeKind::Branch;
+        }
+        else if (Spec.TypeName == TEXT("sequence"))
+        {
+            double NumOutputs = 2.0;
+            (*NodeObj)->TryGetNumberField(TEXT("num_outputs"), NumOutputs);
+            Spec.Kind = EPatchNodeKind::Sequence;
+            Spec.NumOutputs = FMath::Clamp(static_cast<int32>(NumOutputs), 2, 10);
+        }
+        else if (Spec.TypeName == TEXT("macro"))
+        {
+            Spec.Kind = EPatchNodeKind::Macro;
+            Spec.MacroGraph = FindMacroGraph(Blueprint, Name);
+            if (!Spec.MacroGraph)
+            {
+                ErrorCode = ESpirrowErrorCode::GraphNotFound;
+                Error = FString::Printf(TEXT("Macro not found: %s"), *Name);
+            }
+        }
+        else if (Spec.TypeName == TEXT("self"))
+        {
+            Spec.Kind = EPatchNodeKind::Self;
+        }
+        else
+        {
+            Error = FString::Printf(TEXT("Unknown node type '%s'. Use event, custom_event, function, variable_get, variable_set, branch, sequence, macro, self or node_id"),
+                *Spec.TypeName);
+        }
+
+        if (!Error.IsEmpty())
+        {
+            TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
+            Details->SetStringField(TEXT("id"), Spec.Id);
+            Details->SetNumberField(TEXT("index"), Index);
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(ErrorCode, Error, Details);
+        }
+
+        IdToIndex.Add(Spec.Id, PatchNodes.Num());
+        PatchNodes.Add(MoveTemp(Spec));
+    }
+
+    TArray<FPatchLink> PatchLinks;
+    if (LinksArray)
+    {
+        for (int32 Index = 0; Index < LinksArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* LinkObj = nullptr;
+            FString FromId, ToId;
+            FPatchLink Link;
+            if ((*LinksArray)[Index]->TryGetObject(LinkObj))
+            {
+                (*LinkObj)->TryGetStringField(TEXT("from"), FromId);
+                (*LinkObj)->TryGetStringField(TEXT("to"), ToId);
+                (*LinkObj)->TryGetStringField(TEXT("from_pin"), Link.FromPin);
+                (*LinkObj)->TryGetStringField(TEXT("to_pin"), Link.ToPin);
+            }
+            const int32* FromIndex = IdToIndex.Find(FromId);
+            const int32* ToIndex = IdToIndex.Find(ToId);
+            if (!FromIndex || !ToIndex)
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::InvalidParams,
+                    FString::Printf(TEXT("links[%d]: 'from' and 'to' must name node ids declared in 'nodes' (got '%s' -> '%s')"),
+                        Index, *FromId, *ToId));
+            }
+            Link.FromIndex = *FromIndex;
+            Link.ToIndex = *ToIndex;
+            PatchLinks.Add(MoveTemp(Link));
+        }
+    }
+
+    // New nodes without a position go in a row to the right of the existing graph
+    FVector2D AutoPosition(0.0, 0.0);
+    bool bHasExistingNodes = false;
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node)
+        {
+            AutoPosition.X = bHasExistingNodes ? FMath::Max(AutoPosition.X, static_cast<double>(Node->NodePosX)) : Node->NodePosX;
+            bHasExistingNodes = true;
+        }
+    }
+    if (bHasExistingNodes)
+    {
+        AutoPosition.X += 400.0;
+    }
+
+    const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+    FString FailureMessage;
+    int32 FailureCode = ESpirrowErrorCode::OperationFailed;
+    int32 CreatedCount = 0;
+    int32 PinsSet = 0;
+    int32 LinksCreated = 0;
+    {
+        // Pins of pre-existing nodes touched by the patch, so a failure can restore them without
+        // relying on the undo buffer (which may be disabled or hold someone else's transaction)
+        TMap<UEdGraphPin*, FPatchPinBackup> PinBackups;
+        FScopedTransaction Transaction(NSLOCTEXT("SpirrowBridge", "ApplyGraphPatch", "Apply Graph Patch"));
+        Blueprint->Modify();
+        Graph->Modify();
+
+        for (FPatchNode& Spec : PatchNodes)
+        {
+            if (Spec.Kind == EPatchNodeKind::Existing)
+            {
+                Spec.Node->Modify();
+                continue;
+            }
+            if (!Spec.bHasPosition)
+            {
+                Spec.Position = AutoPosition;
+                AutoPosition.X += 300.0;
+            }
+            Spec.Node = CreatePatchNode(Graph, Spec);
+            if (!Spec.Node)
+            {
+                FailureCode = ESpirrowErrorCode::NodeCreationFailed;
+                FailureMessage = FString::Printf(TEXT("Failed to create node '%s' (%s)"), *Spec.Id, *Spec.TypeName);
+                break;
+            }
+            Spec.bCreated = true;
+            ++CreatedCount;
+        }
+
+        for (int32 Index = 0; FailureMessage.IsEmpty() && Index < PatchNodes.Num(); ++Index)
+        {
+            const FPatchNode& Spec = PatchNodes[Index];
+            if (!Spec.Pins)
+            {
+                continue;
+            }
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& PinValue : (*Spec.Pins)->Values)
+            {
+                UEdGraphPin* Pin = Spec.Node->FindPin(FName(*PinValue.Key), EGPD_Input);
+                FString PinError;
+                if (!Pin)
+                {
+                    FailureCode = ESpirrowErrorCode::PinNotFound;
+                    PinError = FString::Printf(TEXT("Pin not found: %s (inputs: %s)"), *PinValue.Key, *DescribePins(Spec.Node, EGPD_Input));
+                }
+                else
+                {
+                    if (!Spec.bCreated)
+                    {
+                        BackupPatchPin(Pin, PinBackups);
+                    }
+                    if (!ApplyPinDefault(Schema, Pin, PinValue.Value, PinError))
+                    {
+                        FailureCode = ESpirrowErrorCode::InvalidParamValue;
+                    }
+                }
+                if (!PinError.IsEmpty())
+                {
+                    FailureMessage = FString::Printf(TEXT("Node '%s' pin '%s': %s"), *Spec.Id, *PinValue.Key, *PinError);
+                    break;
+                }
+                ++PinsSet;
+            }
+        }
+
+        for (int32 Index = 0; FailureMessage.IsEmpty() && Index < PatchLinks.Num(); ++Index)
+        {
+            const FPatchLink& Link = PatchLinks[Index];
+            const FPatchNode& From = PatchNodes[Link.FromIndex];
+            const FPatchNode& To = PatchNodes[Link.ToIndex];
+            UEdGraphPin* FromPin = FindPatchPin(From.Node, Link.FromPin, EGPD_Output);
+            UEdGraphPin* ToPin = FindPatchPin(To.Node, Link.ToPin, EGPD_Input);
+            if (!FromPin || !ToPin)
+            {
+                FailureCode = ESpirrowErrorCode::PinNotFound;
+                FailureMessage = !FromPin
+                    ? FString::Printf(TEXT("links[%d]: output pin '%s' not found on '%s' (outputs: %s)"),
+                        Index, *Link.FromPin, *From.Id, *DescribePins(From.Node, EGPD_Output))
+                    : FString::Printf(TEXT("links[%d]: input pin '%s' not found on '%s' (inputs: %s)"),
+                        Index, *Link.ToPin, *To.Id, *DescribePins(To.Node, EGPD_Input));
+                break;
+            }
+
+            // Connecting can break links the pins already had (single-link data inputs, exec outputs)
+            if (!From.bCreated)
+            {
+                BackupPatchPin(FromPin, PinBackups);
+            }
+            if (!To.bCreated)
+            {
+                BackupPatchPin(ToPin, PinBackups);
+            }
+
+            const FPinConnectionResponse Response = Schema->CanCreateConnection(FromPin, ToPin);
+            if (Response.Response == CONNECT_RESPONSE_DISALLOW || !Schema->TryCreateConnection(FromPin, ToPin))
+            {
+                FailureCode = ESpirrowErrorCode::ConnectionFailed;
+                FailureMessage = FString::Printf(TEXT("links[%d]: cannot connect %s.%s -> %s.%s: %s"),
+                    Index, *From.Id, *FromPin->PinName.ToString(), *To.Id, *ToPin->PinName.ToString(), *Response.Message.ToString());
+                break;
+            }
+            ++LinksCreated;
+        }
+
+        if (!FailureMessage.IsEmpty())
+        {
+            // Nothing is compiled or saved yet. Removing the created nodes also breaks their links
+            for (const FPatchNode& Spec : PatchNodes)
+            {
+                if (Spec.bCreated && Spec.Node)
+                {
+                    FBlueprintEditorUtils::RemoveNode(Blueprint, Spec.Node, true);
+                }
+            }
+            for (const TPair<UEdGraphPin*, FPatchPinBackup>& Backup : PinBackups)
+            {
+                UEdGraphPin* Pin = Backup.Key;
+                Pin->BreakAllPinLinks();
+                for (UEdGraphPin* LinkedPin : Backup.Value.LinkedTo)
+                {
+                    Pin->MakeLinkTo(LinkedPin);
+                }
+                Pin->DefaultValue = Backup.Value.DefaultValue;
+                Pin->DefaultObject = Backup.Value.DefaultObject;
+                Pin->DefaultTextValue = Backup.Value.DefaultTextValue;
+            }
+            Graph->NotifyGraphChanged();
+            // The graph is back to its previous state; leave no empty entry on the undo stack
+            Transaction.Cancel();
+
+            TSharedPtr<FJsonObject> FailureDetails = MakeShared<FJsonObject>();
+            FailureDetails->SetBoolField(TEXT("rolled_back"), true);
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(FailureCode, FailureMessage, FailureDetails);
+        }
+    }
+
+    // New events and function calls change the generated class (event stubs, called-function references)
+    const bool bStructural = PatchNodes.ContainsByPredicate([](const FPatchNode& Spec)
+    {
+        return Spec.bCreated && (Spec.Kind == EPatchNodeKind::Event || Spec.Kind == EPatchNodeKind::CustomEvent || Spec.Kind == EPatchNodeKind::Function);
+    });
+    if (bStructural)
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    }
+    else
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    }
+    if (bCompile)
+    {
+        FSpirrowBridgeCompileScheduler::Get().RequestCompile(Blueprint);
+    }
+    const bool bCompilePending = bCompile && FSpirrowBridgeCompileScheduler::Get().IsPending(Blueprint);
+
+    TSharedPtr<FJsonObject> NodeIds = MakeShared<FJsonObject>();
+    TArray<TSharedPtr<FJsonValue>> ReusedArray;
+    for (const FPatchNode& Spec : PatchNodes)
+    {
+        NodeIds->SetStringField(Spec.Id, Spec.Node->NodeGuid.ToString());
+        if (!Spec.bCreated && Spec.TypeName != TEXT("existing") && !Spec.TypeName.IsEmpty())
+        {
+            ReusedArray.Add(MakeShared<FJsonValueString>(Spec.Id));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("blueprint"), Blueprint->GetName());
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetObjectField(TEXT("node_ids"), NodeIds);
+    ResultObj->SetArrayField(TEXT("reused"), ReusedArray);
+    ResultObj->SetNumberField(TEXT("nodes_created"), CreatedCount);
+    ResultObj->SetNumberField(TEXT("pins_set"), PinsSet);
+    ResultObj->SetNumberField(TEXT("links_created"), LinksCreated);
+    ResultObj->SetBoolField(TEXT("compile_pending"), bCompilePending);
+    // A deferred compile has not run yet, so Status would describe the previous compile
+    if (bCompile && !bCompilePending)
+    {
+        ResultObj->SetBoolField(TEXT("compile_errors"), Blueprint->Status == BS_Error);
+    }
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeGraphCommands::HandleAutoLayoutBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Validate required parameters
+    FString BlueprintName;
+    if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("blueprint_name"), BlueprintName))
+    {
+        return Error;
+    }
+
+    // Get optional parameters
+    FString Path, GraphName;
+    double HorizontalSpacing, VerticalSpacing;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Blueprints"));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("graph_name"), GraphName);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("horizontal_spacing"), HorizontalSpacing, 80.0);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("vertical_spacing"), VerticalSpacing, 48.0);
+    if (HorizontalSpacing < 0.0 || VerticalSpacing < 0.0)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            TEXT("horizontal_spacing and vertical_spacing must be >= 0"));
+    }
+
+    // Validate and load Blueprint
+    UBlueprint* Blueprint = nullptr;
+    if (auto Error = FSpirrowBridgeCommonUtils::ValidateBlueprint(BlueprintName, Path, Blueprint))
+    {
+        return Error;
+    }
+
+    // Only these nodes move when "node_ids" is given (e.g. the ids apply_graph_patch returned)
+    TSet<UEdGraphNode*> Selected;
+    UEdGraphNode* FirstSelected = nullptr;
+    const TArray<TSharedPtr<FJsonValue>>* NodeIdsArray = nullptr;
+    const bool bPartial = Params->TryGetArrayField(TEXT("node_ids"), NodeIdsArray) && NodeIdsArray->Num() > 0;
+    if (bPartial)
+    {
+        for (const TSharedPtr<FJsonValue>& NodeIdValue : *NodeIdsArray)
+        {
+            UEdGraphNode* Node = nullptr;
+            if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, NodeIdValue->AsString(), Node))
+            {
+                return Error;
+            }
+            FirstSelected = FirstSelected ? FirstSelected : Node;
+            Selected.Add(Node);
+        }
+    }
+
+    UEdGraph* Graph = (bPartial && GraphName.IsEmpty()) ? FirstSelected->GetGraph() : FindGraph(Blueprint, GraphName);
+    if (!Graph)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::GraphNotFound,
+            FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+    for (const UEdGraphNode* Node : Selected)
+    {
+        if (Node->GetGraph() != Graph)
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParamValue,
+                FString::Printf(TEXT("Node %s is in graph %s, not %s"),
+                    *Node->NodeGuid.ToString(), *Node->GetGraph()->GetName(), *Graph->GetName()));
+        }
+    }
+
+    // Comments keep their place and size; they are usually drawn around nodes by hand
+    TArray<UEdGraphNode*> LayoutNodes;
+    TArray<UEdGraphNode*> FixedNodes;
+    int32 CommentCount = 0;
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (!Node) continue;
+        if (Cast<UEdGraphNode_Comment>(Node))
+        {
+            ++CommentCount;
+            continue;
+        }
+        (!bPartial || Selected.Contains(Node) ? LayoutNodes : FixedNodes).Add(Node);
+    }
+
+    FGraphLayout Layout(LayoutNodes, HorizontalSpacing, VerticalSpacing);
+    Layout.Run();
+
+    if (!bPartial)
+    {
+        // Components top to bottom from the graph's original top-left corner
+        FVector2D Origin(TNumericLimits<double>::Max(), TNumericLimits<double>::Max());
+        for (const FLayoutNode& Item : Layout.Nodes)
+        {
+            Origin = Origin.ComponentMin(Item.Original);
+        }
+        // On the grid, so laying out an already laid out graph moves nothing
+        Origin = FVector2D(FMath::GridSnap(Origin.X, 16.0), FMath::GridSnap(Origin.Y, 16.0));
+        double Top = Origin.Y;
+        for (int32 ComponentIndex = 0; ComponentIndex < Layout.Components.Num(); ++ComponentIndex)
+        {
+            const FBox2D& Bounds = Layout.ComponentBounds[ComponentIndex];
+            Layout.MoveComponent(ComponentIndex, FVector2D(Origin.X - Bounds.Min.X, Top - Bounds.Min.Y));
+            Top = Layout.ComponentBounds[ComponentIndex].Max.Y + VerticalSpacing * 3.0;
+        }
+    }
+    else
+    {
+        TArray<FBox2D> Obstacles;
+        TMap<const UEdGraphNode*, FBox2D> FixedBoxes;
+        FBox2D FixedBounds(ForceInit);
+        for (const UEdGraphNode* Node : FixedNodes)
+        {
+            const FVector2D Position(Node->NodePosX, Node->NodePosY);
+            const FBox2D Box(Position, Position + EstimateNodeSize(Node));
+            FixedBoxes.Add(Node, Box);
+            Obstacles.Add(Box);
+            FixedBounds += Box;
+        }
+
+        for (int32 ComponentIndex = 0; ComponentIndex < Layout.Components.Num(); ++ComponentIndex)
+        {
+            // Attach after the exec source that stays; otherwise next to any linked node that stays
+            // (right of a source, left of a consumer); unlinked components go below the graph
+            TOptional<FVector2D> Delta;
+            for (int32 Pass = 0; Pass < 2 && !Delta.IsSet(); ++Pass)
+            {
+                Layout.ForEachComponentNode(ComponentIndex, [&](int32 Index)
+                {
+                    const FLayoutNode& Item = Layout.Nodes[Index];
+                    for (const UEdGraphPin* Pin : Item.Node->Pins)
+                    {
+                        if (Delta.IsSet()) return;
+                        if (!Pin) continue;
+                        if (Pass == 0 && (Pin->Direction != EGPD_Input || Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec))
+                        {
+                            continue;
+                        }
+                        for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+                        {
+                            const FBox2D* Box = LinkedPin ? FixedBoxes.Find(LinkedPin->GetOwningNode()) : nullptr;
+                            if (Box)
+                            {
+                                Delta = Pin->Direction == EGPD_Input
+                                    ? FVector2D(Box->Max.X + HorizontalSpacing - Item.Position.X, Box->Min.Y - Item.Position.Y)
+                                    : FVector2D(Box->Min.X - HorizontalSpacing - Item.Size.X - Item.Position.X, Box->Min.Y - Item.Position.Y);
+                                break;
+                            }
+                        }
+                    }
+                });
+            }
+            const FBox2D& Bounds = Layout.ComponentBounds[ComponentIndex];
+            if (!Delta.IsSet())
+            {
+                Delta = FixedBounds.bIsValid
+                    ? FVector2D(FixedBounds.Min.X - Bounds.Min.X, FixedBounds.Max.Y + VerticalSpacing * 3.0 - Bounds.Min.Y)
+                    : -Bounds.Min;
+            }
+            Layout.MoveComponent(ComponentIndex, Delta.GetValue());
+
+            // Push down past every overlapped box; each push clears that box for good, so this ends
+            bool bMoved = true;
+            while (bMoved)
+            {
+                bMoved = false;
+                for (const FBox2D& Obstacle : Obstacles)
+                {
+                    const FBox2D& Box = Layout.ComponentBounds[ComponentIndex];
+                    if (BoxesOverlap(Box.ExpandBy(VerticalSpacing * 0.5), Obstacle))
+                    {
+                        Layout.MoveComponent(ComponentIndex, FVector2D(0.0, Obstacle.Max.Y + VerticalSpacing - Box.Min.Y));
+                        bMoved = true;
+                    }
+                }
+            }
+            Obstacles.Add(Layout.ComponentBounds[ComponentIndex]);
+        }
+    }
+
+    int32 MovedCount = 0;
+    int32 DataNodeCount = 0;
+    FBox2D LayoutBounds(ForceInit);
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("SpirrowBridge", "AutoLayoutBlueprintGraph", "Auto Layout Blueprint Graph"));
+        Graph->Modify();
+
+        for (const FLayoutNode& Item : Layout.Nodes)
+        {
+            // Snap to the editor's 16-unit grid
+            const int32 PosX = FMath::RoundToInt(FMath::GridSnap(Item.Position.X, 16.0));
+            const int32 PosY = FMath::RoundToInt(FMath::GridSnap(Item.Position.Y, 16.0));
+            DataNodeCount += Item.bCell ? 0 : 1;
+            LayoutBounds += FVector2D(PosX, PosY);
+            LayoutBounds += FVector2D(PosX, PosY) + Item.Size;
+            if (Item.Node->NodePosX != PosX || Item.Node->NodePosY != PosY)
+            {
+                Item.Node->Modify();
+                Item.Node->NodePosX = PosX;
+                Item.Node->NodePosY = PosY;
+                ++MovedCount;
+            }
+        }
+    }
+
+    if (MovedCount > 0)
+    {
+        Graph->NotifyGraphChanged();
+        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("blueprint"), Blueprint->GetName());
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetStringField(TEXT("mode"), bPartial ? TEXT("selected") : TEXT("all"));
+    ResultObj->SetNumberField(TEXT("nodes_laid_out"), Layout.Nodes.Num());
+    ResultObj->SetNumberField(TEXT("nodes_moved"), MovedCount);
+    ResultObj->SetNumberField(TEXT("data_nodes"), DataNodeCount);
+    ResultObj->SetNumberField(TEXT("components"), Layout.Components.Num());
+    ResultObj->SetNumberField(TEXT("layers"), Layout.LayerCount);
+    ResultObj->SetNumberField(TEXT("comments_skipped"), CommentCount);
+    if (LayoutBounds.bIsValid)
+    {
+        TSharedPtr<FJsonObject> BoundsObj = MakeShared<FJsonObject>();
+        BoundsObj->SetNumberField(TEXT("x"), LayoutBounds.Min.X);
+        BoundsObj->SetNumberField(TEXT("y"), LayoutBounds.Min.Y);
+        BoundsObj->SetNumberField(TEXT("width"), LayoutBounds.GetSize().X);
+        BoundsObj->SetNumberField(TEXT("height"), LayoutBounds.GetSize().Y);
+        ResultObj->SetObjectField(TEXT("bounds"), BoundsObj);
+    }
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return ResultObj;
+}
@@ -0,0 +1,1082 @@
+#include "Commands/SpirrowBridgeBlueprintPerformanceCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeClassIndex.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_Event.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_SpawnActorFromClass.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Character.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Misc/PackageName.h"
+
+namespace
+{
+    enum class EPerfSeverity : uint8
+    {
+        Info,
+        Warning,
+        Error
+    };
+
+    const TCHAR* SeverityToString(EPerfSeverity Severity)
+    {
+        switch (Severity)
+        {
+        case EPerfSeverity::Error:   return TEXT("error");
+        case EPerfSeverity::Warning: return TEXT("warning");
+        default:                     return TEXT("info");
+        }
+    }
+
+    struct FPerfFinding
+    {
+        FString Rule;
+        EPerfSeverity Severity = EPerfSeverity::Info;
+        FString Message;
+        FString Graph;
+        FGuid NodeGuid;
+        FString Component;
+    };
+
+    struct FTickEstimate
+    {
+        FString Event;
+        FString Graph;
+        FGuid NodeGuid;
+        int32 NodeCount = 0;
+        int32 LoopCount = 0;
+        int32 ExpandedGraphs = 0;
+    };
+
+    struct FBlueprintPerfReport
+    {
+        TArray<FPerfFinding> Findings;
+        TArray<FTickEstimate> TickEvents;
+        bool bActorCanEverTick = false;
+        int32 TickingComponents = 0;
+    };
+
+    /** Inputs of one analysis task, gathered on the game thread */
+    struct FBlueprintPerfWork
+    {
+        UBlueprint* Blueprint = nullptr;
+        const UObject* DefaultObject = nullptr;
+    };
+
+    /** Per-frame events; Actor and ActorComponent use ReceiveTick, UserWidget Tick, AnimInstance BlueprintUpdateAnimation */
+    bool IsTickEventName(FName EventName)
+    {
+        static const FName ReceiveTickName(TEXT("ReceiveTick"));
+        static const FName WidgetTickName(TEXT("Tick"));
+        static const FName AnimUpdateName(TEXT("BlueprintUpdateAnimation"));
+        return EventName == ReceiveTickName || EventName == WidgetTickName || EventName == AnimUpdateName;
+    }
+
+    /** Calls that walk every actor, widget or component */
+    bool IsExpensiveCall(FName FunctionName)
+    {
+        static const TSet<FName> ExpensiveFunctions = {
+            TEXT("GetAllActorsOfClass"), TEXT("GetAllActorsOfClassWithTag"), TEXT("GetAllActorsWithTag"),
+            TEXT("GetAllActorsWithInterface"), TEXT("GetActorOfClass"), TEXT("GetAllWidgetsOfClass"),
+            TEXT("GetAllWidgetsWithInterface"), TEXT("GetComponentsByClass"), TEXT("GetComponentsByTag"),
+            TEXT("GetComponentsByInterface")
+        };
+        return ExpensiveFunctions.Contains(FunctionName);
+    }
+
+    bool IsLoopMacro(const UK2Node_MacroInstance* MacroNode)
+    {
+        static const TSet<FName> LoopMacros = {
+            TEXT("ForLoop"), TEXT("ForLoopWithBreak"), TEXT("ForEachLoop"), TEXT("ForEachLoopWithBreak"),
+            TEXT("ReverseForEachLoop"), TEXT("WhileLoop")
+        };
+        const UEdGraph* MacroGraph = MacroNode->GetMacroGraph();
+        return MacroGraph && LoopMacros.Contains(MacroGraph->GetFName());
+    }
+
+    bool IsExecPin(const UEdGraphPin* Pin)
+    {
+        return Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+    }
+
+    /** Pure nodes run again for every impure node that reads them */
+    bool IsPureNode(const UEdGraphNode* Node)
+    {
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin && IsExecPin(Pin))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** First native class in the hierarchy */
+    const UClass* GetNativeBase(const UClass* Class)
+    {
+        while (Class && !Class->HasAnyClassFlags(CLASS_Native))
+        {
+            Class = Class->GetSuperClass();
+        }
+        return Class;
+    }
+
+    /** ReceiveTick implemented by this class or a Blueprint parent */
+    bool ImplementsBlueprintTick(const UClass* Class)
+    {
+        const UFunction* TickFunction = Class ? Class->FindFunctionByName(TEXT("ReceiveTick")) : nullptr;
+        return TickFunction && !TickFunction->GetOwnerClass()->HasAnyClassFlags(CLASS_Native);
+    }
+
+    /** Component class that can only tick through a Blueprint Tick (engine base) and has none */
+    bool HasUnusedComponentTick(const UClass* ComponentClass)
+    {
+        const UClass* NativeBase = GetNativeBase(ComponentClass);
+        const bool bQuietBase = NativeBase == UActorComponent::StaticClass() || NativeBase == USceneComponent::StaticClass();
+        return bQuietBase && !ImplementsBlueprintTick(ComponentClass);
+    }
+
+    /**
+     * Nodes executed when a pin or node fires: exec successors, the pure nodes feeding them, and the
+     * bodies of this Blueprint's own functions and macros they call (each expanded once).
+     * Reads graph data only (pins, links, member names), so it runs on worker threads.
+     */
+    class FExecutionWalker
+    {
+    public:
+        explicit FExecutionWalker(const UBlueprint* InBlueprint)
+            : Blueprint(InBlueprint)
+        {
+        }
+
+        TSet<const UEdGraphNode*> Nodes;
+        TArray<const UK2Node_MacroInstance*> Loops;
+        int32 ExpandedGraphs = 0;
+
+        void WalkFromNode(const UEdGraphNode* Start)
+        {
+            Visit(Start);
+            Drain();
+        }
+
+        void WalkFromPin(const UEdGraphPin* ExecPin)
+        {
+            for (const UEdGraphPin* LinkedPin : ExecPin->LinkedTo)
+            {
+                Visit(LinkedPin ? LinkedPin->GetOwningNode() : nullptr);
+            }
+            Drain();
+        }
+
+    private:
+        const UBlueprint* Blueprint;
+        TArray<const UEdGraphNode*> Stack;
+        TSet<const UEdGraph*> Expanded;
+
+        void Visit(const UEdGraphNode* Node)
+        {
+            if (!Node)
+            {
+                return;
+            }
+            bool bAlreadyVisited = false;
+            Nodes.Add(Node, &bAlreadyVisited);
+            if (!bAlreadyVisited)
+            {
+                Stack.Push(Node);
+            }
+        }
+
+        void Expand(const UEdGraph* Graph)
+        {
+            if (!Graph || Expanded.Contains(Graph))
+            {
+                return;
+            }
+            Expanded.Add(Graph);
+            ++ExpandedGraphs;
+
+            for (const UEdGraphNode* Node : Graph->Nodes)
+            {
+                if (Cast<UK2Node_FunctionEntry>(Node))
+                {
+                    Visit(Node);
+                    return;
+                }
+            }
+            // Macros have no function entry; count their whole body
+            for (const UEdGraphNode* Node : Graph->Nodes)
+            {
+                Visit(Node);
+            }
+        }
+
+        void Drain()
+        {
+            while (Stack.Num() > 0)
+            {
+                const UEdGraphNode* Node = Stack.Pop(EAllowShrinking::No);
+                for (const UEdGraphPin* Pin : Node->Pins)
+                {
+                    if (!Pin) continue;
+
+                    const bool bExec = IsExecPin(Pin);
+                    for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+                    {
+                        const UEdGraphNode* LinkedNode = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+                        if (!LinkedNode) continue;
+
+                        if (bExec && Pin->Direction == EGPD_Output)
+                        {
+                            Visit(LinkedNode);
+                        }
+                        else if (!bExec && Pin->Direction == EGPD_Input && IsPureNode(LinkedNode))
+                        {
+                            Visit(LinkedNode);
+                        }
+                    }
+                }
+
+                if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+                {
+                    if (CallNode->FunctionReference.IsSelfContext())
+                    {
+                        const FName MemberName = CallNode->FunctionReference.GetMemberName();
+                        for (const UEdGraph* FunctionGraph : Blueprint->FunctionGraphs)
+                        {
+                            if (FunctionGraph && FunctionGraph->GetFName() == MemberName)
+                            {
+                                Expand(FunctionGraph);
+                                break;
+                            }
+                        }
+                    }
+                }
+                else if (const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+                {
+                    if (IsLoopMacro(MacroNode))
+                    {
+                        Loops.Add(MacroNode);
+                    }
+                    else if (Blueprint->MacroGraphs.Contains(MacroNode->GetMacroGraph()))
+                    {
+                        Expand(MacroNode->GetMacroGraph());
+                    }
+                }
+            }
+        }
+    };
+
+    void AddFinding(FBlueprintPerfReport& Report, const TCHAR* Rule, EPerfSeverity Severity, FString Message,
+        const UEdGraphNode* Node = nullptr, const FString& Component = FString())
+    {
+        FPerfFinding& Finding = Report.Findings.AddDefaulted_GetRef();
+        Finding.Rule = Rule;
+        Finding.Severity = Severity;
+        Finding.Message = MoveTemp(Message);
+        Finding.Component = Component;
+        if (Node)
+        {
+            Finding.NodeGuid = Node->NodeGuid;
+            Finding.Graph = Node->GetGraph() ? Node->GetGraph()->GetName() : FString();
+        }
+    }
+
+    /** Expensive nodes in a hot set; "where" reads "in tick", "in a loop body" or "in a loop in tick" */
+    void CheckHotNodes(FBlueprintPerfReport& Report, const TSet<const UEdGraphNode*>& HotNodes, bool bInTick, bool bInLoop,
+        TSet<TPair<const UEdGraphNode*, FString>>& Reported)
+    {
+        const TCHAR* Where = bInTick && bInLoop ? TEXT("in a loop in tick") : (bInTick ? TEXT("in tick") : TEXT("in a loop body"));
+        for (const UEdGraphNode* Node : HotNodes)
+        {
+            const TCHAR* Rule = nullptr;
+            EPerfSeverity Severity = EPerfSeverity::Info;
+            FString Message;
+
+            if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+            {
+                const FName FunctionName = CallNode->FunctionReference.GetMemberName();
+                if (IsExpensiveCall(FunctionName))
+                {
+                    Rule = TEXT("expensive_call");
+                    Severity = bInTick ? EPerfSeverity::Error : EPerfSeverity::Warning;
+                    Message = FString::Printf(TEXT("%s %s iterates every object of the type; cache the result"), *FunctionName.ToString(), Where);
+                }
+            }
+            else if (const UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(Node))
+            {
+                Rule = TEXT("cast_in_hot_path");
+                Severity = bInTick ? EPerfSeverity::Warning : EPerfSeverity::Info;
+                Message = FString::Printf(TEXT("Cast to %s %s; cast once and store the reference"),
+                    CastNode->TargetType ? *CastNode->TargetType->GetName() : TEXT("?"), Where);
+            }
+            else if (Cast<UK2Node_SpawnActorFromClass>(Node))
+            {
+                Rule = TEXT("spawn_in_hot_path");
+                Severity = bInTick ? EPerfSeverity::Error : EPerfSeverity::Warning;
+                Message = FString::Printf(TEXT("SpawnActor %s; pool or spawn on events"), Where);
+            }
+            else if (const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+            {
+                if (bInTick && !bInLoop && IsLoopMacro(MacroNode))
+                {
+                    Rule = TEXT("loop_in_tick");
+                    Severity = EPerfSeverity::Warning;
+                    Message = FString::Printf(TEXT("%s runs every frame"), *MacroNode->GetMacroGraph()->GetName());
+                }
+            }
+
+            // The same node can be reached from several hot paths; keep the first (tick paths run first)
+            if (Rule && !Reported.Contains(TPair<const UEdGraphNode*, FString>(Node, Rule)))
+            {
+                Reported.Add(TPair<const UEdGraphNode*, FString>(Node, Rule));
+                AddFinding(Report, Rule, Severity, MoveTemp(Message), Node);
+            }
+        }
+    }
+
+    void AnalyzeBlueprint(const FBlueprintPerfWork& Work, FBlueprintPerfReport& Report)
+    {
+        const UBlueprint* Blueprint = Work.Blueprint;
+        TSet<TPair<const UEdGraphNode*, FString>> Reported;
+        TSet<const UK2Node_MacroInstance*> LoopsInTick;
+
+        // === Per-frame events ===
+        bool bHasTickEvent = false;
+        for (const UEdGraph* Graph : Blueprint->UbergraphPages)
+        {
+            if (!Graph) continue;
+            for (const UEdGraphNode* Node : Graph->Nodes)
+            {
+                const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+                if (!EventNode || !IsTickEventName(EventNode->GetFunctionName()))
+                {
+                    continue;
+                }
+                bHasTickEvent = true;
+
+                const UEdGraphPin* ThenPin = EventNode->FindPin(UEdGraphSchema_K2::PN_Then);
+                if (!ThenPin || ThenPin->LinkedTo.Num() == 0)
+                {
+                    AddFinding(Report, TEXT("empty_tick"), EPerfSeverity::Info,
+                        FString::Printf(TEXT("%s has nothing connected; delete it"), *EventNode->GetFunctionName().ToString()), EventNode);
+                    continue;
+                }
+
+                FExecutionWalker Walker(Blueprint);
+                Walker.WalkFromNode(EventNode);
+
+                FTickEstimate& Estimate = Report.TickEvents.AddDefaulted_GetRef();
+                Estimate.Event = EventNode->GetFunctionName().ToString();
+                Estimate.Graph = Graph->GetName();
+                Estimate.NodeGuid = EventNode->NodeGuid;
+                Estimate.NodeCount = Walker.Nodes.Num();
+                Estimate.LoopCount = Walker.Loops.Num();
+                Estimate.ExpandedGraphs = Walker.ExpandedGraphs;
+
+                AddFinding(Report, TEXT("event_tick"), EPerfSeverity::Warning,
+                    FString::Printf(TEXT("%s runs %d nodes every frame%s; prefer timers or events where the logic is not per-frame"),
+                        *Estimate.Event, Estimate.NodeCount, Estimate.LoopCount > 0 ? TEXT(" (loop bodies counted once)") : TEXT("")),
+                    EventNode);
+
+                CheckHotNodes(Report, Walker.Nodes, true, false, Reported);
+                for (const UK2Node_MacroInstance* LoopNode : Walker.Loops)
+                {
+                    LoopsInTick.Add(LoopNode);
+                }
+            }
+        }
+
+        // === Loop bodies anywhere ===
+        TArray<UEdGraph*> Graphs;
+        Blueprint->GetAllGraphs(Graphs);
+        for (const UEdGraph* Graph : Graphs)
+        {
+            if (!Graph) continue;
+            for (const UEdGraphNode* Node : Graph->Nodes)
+            {
+                const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node);
+                if (!MacroNode || !IsLoopMacro(MacroNode))
+                {
+                    continue;
+                }
+                for (const UEdGraphPin* Pin : MacroNode->Pins)
+                {
+                    // LoopBody is the exec output that fires per iteration
+                    if (Pin && Pin->Direction == EGPD_Output && IsExecPin(Pin) && Pin->PinName == TEXT("LoopBody"))
+                    {
+                        FExecutionWalker Walker(Blueprint);
+                        Walker.WalkFromPin(Pin);
+                        CheckHotNodes(Report, Walker.Nodes, LoopsInTick.Contains(MacroNode), true, Reported);
+                    }
+                }
+            }
+        }
+
+        // === Tick flags without a tick ===
+        const UClass* GeneratedClass = Blueprint->GeneratedClass;
+        if (const AActor* ActorCDO = Cast<AActor>(Work.DefaultObject))
+        {
+            Report.bActorCanEverTick = ActorCDO->PrimaryActorTick.bCanEverTick;
+
+            // Engine bases with no per-frame work of their own; project C++ parents may override Tick
+            const UClass* NativeBase = GetNativeBase(GeneratedClass);
+            const bool bQuietBase = NativeBase == AActor::StaticClass() || NativeBase == APawn::StaticClass() || NativeBase == ACharacter::StaticClass();
+            if (Report.bActorCanEverTick && bQuietBase && !bHasTickEvent && !ImplementsBlueprintTick(GeneratedClass))
+            {
+                AddFinding(Report, TEXT("actor_tick_unused"),
+                    ActorCDO->PrimaryActorTick.bStartWithTickEnabled ? EPerfSeverity::Warning : EPerfSeverity::Info,
+                    TEXT("Actor can tick but implements no Tick; turn off Can Ever Tick"));
+            }
+        }
+        else if (const UActorComponent* ComponentCDO = Cast<UActorComponent>(Work.DefaultObject))
+        {
+            if (ComponentCDO->PrimaryComponentTick.bCanEverTick && !bHasTickEvent && HasUnusedComponentTick(GeneratedClass))
+            {
+                AddFinding(Report, TEXT("component_tick_unused"), EPerfSeverity::Warning,
+                    TEXT("Component class can tick but implements no Tick; turn off Can Ever Tick"));
+            }
+        }
+
+        if (const USimpleConstructionScript* SCS = Blueprint->SimpleConstructionScript)
+        {
+            for (const USCS_Node* SCSNode : SCS->GetAllNodes())
+            {
+                const UActorComponent* Template = SCSNode ? SCSNode->ComponentTemplate : nullptr;
+                if (!Template || !Template->PrimaryComponentTick.bCanEverTick)
+                {
+                    continue;
+                }
+                ++Report.TickingComponents;
+
+                const UClass* ComponentClass = Template->GetClass();
+                if (HasUnusedComponentTick(ComponentClass))
+                {
+                    AddFinding(Report, TEXT("component_tick_unused"),
+                        Template->PrimaryComponentTick.bStartWithTickEnabled ? EPerfSeverity::Warning : EPerfSeverity::Info,
+                        FString::Printf(TEXT("%s (%s) can tick but never does; turn off Can Ever Tick"),
+                            *SCSNode->GetVariableName().ToString(), *ComponentClass->GetName()),
+                        nullptr, SCSNode->GetVariableName().ToString());
+                }
+            }
+        }
+    }
+
+    bool ParseSeverity(const FString& Value, EPerfSeverity& OutSeverity)
+    {
+        if (Value.Equals(TEXT("info"), ESearchCase::IgnoreCase))    { OutSeverity = EPerfSeverity::Info; return true; }
+        if (Value.Equals(TEXT("warning"), ESearchCase::IgnoreCase)) { OutSeverity = EPerfSeverity::Warning; return true; }
+        if (Value.Equals(TEXT("error"), ESearchCase::IgnoreCase))   { OutSeverity = EPerfSeverity::Error; return true; }
+        return false;
+    }
+
+    /** Tick settings of set_tick_policy_batch; unset fields are left alone */
+    struct FTickPolicy
+    {
+        TOptional<bool> bCanEverTick;
+        TOptional<bool> bStartWithTickEnabled;
+        TOptional<float> TickInterval;
+        TOptional<ETickingGroup> TickGroup;
+
+        bool IsEmpty() const
+        {
+            return !bCanEverTick.IsSet() && !bStartWithTickEnabled.IsSet() && !TickInterval.IsSet() && !TickGroup.IsSet();
+        }
+    };
+
+    /** Parse {"enabled", "start_enabled", "interval", "tick_group"}; tick groups are accepted with or without the TG_ prefix */
+    bool ParseTickPolicy(const TSharedPtr<FJsonObject>& PolicyObj, FTickPolicy& OutPolicy, FString& OutError)
+    {
+        bool bValue;
+        if (PolicyObj->TryGetBoolField(TEXT("enabled"), bValue))
+        {
+            OutPolicy.bCanEverTick = bValue;
+        }
+        if (PolicyObj->TryGetBoolField(TEXT("start_enabled"), bValue))
+        {
+            OutPolicy.bStartWithTickEnabled = bValue;
+        }
+
+        double Interval;
+        if (PolicyObj->TryGetNumberField(TEXT("interval"), Interval))
+        {
+            if (Interval < 0.0)
+            {
+                OutError = FString::Printf(TEXT("interval must be >= 0 (got %g)"), Interval);
+                return false;
+            }
+            OutPolicy.TickInterval = static_cast<float>(Interval);
+        }
+
+        FString GroupName;
+        if (PolicyObj->TryGetStringField(TEXT("tick_group"), GroupName))
+        {
+            const UEnum* GroupEnum = StaticEnum<ETickingGroup>();
+            int64 Value = GroupEnum->GetValueByNameString(GroupName);
+            if (Value == INDEX_NONE)
+            {
+                Value = GroupEnum->GetValueByNameString(TEXT("TG_") + GroupName);
+            }
+            if (Value == INDEX_NONE)
+            {
+                OutError = FString::Printf(TEXT("Unknown tick_group '%s' (expected PrePhysics, StartPhysics, DuringPhysics, EndPhysics, PostPhysics, PostUpdateWork or LastDemotable)"), *GroupName);
+                return false;
+            }
+            OutPolicy.TickGroup = static_cast<ETickingGroup>(Value);
+        }
+        return true;
+    }
+
+    /** Apply a policy to a tick function; returns the names of the fields that changed */
+    TArray<FString> ApplyTickPolicy(const FTickPolicy& Policy, FTickFunction& TickFunction, bool bWrite)
+    {
+        TArray<FString> Changed;
+        if (Policy.bCanEverTick.IsSet() && TickFunction.bCanEverTick != Policy.bCanEverTick.GetValue())
+        {
+            Changed.Add(TEXT("enabled"));
+            if (bWrite) TickFunction.bCanEverTick = Policy.bCanEverTick.GetValue();
+        }
+        if (Policy.bStartWithTickEnabled.IsSet() && TickFunction.bStartWithTickEnabled != Policy.bStartWithTickEnabled.GetValue())
+        {
+            Changed.Add(TEXT("start_enabled"));
+            if (bWrite) TickFunction.bStartWithTickEnabled = Policy.bStartWithTickEnabled.GetValue();
+        }
+        if (Policy.TickInterval.IsSet() && !FMath::IsNearlyEqual(TickFunction.TickInterval, Policy.TickInterval.GetValue()))
+        {
+            Changed.Add(TEXT("interval"));
+            if (bWrite) TickFunction.TickInterval = Policy.TickInterval.GetValue();
+        }
+        if (Policy.TickGroup.IsSet() && TickFunction.TickGroup != Policy.TickGroup.GetValue())
+        {
+            Changed.Add(TEXT("tick_group"));
+            if (bWrite) TickFunction.TickGroup = Policy.TickGroup.GetValue();
+        }
+        return Changed;
+    }
+
+    /** How many of the selected actors / components can tick and start ticking */
+    struct FTickCounts
+    {
+        int32 ActorsCanEverTick = 0;
+        int32 ActorsStartEnabled = 0;
+        int32 ComponentsCanEverTick = 0;
+        int32 ComponentsStartEnabled = 0;
+
+        /** Count a tick function, as it is or as it will be once Policy is applied */
+        void AddActor(const FTickFunction& TickFunction, const FTickPolicy* Policy = nullptr)
+        {
+            Add(TickFunction, Policy, ActorsCanEverTick, ActorsStartEnabled);
+        }
+
+        void AddComponent(const FTickFunction& TickFunction, const FTickPolicy* Policy = nullptr)
+        {
+            Add(TickFunction, Policy, ComponentsCanEverTick, ComponentsStartEnabled);
+        }
+
+        TSharedPtr<FJsonObject> ToJson() const
+        {
+            TSharedPtr<FJsonObject> CountsObj = MakeShared<FJsonObject>();
+            CountsObj->SetNumberField(TEXT("actors_can_ever_tick"), ActorsCanEverTick);
+            CountsObj->SetNumberField(TEXT("actors_start_enabled"), ActorsStartEnabled);
+            CountsObj->SetNumberField(TEXT("components_can_ever_tick"), ComponentsCanEverTick);
+            CountsObj->SetNumberField(TEXT("components_start_enabled"), ComponentsStartEnabled);
+            return CountsObj;
+        }
+
+    private:
+        static void Add(const FTickFunction& TickFunction, const FTickPolicy* Policy, int32& CanEverTick, int32& StartEnabled)
+        {
+            const bool bCanEverTick = Policy && Policy->bCanEverTick.IsSet() ? Policy->bCanEverTick.GetValue() : TickFunction.bCanEverTick;
+            const bool bStartEnabled = Policy && Policy->bStartWithTickEnabled.IsSet() ? Policy->bStartWithTickEnabled.GetValue() : TickFunction.bStartWithTickEnabled;
+            CanEverTick += bCanEverTick ? 1 : 0;
+            StartEnabled += bCanEverTick && bStartEnabled ? 1 : 0;
+        }
+    };
+
+    TSharedPtr<FJsonValue> MakeChangeJson(const FString& Target, const TArray<FString>& Fields)
+    {
+        TArray<TSharedPtr<FJsonValue>> FieldArray;
+        for (const FString& Field : Fields)
+        {
+            FieldArray.Add(MakeShared<FJsonValueString>(Field));
+        }
+        TSharedPtr<FJsonObject> ChangeObj = MakeShared<FJsonObject>();
+        ChangeObj->SetStringField(TEXT("target"), Target);
+        ChangeObj->SetArrayField(TEXT("changed"), FieldArray);
+        return MakeShared<FJsonValueObject>(ChangeObj);
+    }
+}
+
+FSpirrowBridgeBlueprintPerformanceCommands::FSpirrowBridgeBlueprintPerformanceCommands()
+{
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPerformanceCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("analyze_blueprint_performance"))
+    {
+        return HandleAnalyzeBlueprintPerformance(Params);
+    }
+    else if (CommandType == TEXT("set_tick_policy_batch"))
+    {
+        return HandleSetTickPolicyBatch(Params);
+    }
+
+    return nullptr;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPerformanceCommands::CollectBlueprints(const TSharedPtr<FJsonObject>& Params,
+    TArray<UBlueprint*>& OutBlueprints, TArray<TSharedPtr<FJsonValue>>& OutNotFound)
+{
+    FString BlueprintName, Path, Folder, ParentClassName;
+    Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName);
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Blueprints"));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("folder"), Folder, TEXT(""));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("parent_class"), ParentClassName, TEXT(""));
+    bool bRecursive;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("recursive"), bRecursive, true);
+
+    const TArray<TSharedPtr<FJsonValue>>* BlueprintNames = nullptr;
+    Params->TryGetArrayField(TEXT("blueprints"), BlueprintNames);
+
+    if (BlueprintName.IsEmpty() && !BlueprintNames && Folder.IsEmpty() && ParentClassName.IsEmpty())
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("Specify 'blueprint_name', 'blueprints', 'folder' or 'parent_class'"));
+    }
+
+    // Single Blueprint: a missing one is an error, as in every single-Blueprint command
+    if (!BlueprintName.IsEmpty())
+    {
+        UBlueprint* Blueprint = nullptr;
+        if (auto Error = FSpirrowBridgeCommonUtils::ValidateBlueprint(BlueprintName, Path, Blueprint))
+        {
+            return Error;
+        }
+        OutBlueprints.AddUnique(Blueprint);
+    }
+
+    // Explicit list: short names resolve under path, entries starting with '/' are object paths
+    if (BlueprintNames)
+    {
+        for (const TSharedPtr<FJsonValue>& NameValue : *BlueprintNames)
+        {
+            const FString Name = NameValue->AsString();
+            UBlueprint* Blueprint = nullptr;
+            if (Name.StartsWith(TEXT("/")))
+            {
+                FString ObjectPath = Name;
+                if (!ObjectPath.Contains(TEXT(".")))
+                {
+                    ObjectPath += TEXT(".") + FPackageName::GetShortName(ObjectPath);
+                }
+                Blueprint = LoadObject<UBlueprint>(nullptr, *ObjectPath);
+            }
+            else
+            {
+                Blueprint = FSpirrowBridgeCommonUtils::FindBlueprintByName(Name, Path);
+            }
+
+            if (Blueprint)
+            {
+                OutBlueprints.AddUnique(Blueprint);
+            }
+            else
+            {
+                OutNotFound.Add(MakeShared<FJsonValueString>(Name));
+            }
+        }
+    }
+
+    // Query: Blueprints under a folder, optionally derived from a parent class
+    if (!Folder.IsEmpty() || !ParentClassName.IsEmpty())
+    {
+        TSet<FString> DerivedBlueprints;
+        if (!ParentClassName.IsEmpty())
+        {
+            FSpirrowBridgeClassIndex& ClassIndex = FSpirrowBridgeClassIndex::Get();
+            UClass* ParentClass = ClassIndex.FindClass(ParentClassName);
+            if (!ParentClass)
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::ClassNotFound,
+                    FString::Printf(TEXT("Parent class not found: %s"), *ParentClassName));
+            }
+
+            // Blueprint ancestry comes from registry tags, so unrelated Blueprints are never loaded
+            const FTopLevelAssetPath ParentPath = ParentClass->GetClassPathName();
+            for (const FSpirrowBlueprintClassRecord& Record : ClassIndex.GetBlueprintClassRecords())
+            {
+                if (Record.AncestorPaths.Contains(ParentPath))
+                {
+                    DerivedBlueprints.Add(Record.ObjectPath);
+                }
+            }
+        }
+
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        FARFilter Filter;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        Filter.bRecursiveClasses = true;
+        Filter.PackagePaths.Add(FName(*(Folder.IsEmpty() ? FString(TEXT("/Game")) : Folder)));
+        Filter.bRecursivePaths = bRecursive;
+
+        TArray<FAssetData> AssetDataList;
+        AssetRegistry.GetAssets(Filter, AssetDataList);
+        for (const FAssetData& AssetData : AssetDataList)
+        {
+            if (!ParentClassName.IsEmpty() && !DerivedBlueprints.Contains(AssetData.GetObjectPathString()))
+            {
+                continue;
+            }
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset()))
+            {
+                OutBlueprints.AddUnique(Blueprint);
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPerformanceCommands::HandleAnalyzeBlueprintPerformance(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    FString MinSeverityName;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("min_severity"), MinSeverityName, TEXT("info"));
+    EPerfSeverity MinSeverity;
+    if (!ParseSeverity(MinSeverityName, MinSeverity))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            FString::Printf(TEXT("Invalid min_severity '%s' (expected info, warning or error)"), *MinSeverityName));
+    }
+
+    bool bIncludeClean, bParallel;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_clean"), bIncludeClean, false);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("parallel"), bParallel, true);
+
+    TArray<UBlueprint*> Blueprints;
+    TArray<TSharedPtr<FJsonValue>> NotFoundArray;
+    if (auto Error = CollectBlueprints(Params, Blueprints, NotFoundArray))
+    {
+        return Error;
+    }
+
+    // Loading and default object creation stay on the game thread
+    TArray<FBlueprintPerfWork> Work;
+    Work.Reserve(Blueprints.Num());
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        FBlueprintPerfWork& Item = Work.AddDefaulted_GetRef();
+        Item.Blueprint = Blueprint;
+        FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
+        Item.DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+    }
+
+    // Read-only graph walks: every task writes its own report, and the game thread is blocked
+    // inside ParallelFor so no graph can be edited or garbage collected meanwhile.
+    TArray<FBlueprintPerfReport> Reports;
+    Reports.SetNum(Work.Num());
+    ParallelFor(Work.Num(), [&Work, &Reports](int32 Index)
+    {
+        AnalyzeBlueprint(Work[Index], Reports[Index]);
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    TArray<TSharedPtr<FJsonValue>> BlueprintArray;
+    int32 SeverityCounts[3] = { 0, 0, 0 };
+    int32 TickingActors = 0;
+    int32 TickingComponents = 0;
+    int32 CleanCount = 0;
+    for (int32 Index = 0; Index < Work.Num(); ++Index)
+    {
+        const UBlueprint* Blueprint = Work[Index].Blueprint;
+        const FBlueprintPerfReport& Report = Reports[Index];
+        TickingActors += Report.bActorCanEverTick ? 1 : 0;
+        TickingComponents += Report.TickingComponents;
+
+        TArray<TSharedPtr<FJsonValue>> FindingArray;
+        for (const FPerfFinding& Finding : Report.Findings)
+        {
+            if (Finding.Severity < MinSeverity)
+            {
+                continue;
+            }
+            ++SeverityCounts[static_cast<int32>(Finding.Severity)];
+
+            TSharedPtr<FJsonObject> FindingObj = MakeShared<FJsonObject>();
+            FindingObj->SetStringField(TEXT("rule"), Finding.Rule);
+            FindingObj->SetStringField(TEXT("severity"), SeverityToString(Finding.Severity));
+            FindingObj->SetStringField(TEXT("message"), Finding.Message);
+            if (Finding.NodeGuid.IsValid())
+            {
+                FindingObj->SetStringField(TEXT("graph"), Finding.Graph);
+                FindingObj->SetStringField(TEXT("node_id"), Finding.NodeGuid.ToString());
+            }
+            if (!Finding.Component.IsEmpty())
+            {
+                FindingObj->SetStringField(TEXT("component"), Finding.Component);
+            }
+            FindingArray.Add(MakeShared<FJsonValueObject>(FindingObj));
+        }
+
+        if (FindingArray.Num() == 0)
+        {
+            ++CleanCount;
+            if (!bIncludeClean)
+            {
+                continue;
+            }
+        }
+
+        TArray<TSharedPtr<FJsonValue>> TickArray;
+        for (const FTickEstimate& Estimate : Report.TickEvents)
+        {
+            TSharedPtr<FJsonObject> TickObj = MakeShared<FJsonObject>();
+            TickObj->SetStringField(TEXT("event"), Estimate.Event);
+            TickObj->SetStringField(TEXT("graph"), Estimate.Graph);
+            TickObj->SetStringField(TEXT("node_id"), Estimate.NodeGuid.ToString());
+            TickObj->SetNumberField(TEXT("per_tick_nodes"), Estimate.NodeCount);
+            TickObj->SetNumberField(TEXT("loops"), Estimate.LoopCount);
+            TickObj->SetNumberField(TEXT("expanded_graphs"), Estimate.ExpandedGraphs);
+            TickArray.Add(MakeShared<FJsonValueObject>(TickObj));
+        }
+
+        TSharedPtr<FJsonObject> BlueprintObj = MakeShared<FJsonObject>();
+        BlueprintObj->SetStringField(TEXT("name"), Blueprint->GetName());
+        BlueprintObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
+        BlueprintObj->SetArrayField(TEXT("findings"), FindingArray);
+        BlueprintObj->SetArrayField(TEXT("tick_events"), TickArray);
+        BlueprintObj->SetBoolField(TEXT("actor_can_ever_tick"), Report.bActorCanEverTick);
+        BlueprintObj->SetNumberField(TEXT("ticking_components"), Report.TickingComponents);
+        BlueprintArray.Add(MakeShared<FJsonValueObject>(BlueprintObj));
+    }
+
+    TSharedPtr<FJsonObject> SeverityObj = MakeShared<FJsonObject>();
+    SeverityObj->SetNumberField(TEXT("error"), SeverityCounts[static_cast<int32>(EPerfSeverity::Error)]);
+    SeverityObj->SetNumberField(TEXT("warning"), SeverityCounts[static_cast<int32>(EPerfSeverity::Warning)]);
+    SeverityObj->SetNumberField(TEXT("info"), SeverityCounts[static_cast<int32>(EPerfSeverity::Info)]);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetArrayField(TEXT("blueprints"), BlueprintArray);
+    ResultObj->SetNumberField(TEXT("analyzed"), Work.Num());
+    ResultObj->SetNumberField(TEXT("clean"), CleanCount);
+    ResultObj->SetObjectField(TEXT("findings_by_severity"), SeverityObj);
+    ResultObj->SetNumberField(TEXT("ticking_actors"), TickingActors);
+    ResultObj->SetNumberField(TEXT("ticking_components"), TickingComponents);
+    ResultObj->SetArrayField(TEXT("not_found"), NotFoundArray);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPerformanceCommands::HandleSetTickPolicyBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    FTickPolicy ActorPolicy;
+    FTickPolicy ComponentPolicy;
+    UClass* ComponentClassFilter = nullptr;
+    bool bOnlyUnused = false;
+    FString PolicyError;
+
+    const TSharedPtr<FJsonObject>* ActorObj = nullptr;
+    if (Params->TryGetObjectField(TEXT("actor"), ActorObj) && !ParseTickPolicy(*ActorObj, ActorPolicy, PolicyError))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(ESpirrowErrorCode::InvalidParamValue, FString::Printf(TEXT("actor: %s"), *PolicyError));
+    }
+
+    const TSharedPtr<FJsonObject>* ComponentObj = nullptr;
+    if (Params->TryGetObjectField(TEXT("components"), ComponentObj))
+    {
+        if (!ParseTickPolicy(*ComponentObj, ComponentPolicy, PolicyError))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(ESpirrowErrorCode::InvalidParamValue, FString::Printf(TEXT("components: %s"), *PolicyError));
+        }
+
+        FString ComponentClassName;
+        if ((*ComponentObj)->TryGetStringField(TEXT("component_class"), ComponentClassName) && !ComponentClassName.IsEmpty())
+        {
+            ComponentClassFilter = FSpirrowBridgeClassIndex::Get().FindClass(ComponentClassName, UActorComponent::StaticClass());
+            if (!ComponentClassFilter)
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::ClassNotFound,
+                    FString::Printf(TEXT("Component class not found: %s"), *ComponentClassName));
+            }
+        }
+        (*ComponentObj)->TryGetBoolField(TEXT("only_unused"), bOnlyUnused);
+    }
+
+    if (ActorPolicy.IsEmpty() && ComponentPolicy.IsEmpty())
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("Specify tick settings in 'actor' and/or 'components' (enabled, start_enabled, interval, tick_group)"));
+    }
+
+    bool bDryRun, bCompile;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("dry_run"), bDryRun, false);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("compile"), bCompile, true);
+
+    TArray<UBlueprint*> Blueprints;
+    TArray<TSharedPtr<FJsonValue>> NotFoundArray;
+    if (auto Error = CollectBlueprints(Params, Blueprints, NotFoundArray))
+    {
+        return Error;
+    }
+
+    // Saves stay queued until the scope ends (compiles below run first); Immediate policy flushes once
+    FSpirrowBridgeSaveManager::FScopedDeferral SaveDeferral;
+    FSpirrowBridgeCompileScheduler& CompileScheduler = FSpirrowBridgeCompileScheduler::Get();
+    TArray<UBlueprint*> ModifiedBlueprints;
+    FTickCounts Before, After;
+    TArray<TSharedPtr<FJsonValue>> BlueprintArray;
+    int32 ChangedTargets = 0;
+
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        CompileScheduler.EnsureCompiled(Blueprint);
+        UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+        TArray<TSharedPtr<FJsonValue>> ChangeArray;
+
+        // Actor Blueprints: the CDO's actor tick; component Blueprints: the CDO's component tick
+        if (AActor* ActorCDO = Cast<AActor>(DefaultObject))
+        {
+            Before.AddActor(ActorCDO->PrimaryActorTick);
+            const TArray<FString> Changed = ApplyTickPolicy(ActorPolicy, ActorCDO->PrimaryActorTick, false);
+            if (Changed.Num() > 0)
+            {
+                if (!bDryRun)
+                {
+                    ActorCDO->Modify();
+                    ApplyTickPolicy(ActorPolicy, ActorCDO->PrimaryActorTick, true);
+                }
+                ChangeArray.Add(MakeChangeJson(TEXT("actor"), Changed));
+            }
+            After.AddActor(ActorCDO->PrimaryActorTick, &ActorPolicy);
+        }
+        else if (UActorComponent* ComponentCDO = Cast<UActorComponent>(DefaultObject))
+        {
+            Before.AddComponent(ComponentCDO->PrimaryComponentTick);
+            const bool bSelected = (!ComponentClassFilter || ComponentCDO->IsA(ComponentClassFilter))
+                && (!bOnlyUnused || HasUnusedComponentTick(ComponentCDO->GetClass()));
+            if (bSelected)
+            {
+                const TArray<FString> Changed = ApplyTickPolicy(ComponentPolicy, ComponentCDO->PrimaryComponentTick, false);
+                if (Changed.Num() > 0)
+                {
+                    if (!bDryRun)
+                    {
+                        ComponentCDO->Modify();
+                        ApplyTickPolicy(ComponentPolicy, ComponentCDO->PrimaryComponentTick, true);
+                    }
+                    ChangeArray.Add(MakeChangeJson(TEXT("self"), Changed));
+                }
+            }
+            After.AddComponent(ComponentCDO->PrimaryComponentTick, bSelected ? &ComponentPolicy : nullptr);
+        }
+
+        // Components added in this Blueprint; inherited templates belong to their parent Blueprint
+        if (USimpleConstructionScript* SCS = Blueprint->SimpleConstructionScript)
+        {
+            for (USCS_Node* SCSNode : SCS->GetAllNodes())
+            {
+                UActorComponent* Template = SCSNode ? SCSNode->ComponentTemplate : nullptr;
+                if (!Template)
+                {
+                    continue;
+                }
+
+                Before.AddComponent(Template->PrimaryComponentTick);
+                const bool bSelected = (!ComponentClassFilter || Template->IsA(ComponentClassFilter))
+                    && (!bOnlyUnused || HasUnusedComponentTick(Template->GetClass()));
+                if (bSelected)
+                {
+                    const TArray<FString> Changed = ApplyTickPolicy(ComponentPolicy, Template->PrimaryComponentTick, false);
+                    if (Changed.Num() > 0)
+                    {
+                        if (!bDryRun)
+                        {
+                            Template->Modify();
+                            ApplyTickPolicy(ComponentPolicy, Template->PrimaryComponentTick, true);
+                        }
+                        ChangeArray.Add(MakeChangeJson(SCSNode->GetVariableName().ToString(), Changed));
+                    }
+                }
+                After.AddComponent(Template->PrimaryComponentTick, bSelected ? &ComponentPolicy : nullptr);
+            }
+        }
+
+        if (ChangeArray.Num() == 0)
+        {
+            continue;
+        }
+        ChangedTargets += ChangeArray.Num();
+
+        if (!bDryRun)
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+            ModifiedBlueprints.Add(Blueprint);
+            FSpirrowBridgeSaveManager::Get().RequestSave(Blueprint);
+        }
+
+        TSharedPtr<FJsonObject> BlueprintObj = MakeShared<FJsonObject>();
+        BlueprintObj->SetStringField(TEXT("name"), Blueprint->GetName());
+        BlueprintObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
+        BlueprintObj->SetArrayField(TEXT("changes"), ChangeArray);
+        BlueprintArray.Add(MakeShared<FJsonValueObject>(BlueprintObj));
+    }
+
+    // One compilation manager pass for every edited Blueprint
+    TArray<FSpirrowBlueprintCompileResult> CompileResults;
+    if (bCompile && ModifiedBlueprints.Num() > 0)
+    {
+        CompileScheduler.CompileBlueprints(ModifiedBlueprints, CompileResults);
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetBoolField(TEXT("dry_run"), bDryRun);
+    Result->SetNumberField(TEXT("matched"), Blueprints.Num());
+    Result->SetNumberField(TEXT("modified"), BlueprintArray.Num());
+    Result->SetNumberField(TEXT("changed_targets"), ChangedTargets);
+    Result->SetObjectField(TEXT("before"), Before.ToJson());
+    Result->SetObjectField(TEXT("after"), After.ToJson());
+    Result->SetArrayField(TEXT("blueprints"), BlueprintArray);
+    Result->SetArrayField(TEXT("not_found"), NotFoundArray);
+    if (CompileResults.Num() > 0)
+    {
+        int32 CompileFailures = 0;
+        for (const FSpirrowBlueprintCompileResult& CompileResult : CompileResults)
+        {
+            CompileFailures += CompileResult.bSuccess ? 0 : 1;
+        }
+        Result->SetNumberField(TEXT("compiled"), CompileResults.Num());
+        Result->SetNumberField(TEXT("compile_failures"), CompileFailures);
+    }
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return Result;
+}
@@ -1,5 +1,10 @@
 #include "Commands/SpirrowBridgeBlueprintPropertyCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgeClassIndex.h"
+#include "Commands/SpirrowBridgeBlueprintSearchIndex.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/DataAsset.h"
@@ -13,7 +18,6 @@
 #include "GameFramework/Controller.h"
 #include "Blueprint/UserWidget.h"
 #include "Animation/AnimInstance.h"
-#include "UObject/UObjectIterator.h"
 #include "UObject/SavePackage.h"
 #include "EditorAssetLibrary.h"
 #include "Misc/PackageName.h"
@@ -28,6 +32,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleCommand(c
     {
         return HandleScanProjectClasses(Params);
     }
+    else if (CommandType == TEXT("search_blueprints"))
+    {
+        return HandleSearchBlueprints(Params);
+    }
     else if (CommandType == TEXT("set_blueprint_class_array"))
     {
         return HandleSetBlueprintClassArray(Params);
@@ -65,12 +73,18 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleCommand(c
     {
         return HandleBatchSetProperties(Params);
     }
+    else if (CommandType == TEXT("batch_set_properties_multi"))
+    {
+        return HandleBatchSetPropertiesMulti(Params);
+    }
 
     return nullptr;
 }
 
 TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleScanProjectClasses(const TSharedPtr<FJsonObject>& Params)
 {
+    const double StartTime = FPlatformTime::Seconds();
+
     // Get optional parameters
     FString ClassType, ParentClassFilter, ModuleFilter, PathFilter, BlueprintTypeFilter;
     FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("class_type"), ClassType, TEXT("all"));
@@ -83,222 +97,265 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleScanProje
     FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_engine"), bIncludeEngine, false);
     FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("exclude_reinst"), bExcludeReinst, true);
 
-    TArray<TSharedPtr<FJsonValue>> CppClassesArray;
-    TArray<TSharedPtr<FJsonValue>> BlueprintsArray;
+    double OffsetValue, LimitValue;
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("offset"), OffsetValue, 0.0);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("limit"), LimitValue, 0.0);
+    const int32 Offset = FMath::Max(0, static_cast<int32>(OffsetValue));
+    const int32 Limit = FMath::Max(0, static_cast<int32>(LimitValue));
+
+    FSpirrowBridgeClassIndex& ClassIndex = FSpirrowBridgeClassIndex::Get();
+    const FString CacheKey = FString::Printf(TEXT("%s|%s|%s|%s|%s|%d|%d"),
+        *ClassType, *ParentClassFilter, *ModuleFilter, *PathFilter, *BlueprintTypeFilter,
+        bIncludeEngine ? 1 : 0, bExcludeReinst ? 1 : 0);
 
-    // === Scan C++ classes ===
-    if (ClassType == TEXT("all") || ClassType == TEXT("cpp"))
+    // Results of an older generation are stale for every filter, drop them all at once
+    if (ScanResultGeneration != ClassIndex.GetGeneration())
+    {
+        ScanResultCache.Reset();
+        ScanResultGeneration = ClassIndex.GetGeneration();
+    }
+    if (ScanResultCache.Num() >= MaxScanResults && !ScanResultCache.Contains(CacheKey))
     {
-        for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+        const FString* OldestKey = nullptr;
+        uint64 OldestUse = MAX_uint64;
+        for (const TPair<FString, FScanResult>& Entry : ScanResultCache)
         {
-            UClass* TestClass = *ClassIt;
-            if (!TestClass || !TestClass->IsChildOf(AActor::StaticClass()))
+            if (Entry.Value.LastUse < OldestUse)
             {
-                continue;
+                OldestUse = Entry.Value.LastUse;
+                OldestKey = &Entry.Key;
             }
+        }
+        ScanResultCache.Remove(FString(*OldestKey));
+    }
+
+    FScanResult& Scan = ScanResultCache.FindOrAdd(CacheKey);
+    Scan.LastUse = ++ScanResultUseCounter;
+    const bool bCached = Scan.Generation == ClassIndex.GetGeneration();
+    if (!bCached)
+    {
+        Scan.CppClasses.Reset();
+        Scan.Blueprints.Reset();
 
-            FString ClassPath = TestClass->GetPathName();
-            FString ClassName = TestClass->GetName();
+        // "Pawn", "APawn" and "Pawn" given as "APawn" all match the Pawn class
+        TArray<FName, TInlineAllocator<3>> ParentNames;
+        if (!ParentClassFilter.IsEmpty())
+        {
+            ParentNames.Add(FName(*ParentClassFilter));
+            ParentNames.Add(FName(*(TEXT("A") + ParentClassFilter)));
+            ParentNames.Add(FName(*ParentClassFilter.Mid(1)));
+        }
+        auto MatchesParent = [&ParentNames](const TArray<FName>& AncestorNames)
+        {
+            for (const FName& ParentName : ParentNames)
+            {
+                if (AncestorNames.Contains(ParentName))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
 
-            if (!bIncludeEngine)
+        // === C++ classes ===
+        if (ClassType == TEXT("all") || ClassType == TEXT("cpp"))
+        {
+            const FName ModuleName = ModuleFilter.IsEmpty() ? NAME_None : FName(*ModuleFilter);
+            for (const FSpirrowActorClassRecord& Record : ClassIndex.GetActorClassRecords())
             {
-                if (ClassPath.Contains(TEXT("/Script/Engine.")) ||
-                    ClassPath.Contains(TEXT("/Script/CoreUObject.")) ||
-                    ClassPath.Contains(TEXT("/Script/UMG.")) ||
-                    ClassPath.Contains(TEXT("/Script/AIModule.")) ||
-                    ClassPath.Contains(TEXT("/Script/NavigationSystem.")) ||
-                    ClassPath.Contains(TEXT("/Script/PhysicsCore.")) ||
-                    ClassPath.Contains(TEXT("/Script/EnhancedInput.")) ||
-                    ClassPath.Contains(TEXT("/Script/InputCore.")))
+                if (Record.bGeneratedClass ||
+                    (!bIncludeEngine && Record.bEngineModule) ||
+                    (bExcludeReinst && Record.bReinstanced) ||
+                    (!ModuleName.IsNone() && Record.Module != ModuleName) ||
+                    (ParentNames.Num() > 0 && !MatchesParent(Record.AncestorNames)))
                 {
                     continue;
                 }
+
+                TSharedPtr<FJsonObject> ClassObj = MakeShared<FJsonObject>();
+                ClassObj->SetStringField(TEXT("name"), Record.Name);
+                ClassObj->SetStringField(TEXT("path"), Record.Path);
+                ClassObj->SetStringField(TEXT("parent"), Record.ParentName);
+                ClassObj->SetStringField(TEXT("module"), Record.Module.IsNone() ? FString() : Record.Module.ToString());
+
+                Scan.CppClasses.Add(MakeShared<FJsonValueObject>(ClassObj));
             }
+        }
 
-            if (ClassName.EndsWith(TEXT("_C")))
+        // === Blueprint assets (registry tags only, nothing is loaded) ===
+        if (ClassType == TEXT("all") || ClassType == TEXT("blueprint"))
+        {
+            FString RootPath = PathFilter.IsEmpty() ? TEXT("/Game") : PathFilter;
+            RootPath.RemoveFromEnd(TEXT("/"));
+            const FString RootPrefix = RootPath + TEXT("/");
+
+            UClass* TypeClass = nullptr;
+            if (BlueprintTypeFilter == TEXT("actor") || BlueprintTypeFilter == TEXT("widget"))
             {
-                continue;
+                TypeClass = BlueprintTypeFilter == TEXT("actor") ? AActor::StaticClass() : UUserWidget::StaticClass();
+            }
+            else if (BlueprintTypeFilter == TEXT("anim"))
+            {
+                TypeClass = UAnimInstance::StaticClass();
+            }
+            else if (BlueprintTypeFilter == TEXT("controlrig"))
+            {
+                TypeClass = FindObject<UClass>(nullptr, TEXT("/Script/ControlRig.ControlRig"));
+            }
+            else if (BlueprintTypeFilter == TEXT("interface"))
+            {
+                TypeClass = UInterface::StaticClass();
+            }
+            else if (BlueprintTypeFilter == TEXT("gamemode"))
+            {
+                TypeClass = AGameModeBase::StaticClass();
+            }
+            else if (BlueprintTypeFilter == TEXT("controller"))
+            {
+                TypeClass = AController::StaticClass();
+            }
+            else if (BlueprintTypeFilter == TEXT("character"))
+            {
+                TypeClass = ACharacter::StaticClass();
+            }
+            else if (BlueprintTypeFilter == TEXT("pawn"))
+            {
+                TypeClass = APawn::StaticClass();
             }
 
-            if (bExcludeReinst)
+            for (const FSpirrowBlueprintClassRecord& Record : ClassIndex.GetBlueprintClassRecords())
             {
-                if (ClassName.StartsWith(TEXT("REINST_")) || ClassPath.Contains(TEXT("/Engine/Transient.")))
+                if (Record.PackagePath != RootPath && !Record.PackagePath.StartsWith(RootPrefix))
                 {
                     continue;
                 }
-            }
 
-            if (!ModuleFilter.IsEmpty())
-            {
-                if (!ClassPath.Contains(FString::Printf(TEXT("/Script/%s."), *ModuleFilter)))
+                if (ParentNames.Num() > 0 && Record.AncestorNames.Num() > 0 && !MatchesParent(Record.AncestorNames))
                 {
                     continue;
                 }
-            }
 
-            if (!ParentClassFilter.IsEmpty())
-            {
-                UClass* ParentClass = TestClass->GetSuperClass();
-                bool bMatchesParent = false;
-                while (ParentClass)
+                // Type filters compare the native parent; Blueprints whose native parent is not loaded pass
+                const UClass* NativeParent = BlueprintTypeFilter.IsEmpty() ? nullptr : FindObject<UClass>(Record.NativeParentClassPath);
+                if (NativeParent)
                 {
-                    if (ParentClass->GetName() == ParentClassFilter ||
-                        ParentClass->GetName() == TEXT("A") + ParentClassFilter ||
-                        ParentClass->GetName() == ParentClassFilter.Mid(1))
+                    bool bMatchesType = TypeClass && NativeParent->IsChildOf(TypeClass);
+                    if (BlueprintTypeFilter == TEXT("actor"))
+                    {
+                        bMatchesType = bMatchesType && !NativeParent->IsChildOf(UUserWidget::StaticClass());
+                    }
+                    else if (BlueprintTypeFilter == TEXT("interface"))
                     {
-                        bMatchesParent = true;
-                        break;
+                        bMatchesType = bMatchesType || Record.AssetName.ToString().StartsWith(TEXT("BPI_"));
                     }
-                    ParentClass = ParentClass->GetSuperClass();
+                    if (!bMatchesType) continue;
                 }
-                if (!bMatchesParent) continue;
-            }
 
-            FString ModuleName;
-            if (ClassPath.Contains(TEXT("/Script/")))
-            {
-                int32 ScriptIdx = ClassPath.Find(TEXT("/Script/"));
-                int32 DotIdx = ClassPath.Find(TEXT("."), ESearchCase::IgnoreCase, ESearchDir::FromStart, ScriptIdx + 8);
-                if (DotIdx != INDEX_NONE)
-                {
-                    ModuleName = ClassPath.Mid(ScriptIdx + 8, DotIdx - ScriptIdx - 8);
-                }
-            }
+                TSharedPtr<FJsonObject> BPObj = MakeShared<FJsonObject>();
+                BPObj->SetStringField(TEXT("name"), Record.AssetName.ToString());
+                BPObj->SetStringField(TEXT("path"), Record.ObjectPath);
+                BPObj->SetStringField(TEXT("parent"), Record.ParentName);
 
-            FString ParentClassName;
-            if (TestClass->GetSuperClass())
-            {
-                ParentClassName = TestClass->GetSuperClass()->GetName();
+                Scan.Blueprints.Add(MakeShared<FJsonValueObject>(BPObj));
             }
-
-            TSharedPtr<FJsonObject> ClassObj = MakeShared<FJsonObject>();
-            ClassObj->SetStringField(TEXT("name"), ClassName);
-            ClassObj->SetStringField(TEXT("path"), ClassPath);
-            ClassObj->SetStringField(TEXT("parent"), ParentClassName);
-            ClassObj->SetStringField(TEXT("module"), ModuleName);
-
-            CppClassesArray.Add(MakeShared<FJsonValueObject>(ClassObj));
         }
+
+        Scan.Generation = ClassIndex.GetGeneration();
     }
 
-    // === Scan Blueprint assets ===
-    if (ClassType == TEXT("all") || ClassType == TEXT("blueprint"))
+    // Pagination applies the same window to both lists
+    auto Slice = [Offset, Limit](const TArray<TSharedPtr<FJsonValue>>& Source)
     {
-        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-        IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+        const int32 First = FMath::Min(Offset, Source.Num());
+        const int32 Count = Limit > 0 ? FMath::Min(Limit, Source.Num() - First) : Source.Num() - First;
+        return TArray<TSharedPtr<FJsonValue>>(Source.GetData() + First, Count);
+    };
+    const int32 Largest = FMath::Max(Scan.CppClasses.Num(), Scan.Blueprints.Num());
 
-        FARFilter Filter;
-        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-        Filter.bRecursiveClasses = true;
-        Filter.bRecursivePaths = true;
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetArrayField(TEXT("cpp_classes"), Slice(Scan.CppClasses));
+    ResultObj->SetArrayField(TEXT("blueprints"), Slice(Scan.Blueprints));
+    ResultObj->SetNumberField(TEXT("total_cpp"), Scan.CppClasses.Num());
+    ResultObj->SetNumberField(TEXT("total_blueprints"), Scan.Blueprints.Num());
+    ResultObj->SetNumberField(TEXT("offset"), Offset);
+    ResultObj->SetNumberField(TEXT("limit"), Limit);
+    ResultObj->SetBoolField(TEXT("has_more"), Limit > 0 && Offset + Limit < Largest);
+    ResultObj->SetBoolField(TEXT("cached"), bCached);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 
-        if (!PathFilter.IsEmpty())
-        {
-            Filter.PackagePaths.Add(FName(*PathFilter));
-        }
-        else
-        {
-            Filter.PackagePaths.Add(FName(TEXT("/Game")));
-        }
+    return ResultObj;
+}
 
-        TArray<FAssetData> AssetList;
-        AssetRegistry.GetAssets(Filter, AssetList);
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleSearchBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
 
-        for (const FAssetData& Asset : AssetList)
-        {
-            UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset());
-            if (!Blueprint) continue;
+    // Validate required parameters
+    FString Query;
+    if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("query"), Query))
+    {
+        return Error;
+    }
 
-            if (!ParentClassFilter.IsEmpty() && Blueprint->ParentClass)
-            {
-                UClass* ParentClass = Blueprint->ParentClass;
-                bool bMatchesParent = false;
-                while (ParentClass)
-                {
-                    if (ParentClass->GetName() == ParentClassFilter ||
-                        ParentClass->GetName() == TEXT("A") + ParentClassFilter ||
-                        ParentClass->GetName() == ParentClassFilter.Mid(1))
-                    {
-                        bMatchesParent = true;
-                        break;
-                    }
-                    ParentClass = ParentClass->GetSuperClass();
-                }
-                if (!bMatchesParent) continue;
-            }
+    // Get optional parameters
+    FString PathFilter;
+    Params->TryGetStringField(TEXT("path"), PathFilter);
 
-            if (!BlueprintTypeFilter.IsEmpty() && Blueprint->ParentClass)
-            {
-                bool bMatchesType = false;
-                UClass* ParentClass = Blueprint->ParentClass;
+    bool bWait, bRebuild;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("wait"), bWait, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("rebuild"), bRebuild, false);
 
-                if (BlueprintTypeFilter == TEXT("actor"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(AActor::StaticClass()) &&
-                                   !ParentClass->IsChildOf(UUserWidget::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("widget"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(UUserWidget::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("anim"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(UAnimInstance::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("controlrig"))
-                {
-                    static UClass* ControlRigClass = FindObject<UClass>(nullptr, TEXT("/Script/ControlRig.ControlRig"));
-                    if (ControlRigClass)
-                    {
-                        bMatchesType = ParentClass->IsChildOf(ControlRigClass);
-                    }
-                }
-                else if (BlueprintTypeFilter == TEXT("interface"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(UInterface::StaticClass()) ||
-                                   Asset.AssetName.ToString().StartsWith(TEXT("BPI_"));
-                }
-                else if (BlueprintTypeFilter == TEXT("gamemode"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(AGameModeBase::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("controller"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(AController::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("character"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(ACharacter::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("pawn"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(APawn::StaticClass());
-                }
+    double OffsetValue, LimitValue;
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("offset"), OffsetValue, 0.0);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("limit"), LimitValue, 50.0);
+    const int32 Offset = FMath::Max(0, static_cast<int32>(OffsetValue));
+    const int32 Limit = FMath::Max(0, static_cast<int32>(LimitValue));
 
-                if (!bMatchesType) continue;
-            }
+    FSpirrowBridgeBlueprintSearchIndex& SearchIndex = FSpirrowBridgeBlueprintSearchIndex::Get();
+    if (bRebuild)
+    {
+        SearchIndex.Rebuild();
+    }
 
-            FString ParentClassName;
-            if (Blueprint->ParentClass)
-            {
-                ParentClassName = Blueprint->ParentClass->GetName();
-            }
+    FSpirrowBlueprintSearchResult SearchResult;
+    if (!SearchIndex.Search(Query, PathFilter, Offset, Limit, bWait, SearchResult))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            FString::Printf(TEXT("Query has no searchable terms (2+ letters or digits): '%s'"), *Query));
+    }
 
-            TSharedPtr<FJsonObject> BPObj = MakeShared<FJsonObject>();
-            BPObj->SetStringField(TEXT("name"), Asset.AssetName.ToString());
-            BPObj->SetStringField(TEXT("path"), Asset.GetObjectPathString());
-            BPObj->SetStringField(TEXT("parent"), ParentClassName);
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    for (const FSpirrowBlueprintSearchHit& Hit : SearchResult.Hits)
+    {
+        TSharedPtr<FJsonObject> HitObj = MakeShared<FJsonObject>();
+        HitObj->SetStringField(TEXT("name"), Hit.AssetName);
+        HitObj->SetStringField(TEXT("path"), Hit.ObjectPath);
+        HitObj->SetStringField(TEXT("parent"), Hit.ParentName);
 
-            BlueprintsArray.Add(MakeShared<FJsonValueObject>(BPObj));
+        TArray<TSharedPtr<FJsonValue>> MatchedArray;
+        for (const FString& Token : Hit.MatchedTokens)
+        {
+            MatchedArray.Add(MakeShared<FJsonValueString>(Token));
         }
+        HitObj->SetArrayField(TEXT("matched"), MatchedArray);
+
+        ResultsArray.Add(MakeShared<FJsonValueObject>(HitObj));
     }
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetBoolField(TEXT("success"), true);
-    ResultObj->SetArrayField(TEXT("cpp_classes"), CppClassesArray);
-    ResultObj->SetArrayField(TEXT("blueprints"), BlueprintsArray);
-    ResultObj->SetNumberField(TEXT("total_cpp"), CppClassesArray.Num());
-    ResultObj->SetNumberField(TEXT("total_blueprints"), BlueprintsArray.Num());
+    ResultObj->SetStringField(TEXT("query"), Query);
+    ResultObj->SetArrayField(TEXT("results"), ResultsArray);
+    ResultObj->SetNumberField(TEXT("total"), SearchResult.Total);
+    ResultObj->SetNumberField(TEXT("offset"), Offset);
+    ResultObj->SetNumberField(TEXT("limit"), Limit);
+    ResultObj->SetBoolField(TEXT("has_more"), Limit > 0 && Offset + Limit < SearchResult.Total);
+    ResultObj->SetBoolField(TEXT("indexing"), SearchResult.bIndexing);
+    ResultObj->SetNumberField(TEXT("indexed_count"), SearchResult.IndexedCount);
+    ResultObj->SetNumberField(TEXT("without_search_data"), SearchResult.WithoutSearchDataCount);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 
     return ResultObj;
 }
@@ -336,6 +393,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleSetBluepr
     }
 
     // Get CDO
+    // A queued compile would replace the class defaults written below
+    FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
     UClass* BPClass = Blueprint->GeneratedClass;
     if (!BPClass)
     {
@@ -431,6 +490,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleSetStruct
         return Error;
     }
 
+    // A queued compile would replace the class defaults written below
+    FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
     UClass* BPClass = Blueprint->GeneratedClass;
     if (!BPClass)
     {
@@ -603,27 +664,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleCreateDat
         }
     }
 
-    // Method 3: Try TObjectIterator
+    // Method 3: Class index (with or without U prefix)
     if (!ParentClass)
     {
-        FString SearchName = ParentClassName;
-        if (!SearchName.StartsWith(TEXT("U")))
-        {
-            SearchName = TEXT("U") + ParentClassName;
-        }
-
-        for (TObjectIterator<UClass> It; It; ++It)
-        {
-            UClass* TestClass = *It;
-            if (TestClass->IsChildOf(UDataAsset::StaticClass()))
-            {
-                if (TestClass->GetName() == SearchName || TestClass->GetName() == ParentClassName)
-                {
-                    ParentClass = TestClass;
-                    break;
-                }
-            }
-        }
+        ParentClass = FSpirrowBridgeClassIndex::Get().FindClass(ParentClassName, UDataAsset::StaticClass());
     }
 
     if (!ParentClass || !ParentClass->IsChildOf(UDataAsset::StaticClass()))
@@ -667,11 +711,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleCreateDat
     Package->MarkPackageDirty();
     FAssetRegistryModule::AssetCreated(DataAsset);
 
-    FString PackageFileName = FPackageName::LongPackageNameToFilename(
-        PackagePath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, DataAsset, *PackageFileName, SaveArgs);
+    FSpirrowBridgeSaveManager::Get().RequestSave(DataAsset);
 
     // Response
     TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
@@ -710,6 +750,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleSetClassP
         return Error;
     }
 
+    // A queued compile would replace the class defaults written below
+    FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
     UClass* BPClass = Blueprint->GeneratedClass;
     if (!BPClass)
     {
@@ -776,6 +818,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleSetObject
         return Error;
     }
 
+    // A queued compile would replace the class defaults written below
+    FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
     UClass* BPClass = Blueprint->GeneratedClass;
     if (!BPClass)
     {
@@ -914,6 +958,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleGetBluepr
         return Error;
     }
 
+    // A queued compile would replace the class defaults written below
+    FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
     UClass* BPClass = Blueprint->GeneratedClass;
     if (!BPClass)
     {
@@ -1020,6 +1066,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleSetStruct
         return Error;
     }
 
+    // A queued compile would replace the class defaults written below
+    FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
     UClass* BPClass = Blueprint->GeneratedClass;
     if (!BPClass)
     {
@@ -1211,7 +1259,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleSetDataAs
 
     // Load DataAsset
     FString FullPath = Path / AssetName + TEXT(".") + AssetName;
-    UObject* LoadedAsset = UEditorAssetLibrary::LoadAsset(FullPath);
+    UObject* LoadedAsset = FSpirrowBridgeAssetResolver::Get().Resolve<UObject>(AssetName, Path);
 
     if (!LoadedAsset)
     {
@@ -1225,7 +1273,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleSetDataAs
     {
         return FSpirrowBridgeCommonUtils::CreateErrorResponse(
             ESpirrowErrorCode::InvalidParameter,
-            FString::Printf(TEXT("Asset is not a DataAsset: %s"), *FullPath));
+            FString::Printf(TEXT("Asset is not a DataAsset: %s"), *LoadedAsset->GetPathName()));
     }
 
     // Set the property value
@@ -1249,18 +1297,14 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleSetDataAs
     // Save the DataAsset
     DataAsset->MarkPackageDirty();
 
-    UPackage* Package = DataAsset->GetOutermost();
-    FString PackageFileName = FPackageName::LongPackageNameToFilename(
-        Package->GetName(), FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, DataAsset, *PackageFileName, SaveArgs);
+    FSpirrowBridgeSaveManager::Get().RequestSave(DataAsset);
 
     TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
     Result->SetBoolField(TEXT("success"), true);
     Result->SetStringField(TEXT("asset_name"), AssetName);
     Result->SetStringField(TEXT("property_name"), PropertyName);
-    Result->SetStringField(TEXT("asset_path"), FullPath);
+    // The resolver may have found the asset outside Path through the name index
+    Result->SetStringField(TEXT("asset_path"), DataAsset->GetPathName());
     return Result;
 }
 
@@ -1285,9 +1329,9 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleBatchSetP
     FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Data"));
     FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("asset_type"), AssetType, TEXT("dataasset"));
 
-    // Load asset
+    // Load asset (cached across consecutive batches on the same asset)
     FString FullPath = Path / AssetName + TEXT(".") + AssetName;
-    UObject* Asset = UEditorAssetLibrary::LoadAsset(FullPath);
+    UObject* Asset = FSpirrowBridgeAssetResolver::Get().Resolve<UObject>(AssetName, Path);
     if (!Asset)
     {
         return FSpirrowBridgeCommonUtils::CreateErrorResponse(
@@ -1314,17 +1358,12 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleBatchSetP
 
     // Save
     Asset->MarkPackageDirty();
-    UPackage* Package = Asset->GetOutermost();
-    FString PackageFileName = FPackageName::LongPackageNameToFilename(
-        Package->GetName(), FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, Asset, *PackageFileName, SaveArgs);
+    FSpirrowBridgeSaveManager::Get().RequestSave(Asset);
 
     // Build result
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
     Result->SetBoolField(TEXT("success"), FailedProperties.Num() == 0);
-    Result->SetStringField(TEXT("asset_path"), FullPath);
+    Result->SetStringField(TEXT("asset_path"), Asset->GetPathName());
     Result->SetNumberField(TEXT("succeeded_count"), SuccessProperties.Num());
     Result->SetNumberField(TEXT("failed_count"), FailedProperties.Num());
 
@@ -1344,3 +1383,286 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleBatchSetP
 
     return Result;
 }
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleBatchSetPropertiesMulti(const TSharedPtr<FJsonObject>& Params)
+{
+    const TSharedPtr<FJsonObject>* PropertiesObj = nullptr;
+    if (!Params->TryGetObjectField(TEXT("properties"), PropertiesObj) || (*PropertiesObj)->Values.Num() == 0)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("Missing required parameter: properties"));
+    }
+
+    FString Folder, ClassName, ParentClassName;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("folder"), Folder, TEXT(""));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("class_name"), ClassName, TEXT(""));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("parent_class"), ParentClassName, TEXT(""));
+    const TArray<TSharedPtr<FJsonValue>>* AssetArray = nullptr;
+    Params->TryGetArrayField(TEXT("assets"), AssetArray);
+
+    if (!AssetArray && Folder.IsEmpty() && ClassName.IsEmpty() && ParentClassName.IsEmpty())
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("Provide 'assets' or a query ('folder', 'class_name', 'parent_class')"));
+    }
+
+    bool bRecursive, bCompile, bDryRun;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("recursive"), bRecursive, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("compile"), bCompile, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("dry_run"), bDryRun, false);
+
+    const double StartTime = FPlatformTime::Seconds();
+    FSpirrowBridgeClassIndex& ClassIndex = FSpirrowBridgeClassIndex::Get();
+    TArray<FSoftObjectPath> TargetPaths;
+    TArray<TSharedPtr<FJsonValue>> NotFoundArray;
+
+    // === Explicit list: object paths or unique short names ===
+    if (AssetArray)
+    {
+        for (const TSharedPtr<FJsonValue>& AssetValue : *AssetArray)
+        {
+            const FString AssetRef = AssetValue->AsString();
+            if (AssetRef.StartsWith(TEXT("/")))
+            {
+                const FString ObjectPath = AssetRef.Contains(TEXT("."))
+                    ? AssetRef
+                    : AssetRef + TEXT(".") + FPackageName::GetShortName(AssetRef);
+                TargetPaths.AddUnique(FSoftObjectPath(ObjectPath));
+                continue;
+            }
+
+            TArray<FSoftObjectPath> Candidates;
+            const ESpirrowAssetLookup Lookup = FSpirrowBridgeAssetResolver::Get().FindByName(AssetRef, nullptr, Candidates);
+            if (Lookup == ESpirrowAssetLookup::Found)
+            {
+                TargetPaths.AddUnique(Candidates[0]);
+            }
+            else if (Lookup == ESpirrowAssetLookup::Ambiguous)
+            {
+                // Nothing has been changed yet, so refuse the whole batch rather than guess
+                TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
+                Details->SetStringField(TEXT("name"), AssetRef);
+                TArray<TSharedPtr<FJsonValue>> CandidateArray;
+                for (const FSoftObjectPath& Candidate : Candidates)
+                {
+                    CandidateArray.Add(MakeShared<FJsonValueString>(Candidate.GetLongPackageName()));
+                }
+                Details->SetArrayField(TEXT("candidates"), CandidateArray);
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::AssetAmbiguous,
+                    FString::Printf(TEXT("'%s' matches %d assets; list the path of one of the candidates"),
+                        *AssetRef, Candidates.Num()),
+                    Details);
+            }
+            else
+            {
+                NotFoundArray.Add(MakeShared<FJsonValueString>(AssetRef));
+            }
+        }
+    }
+
+    // === Query: Blueprints and data assets under a folder, by asset class and/or parent class ===
+    if (!Folder.IsEmpty() || !ClassName.IsEmpty() || !ParentClassName.IsEmpty())
+    {
+        FARFilter Filter;
+        Filter.PackagePaths.Add(FName(*(Folder.IsEmpty() ? FString(TEXT("/Game")) : Folder)));
+        Filter.bRecursivePaths = bRecursive;
+        Filter.bRecursiveClasses = true;
+
+        if (!ClassName.IsEmpty())
+        {
+            UClass* AssetClass = ClassIndex.FindClass(ClassName, UObject::StaticClass(), false);
+            if (!AssetClass)
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::ClassNotFound,
+                    FString::Printf(TEXT("Asset class not found: %s"), *ClassName));
+            }
+            Filter.ClassPaths.Add(AssetClass->GetClassPathName());
+        }
+        else
+        {
+            Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+            Filter.ClassPaths.Add(UDataAsset::StaticClass()->GetClassPathName());
+        }
+
+        UClass* ParentClass = nullptr;
+        TSet<FString> DerivedBlueprints;
+        if (!ParentClassName.IsEmpty())
+        {
+            ParentClass = ClassIndex.FindClass(ParentClassName);
+            if (!ParentClass)
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::ClassNotFound,
+                    FString::Printf(TEXT("Parent class not found: %s"), *ParentClassName));
+            }
+
+            // Blueprint ancestry comes from registry tags, so unrelated Blueprints are never loaded
+            const FTopLevelAssetPath ParentPath = ParentClass->GetClassPathName();
+            for (const FSpirrowBlueprintClassRecord& Record : ClassIndex.GetBlueprintClassRecords())
+            {
+                if (Record.AncestorPaths.Contains(ParentPath))
+                {
+                    DerivedBlueprints.Add(Record.ObjectPath);
+                }
+            }
+        }
+
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        TArray<FAssetData> AssetList;
+        AssetRegistry.GetAssets(Filter, AssetList);
+
+        TMap<FTopLevelAssetPath, bool> ClassMatchesParent;
+        for (const FAssetData& AssetData : AssetList)
+        {
+            if (ParentClass)
+            {
+                bool bMatches;
+                if (AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+                {
+                    bMatches = DerivedBlueprints.Contains(AssetData.GetObjectPathString());
+                }
+                else
+                {
+                    // Data assets: class derives from the parent; evaluated once per class
+                    bool* Cached = ClassMatchesParent.Find(AssetData.AssetClassPath);
+                    if (!Cached)
+                    {
+                        const UClass* AssetClass = LoadObject<UClass>(nullptr, *AssetData.AssetClassPath.ToString(), nullptr, LOAD_NoWarn);
+                        Cached = &ClassMatchesParent.Add(AssetData.AssetClassPath, AssetClass && AssetClass->IsChildOf(ParentClass));
+                    }
+                    bMatches = *Cached;
+                }
+                if (!bMatches)
+                {
+                    continue;
+                }
+            }
+            TargetPaths.AddUnique(AssetData.GetSoftObjectPath());
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> AssetResults;
+    int32 SucceededCount = 0;
+    int32 FailedCount = 0;
+    int32 AssignmentCount = 0;
+    TArray<FSpirrowBlueprintCompileResult> CompileResults;
+
+    if (bDryRun)
+    {
+        for (const FSoftObjectPath& TargetPath : TargetPaths)
+        {
+            AssetResults.Add(MakeShared<FJsonValueString>(TargetPath.ToString()));
+        }
+    }
+    else
+    {
+        // Saves stay queued until the scope ends (compiles below run first); Immediate policy flushes once
+        FSpirrowBridgeSaveManager::FScopedDeferral SaveDeferral;
+        FSpirrowBridgeCompileScheduler& CompileScheduler = FSpirrowBridgeCompileScheduler::Get();
+        TArray<UBlueprint*> ModifiedBlueprints;
+
+        for (const FSoftObjectPath& TargetPath : TargetPaths)
+        {
+            TSharedPtr<FJsonObject> AssetResult = MakeShared<FJsonObject>();
+            AssetResult->SetStringField(TEXT("asset"), TargetPath.ToString());
+
+            UObject* Asset = TargetPath.TryLoad();
+            UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
+            if (Blueprint)
+            {
+                CompileScheduler.EnsureCompiled(Blueprint);
+            }
+            UObject* Target = Blueprint
+                ? (Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr)
+                : Asset;
+
+            if (!Target)
+            {
+                ++FailedCount;
+                AssetResult->SetBoolField(TEXT("success"), false);
+                AssetResult->SetStringField(TEXT("error"), Asset ? TEXT("Blueprint has no generated class") : TEXT("Failed to load asset"));
+                AssetResults.Add(MakeShared<FJsonValueObject>(AssetResult));
+                continue;
+            }
+
+            int32 Applied = 0;
+            TArray<TSharedPtr<FJsonValue>> ErrorArray;
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*PropertiesObj)->Values)
+            {
+                FString ErrorMsg;
+                if (FSpirrowBridgeCommonUtils::SetObjectProperty(Target, Pair.Key, Pair.Value, ErrorMsg))
+                {
+                    ++Applied;
+                }
+                else
+                {
+                    ErrorArray.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s: %s"), *Pair.Key, *ErrorMsg)));
+                }
+            }
+
+            if (Applied > 0)
+            {
+                if (Blueprint)
+                {
+                    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+                    ModifiedBlueprints.Add(Blueprint);
+                }
+                else
+                {
+                    Asset->MarkPackageDirty();
+                }
+                FSpirrowBridgeSaveManager::Get().RequestSave(Asset);
+            }
+
+            AssignmentCount += Applied;
+            if (ErrorArray.Num() == 0)
+            {
+                ++SucceededCount;
+            }
+            else
+            {
+                ++FailedCount;
+            }
+            AssetResult->SetBoolField(TEXT("success"), ErrorArray.Num() == 0);
+            AssetResult->SetStringField(TEXT("type"), Blueprint ? TEXT("blueprint") : TEXT("data_asset"));
+            AssetResult->SetNumberField(TEXT("applied"), Applied);
+            if (ErrorArray.Num() > 0)
+            {
+                AssetResult->SetArrayField(TEXT("errors"), ErrorArray);
+            }
+            AssetResults.Add(MakeShared<FJsonValueObject>(AssetResult));
+        }
+
+        // One compilation manager pass for every edited Blueprint
+        if (bCompile && ModifiedBlueprints.Num() > 0)
+        {
+            CompileScheduler.CompileBlueprints(ModifiedBlueprints, CompileResults);
+        }
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetBoolField(TEXT("dry_run"), bDryRun);
+    Result->SetNumberField(TEXT("matched"), TargetPaths.Num());
+    Result->SetNumberField(TEXT("succeeded"), SucceededCount);
+    Result->SetNumberField(TEXT("failed"), FailedCount);
+    Result->SetNumberField(TEXT("assignments_applied"), AssignmentCount);
+    Result->SetArrayField(bDryRun ? TEXT("matched_assets") : TEXT("assets"), AssetResults);
+    Result->SetArrayField(TEXT("not_found"), NotFoundArray);
+    if (CompileResults.Num() > 0)
+    {
+        int32 CompileFailures = 0;
+        for (const FSpirrowBlueprintCompileResult& CompileResult : CompileResults)
+        {
+            CompileFailures += CompileResult.bSuccess ? 0 : 1;
+        }
+        Result->SetNumberField(TEXT("compiled"), CompileResults.Num());
+        Result->SetNumberField(TEXT("compile_failures"), CompileFailures);
+    }
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return Result;
+}
@@ -0,0 +1,517 @@
+#include "Commands/SpirrowBridgeBlueprintSearchIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+
+namespace
+{
+    constexpr int32 MaxMatchedTokensPerTerm = 5;
+
+    /**
+     * FiB tag values are a hex dump of the serialized search metadata (versioned header, string
+     * table, JSON). The token index only needs the text, so decode the hex to characters without
+     * interpreting the layout; anything that is not a hex dump is used as is.
+     */
+    FString DecodeSearchData(const FString& Raw)
+    {
+        const int32 Len = Raw.Len();
+        if (Len < 4 || Len % 2 != 0)
+        {
+            return Raw;
+        }
+        for (const TCHAR Char : Raw)
+        {
+            if (!FChar::IsHexDigit(Char))
+            {
+                return Raw;
+            }
+        }
+
+        TArray<uint8> Bytes;
+        Bytes.SetNumUninitialized(Len / 2);
+        int32 ZeroHighBytes = 0;
+        for (int32 Index = 0; Index < Bytes.Num(); ++Index)
+        {
+            Bytes[Index] = static_cast<uint8>((FParse::HexDigit(Raw[Index * 2]) << 4) | FParse::HexDigit(Raw[Index * 2 + 1]));
+            if (Index % 2 == 1 && Bytes[Index] == 0)
+            {
+                ++ZeroHighBytes;
+            }
+        }
+
+        // Two-byte characters when most high bytes are zero
+        FString Text;
+        if (ZeroHighBytes * 4 > Bytes.Num())
+        {
+            Text.Reserve(Bytes.Num() / 2);
+            for (int32 Index = 0; Index + 1 < Bytes.Num(); Index += 2)
+            {
+                Text.AppendChar(static_cast<TCHAR>(Bytes[Index] | (Bytes[Index + 1] << 8)));
+            }
+        }
+        else
+        {
+            Text.Reserve(Bytes.Num());
+            for (const uint8 Byte : Bytes)
+            {
+                Text.AppendChar(static_cast<TCHAR>(Byte));
+            }
+        }
+        return Text;
+    }
+
+    bool IsHexRun(const FString& Token)
+    {
+        for (const TCHAR Char : Token)
+        {
+            if (!FChar::IsHexDigit(Char))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Lowercase identifier runs of 2-64 characters; numbers and GUID-like hex runs are dropped */
+    template<typename FunctorType>
+    void ForEachToken(const FString& Text, FunctorType&& Functor)
+    {
+        const int32 Len = Text.Len();
+        int32 TokenStart = INDEX_NONE;
+        for (int32 Index = 0; Index <= Len; ++Index)
+        {
+            const TCHAR Char = Index < Len ? Text[Index] : TEXT('\0');
+            if (Char != TEXT('\0') && (FChar::IsAlnum(Char) || Char == TEXT('_')))
+            {
+                if (TokenStart == INDEX_NONE)
+                {
+                    TokenStart = Index;
+                }
+                continue;
+            }
+            if (TokenStart == INDEX_NONE)
+            {
+                continue;
+            }
+
+            const int32 TokenLen = Index - TokenStart;
+            if (TokenLen >= 2 && TokenLen <= 64)
+            {
+                FString Token = Text.Mid(TokenStart, TokenLen).ToLower();
+                if (!Token.IsNumeric() && !(TokenLen >= 16 && IsHexRun(Token)))
+                {
+                    Functor(MoveTemp(Token));
+                }
+            }
+            TokenStart = INDEX_NONE;
+        }
+    }
+
+    struct FQueryTerm
+    {
+        FString Text;
+        bool bPrefix = false;
+    };
+}
+
+FSpirrowBridgeBlueprintSearchIndex& FSpirrowBridgeBlueprintSearchIndex::Get()
+{
+    static FSpirrowBridgeBlueprintSearchIndex Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::Startup()
+{
+    if (AssetAddedHandle.IsValid())
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FSpirrowBridgeBlueprintSearchIndex::OnAssetAddedOrUpdated);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FSpirrowBridgeBlueprintSearchIndex::OnAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FSpirrowBridgeBlueprintSearchIndex::OnAssetRenamed);
+    AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FSpirrowBridgeBlueprintSearchIndex::OnAssetAddedOrUpdated);
+
+    // Tags are complete only once the initial scan is done
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FSpirrowBridgeBlueprintSearchIndex::OnFilesLoaded);
+    }
+    else
+    {
+        StartBuild();
+    }
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::Shutdown()
+{
+    // The registry may already be gone during editor shutdown
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+        AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+    }
+
+    FilesLoadedHandle.Reset();
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    AssetUpdatedHandle.Reset();
+
+    // The worker runs module code; let it finish before the module can unload
+    if (PendingBuild.IsValid())
+    {
+        PendingBuild.Wait();
+        PendingBuild.Reset();
+    }
+    PendingUpdates.Reset();
+    Index.Reset();
+}
+
+bool FSpirrowBridgeBlueprintSearchIndex::Search(const FString& Query, const FString& PathFilter, int32 Offset, int32 Limit, bool bWait,
+    FSpirrowBlueprintSearchResult& OutResult)
+{
+    OutResult = FSpirrowBlueprintSearchResult();
+
+    // "Print String" means two terms; a trailing * applies to the last token of its word
+    TArray<FQueryTerm> Terms;
+    TArray<FString> Words;
+    Query.ParseIntoArrayWS(Words);
+    for (FString& Word : Words)
+    {
+        const bool bPrefix = Word.RemoveFromEnd(TEXT("*"));
+        const int32 FirstToken = Terms.Num();
+        ForEachToken(Word, [&Terms](FString&& Token) { Terms.Add({ MoveTemp(Token), false }); });
+        if (bPrefix && Terms.Num() > FirstToken)
+        {
+            Terms.Last().bPrefix = true;
+        }
+    }
+    if (Terms.Num() == 0)
+    {
+        return false;
+    }
+
+    AdoptBuild(bWait);
+    OutResult.bIndexing = PendingBuild.IsValid();
+    if (!Index.IsValid())
+    {
+        return true;
+    }
+
+    FIndexData& Data = *Index;
+    OutResult.IndexedCount = Data.DocumentByPath.Num();
+    for (const FDocument& Document : Data.Documents)
+    {
+        OutResult.WithoutSearchDataCount += Document.bLive && !Document.bHasSearchData ? 1 : 0;
+    }
+
+    if (Data.bSortedTokensDirty)
+    {
+        Data.Postings.GenerateKeyArray(Data.SortedTokens);
+        Data.SortedTokens.Sort();
+        Data.bSortedTokensDirty = false;
+    }
+
+    // Intersect the posting lists of all terms
+    TSet<int32> Candidates;
+    for (int32 TermIndex = 0; TermIndex < Terms.Num(); ++TermIndex)
+    {
+        const FQueryTerm& Term = Terms[TermIndex];
+        TSet<int32> TermDocuments;
+        if (Term.bPrefix)
+        {
+            for (int32 TokenIndex = Algo::LowerBound(Data.SortedTokens, Term.Text);
+                TokenIndex < Data.SortedTokens.Num() && Data.SortedTokens[TokenIndex].StartsWith(Term.Text, ESearchCase::CaseSensitive);
+                ++TokenIndex)
+            {
+                TermDocuments.Append(Data.Postings.FindChecked(Data.SortedTokens[TokenIndex]));
+            }
+        }
+        else if (const TArray<int32>* Posting = Data.Postings.Find(Term.Text))
+        {
+            TermDocuments.Append(*Posting);
+        }
+
+        Candidates = TermIndex == 0 ? MoveTemp(TermDocuments) : Candidates.Intersect(TermDocuments);
+        if (Candidates.Num() == 0)
+        {
+            break;
+        }
+    }
+
+    FString RootPath = PathFilter;
+    RootPath.RemoveFromEnd(TEXT("/"));
+    const FString RootPrefix = RootPath + TEXT("/");
+
+    TArray<int32> Matches;
+    Matches.Reserve(Candidates.Num());
+    for (const int32 Slot : Candidates)
+    {
+        const FDocument& Document = Data.Documents[Slot];
+        if (RootPath.IsEmpty() || Document.PackagePath == RootPath || Document.PackagePath.StartsWith(RootPrefix))
+        {
+            Matches.Add(Slot);
+        }
+    }
+    Matches.Sort([&Data](int32 A, int32 B) { return Data.Documents[A].ObjectPath < Data.Documents[B].ObjectPath; });
+    OutResult.Total = Matches.Num();
+
+    const int32 First = FMath::Min(Offset, Matches.Num());
+    const int32 Count = Limit > 0 ? FMath::Min(Limit, Matches.Num() - First) : Matches.Num() - First;
+    OutResult.Hits.Reserve(Count);
+    for (int32 MatchIndex = First; MatchIndex < First + Count; ++MatchIndex)
+    {
+        const FDocument& Document = Data.Documents[Matches[MatchIndex]];
+        FSpirrowBlueprintSearchHit& Hit = OutResult.Hits.AddDefaulted_GetRef();
+        Hit.AssetName = Document.AssetName;
+        Hit.ObjectPath = Document.ObjectPath;
+        Hit.ParentName = Document.ParentName;
+
+        for (const FQueryTerm& Term : Terms)
+        {
+            if (!Term.bPrefix)
+            {
+                Hit.MatchedTokens.AddUnique(Term.Text);
+                continue;
+            }
+            int32 Added = 0;
+            for (int32 TokenIndex = Algo::LowerBound(Document.Tokens, Term.Text);
+                TokenIndex < Document.Tokens.Num() && Added < MaxMatchedTokensPerTerm && Document.Tokens[TokenIndex].StartsWith(Term.Text, ESearchCase::CaseSensitive);
+                ++TokenIndex, ++Added)
+            {
+                Hit.MatchedTokens.AddUnique(Document.Tokens[TokenIndex]);
+            }
+        }
+    }
+    return true;
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::Rebuild()
+{
+    // A running build already reflects the current registry
+    if (PendingBuild.IsValid())
+    {
+        return;
+    }
+    Index.Reset();
+    StartBuild();
+}
+
+TSharedPtr<FSpirrowBridgeBlueprintSearchIndex::FIndexData> FSpirrowBridgeBlueprintSearchIndex::BuildIndex(const TArray<FAssetData>& Assets)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    TSharedPtr<FIndexData> Data = MakeShared<FIndexData>();
+    Data->Documents.Reserve(Assets.Num());
+    Data->DocumentByPath.Reserve(Assets.Num());
+    for (const FAssetData& AssetData : Assets)
+    {
+        FDocument Document;
+        MakeDocument(AssetData, Document);
+        AddDocument(*Data, MoveTemp(Document));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("SpirrowBridge: Indexed %d Blueprints (%d tokens) for search in %.1f ms"),
+        Data->DocumentByPath.Num(), Data->Postings.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return Data;
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::MakeDocument(const FAssetData& AssetData, FDocument& OutDocument)
+{
+    OutDocument.ObjectPath = AssetData.GetObjectPathString();
+    OutDocument.AssetName = AssetData.AssetName.ToString();
+    OutDocument.PackagePath = AssetData.PackagePath.ToString();
+
+    // Tags hold export text paths: /Script/CoreUObject.Class'/Script/Engine.Actor'
+    FString ParentClassPath;
+    if (AssetData.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassPath))
+    {
+        OutDocument.ParentName = FTopLevelAssetPath(FPackageName::ExportTextPathToObjectPath(ParentClassPath)).GetAssetName().ToString();
+    }
+
+    TSet<FString> Tokens;
+    auto AddToken = [&Tokens](FString&& Token) { Tokens.Add(MoveTemp(Token)); };
+
+    FString SearchData;
+    if ((AssetData.GetTagValue(FBlueprintTags::FindInBlueprintsData, SearchData) ||
+         AssetData.GetTagValue(FBlueprintTags::UnversionedFindInBlueprintsData, SearchData)) && !SearchData.IsEmpty())
+    {
+        OutDocument.bHasSearchData = true;
+        ForEachToken(DecodeSearchData(SearchData), AddToken);
+    }
+    ForEachToken(OutDocument.AssetName, AddToken);
+
+    OutDocument.Tokens = Tokens.Array();
+    OutDocument.Tokens.Sort();
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::AddDocument(FIndexData& Data, FDocument&& Document)
+{
+    const int32 Slot = Data.FreeSlots.Num() > 0 ? Data.FreeSlots.Pop() : Data.Documents.AddDefaulted();
+    for (const FString& Token : Document.Tokens)
+    {
+        TArray<int32>& Posting = Data.Postings.FindOrAdd(Token);
+        if (Posting.Num() == 0)
+        {
+            Data.bSortedTokensDirty = true;
+        }
+        Posting.Add(Slot);
+    }
+
+    Document.bLive = true;
+    Data.DocumentByPath.Add(Document.ObjectPath, Slot);
+    Data.Documents[Slot] = MoveTemp(Document);
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::RemoveDocument(FIndexData& Data, const FString& ObjectPath)
+{
+    int32 Slot = INDEX_NONE;
+    if (!Data.DocumentByPath.RemoveAndCopyValue(ObjectPath, Slot))
+    {
+        return;
+    }
+
+    for (const FString& Token : Data.Documents[Slot].Tokens)
+    {
+        if (TArray<int32>* Posting = Data.Postings.Find(Token))
+        {
+            Posting->RemoveSingleSwap(Slot);
+            if (Posting->Num() == 0)
+            {
+                Data.Postings.Remove(Token);
+                Data.bSortedTokensDirty = true;
+            }
+        }
+    }
+    Data.Documents[Slot] = FDocument();
+    Data.FreeSlots.Add(Slot);
+}
+
+bool FSpirrowBridgeBlueprintSearchIndex::IsBlueprintAsset(const FAssetData& AssetData)
+{
+    return AssetData.TagsAndValues.Contains(FBlueprintTags::GeneratedClassPath);
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::StartBuild()
+{
+    // Snapshot on the game thread; tag reads and tokenizing happen on the worker
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), Assets, true);
+
+    PendingUpdates.Reset();
+    PendingBuild = Async(EAsyncExecution::ThreadPool, [Assets = MoveTemp(Assets)]()
+    {
+        return BuildIndex(Assets);
+    });
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::AdoptBuild(bool bWait)
+{
+    if (!PendingBuild.IsValid() || (!bWait && !PendingBuild.IsReady()))
+    {
+        return;
+    }
+
+    Index = PendingBuild.Get();
+    PendingBuild.Reset();
+
+    TSet<FString> Updates = MoveTemp(PendingUpdates);
+    PendingUpdates.Reset();
+    for (const FString& ObjectPath : Updates)
+    {
+        ApplyUpdate(ObjectPath);
+    }
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::QueueUpdate(const FString& ObjectPath)
+{
+    if (PendingBuild.IsValid())
+    {
+        PendingUpdates.Add(ObjectPath);
+    }
+    else if (Index.IsValid())
+    {
+        ApplyUpdate(ObjectPath);
+    }
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::ApplyUpdate(const FString& ObjectPath)
+{
+    if (!Index.IsValid())
+    {
+        return;
+    }
+
+    RemoveDocument(*Index, ObjectPath);
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath));
+    if (AssetData.IsValid() && IsBlueprintAsset(AssetData))
+    {
+        FDocument Document;
+        MakeDocument(AssetData, Document);
+        AddDocument(*Index, MoveTemp(Document));
+    }
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::OnFilesLoaded()
+{
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        AssetRegistryModule->Get().OnFilesLoaded().Remove(FilesLoadedHandle);
+    }
+    FilesLoadedHandle.Reset();
+
+    if (!PendingBuild.IsValid() && !Index.IsValid())
+    {
+        StartBuild();
+    }
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::OnAssetAddedOrUpdated(const FAssetData& AssetData)
+{
+    // Saving a Blueprint refreshes its registry tags, FiB data included
+    if (IsBlueprintAsset(AssetData))
+    {
+        QueueUpdate(AssetData.GetObjectPathString());
+    }
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+    if (!IsBlueprintAsset(AssetData))
+    {
+        return;
+    }
+
+    // The registry may still list the asset while the removal is broadcast
+    const FString ObjectPath = AssetData.GetObjectPathString();
+    if (PendingBuild.IsValid())
+    {
+        PendingUpdates.Add(ObjectPath);
+    }
+    else if (Index.IsValid())
+    {
+        RemoveDocument(*Index, ObjectPath);
+    }
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (IsBlueprintAsset(AssetData))
+    {
+        QueueUpdate(OldObjectPath);
+        QueueUpdate(AssetData.GetObjectPathString());
+    }
+}
@@ -0,0 +1,378 @@
+#include "Commands/SpirrowBridgeClassIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "GameFramework/Actor.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectIterator.h"
+
+FSpirrowBridgeClassIndex& FSpirrowBridgeClassIndex::Get()
+{
+    static FSpirrowBridgeClassIndex Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeClassIndex::Startup()
+{
+    if (ModulesChangedHandle.IsValid())
+    {
+        return;
+    }
+
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FSpirrowBridgeClassIndex::OnModulesChanged);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FSpirrowBridgeClassIndex::OnReloadComplete);
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FSpirrowBridgeClassIndex::OnBlueprintAssetAdded);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FSpirrowBridgeClassIndex::OnBlueprintAssetChanged);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FSpirrowBridgeClassIndex::OnBlueprintAssetRenamed);
+    AssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FSpirrowBridgeClassIndex::OnBlueprintAssetUpdated);
+}
+
+void FSpirrowBridgeClassIndex::Shutdown()
+{
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+
+    // The registry may already be gone during editor shutdown
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+        AssetRegistry.OnAssetUpdated().Remove(AssetUpdatedHandle);
+    }
+
+    ModulesChangedHandle.Reset();
+    ReloadCompleteHandle.Reset();
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    AssetUpdatedHandle.Reset();
+    Invalidate();
+}
+
+UClass* FSpirrowBridgeClassIndex::FindClass(const FString& ClassName, UClass* BaseClass, bool bIncludeBlueprints)
+{
+    if (ClassName.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    // The builders add prefixed and "_C" keys to the name table, so look the name up only after
+    // the index it is searched in exists; a name still missing then cannot be in that index
+    EnsureNativeIndex();
+    FName Key(*ClassName, FNAME_Find);
+    if (const auto* Classes = Key.IsNone() ? nullptr : NativeClasses.Find(Key))
+    {
+        for (const TWeakObjectPtr<UClass>& ClassPtr : *Classes)
+        {
+            UClass* Class = ClassPtr.Get();
+            if (Class && (!BaseClass || Class->IsChildOf(BaseClass)))
+            {
+                return Class;
+            }
+        }
+    }
+
+    if (!bIncludeBlueprints)
+    {
+        return nullptr;
+    }
+
+    EnsureBlueprintIndex();
+    if (Key.IsNone())
+    {
+        Key = FName(*ClassName, FNAME_Find);
+    }
+    if (const auto* Entries = Key.IsNone() ? nullptr : BlueprintClasses.Find(Key))
+    {
+        for (const FBlueprintClassEntry& Entry : *Entries)
+        {
+            if (UClass* Class = LoadBlueprintClass(Entry, BaseClass))
+            {
+                return Class;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void FSpirrowBridgeClassIndex::Invalidate()
+{
+    NativeClasses.Reset();
+    BlueprintClasses.Reset();
+    ActorClassRecords.Reset();
+    BlueprintClassRecords.Reset();
+    MarkNativeDirty();
+    MarkBlueprintsDirty();
+}
+
+void FSpirrowBridgeClassIndex::MarkNativeDirty()
+{
+    bNativeIndexDirty = true;
+    bActorRecordsDirty = true;
+    ++Generation;
+}
+
+void FSpirrowBridgeClassIndex::MarkBlueprintsDirty()
+{
+    bBlueprintIndexDirty = true;
+    bBlueprintRecordsDirty = true;
+    ++Generation;
+}
+
+const TArray<FSpirrowActorClassRecord>& FSpirrowBridgeClassIndex::GetActorClassRecords()
+{
+    if (!bActorRecordsDirty)
+    {
+        return ActorClassRecords;
+    }
+    bActorRecordsDirty = false;
+    ActorClassRecords.Reset();
+
+    static const TSet<FName> EngineModules = {
+        TEXT("Engine"), TEXT("CoreUObject"), TEXT("UMG"), TEXT("AIModule"), TEXT("NavigationSystem"),
+        TEXT("PhysicsCore"), TEXT("EnhancedInput"), TEXT("InputCore")
+    };
+
+    // The UClass hash answers this directly instead of visiting every object
+    TArray<UClass*> Classes;
+    Classes.Add(AActor::StaticClass());
+    GetDerivedClasses(AActor::StaticClass(), Classes, true);
+
+    ActorClassRecords.Reserve(Classes.Num());
+    for (UClass* Class : Classes)
+    {
+        FSpirrowActorClassRecord& Record = ActorClassRecords.AddDefaulted_GetRef();
+        Record.Class = Class;
+        Record.Name = Class->GetName();
+        Record.Path = Class->GetPathName();
+
+        const UPackage* Package = Class->GetOutermost();
+        const FString PackageName = Package->GetName();
+        if (PackageName.StartsWith(TEXT("/Script/")))
+        {
+            Record.Module = FName(*PackageName.RightChop(8));
+        }
+        Record.bEngineModule = EngineModules.Contains(Record.Module);
+        Record.bReinstanced = Record.Name.StartsWith(TEXT("REINST_")) || Package == GetTransientPackage();
+        Record.bGeneratedClass = Record.Name.EndsWith(TEXT("_C"));
+
+        for (const UClass* Super = Class->GetSuperClass(); Super; Super = Super->GetSuperClass())
+        {
+            Record.AncestorNames.Add(Super->GetFName());
+        }
+        if (Record.AncestorNames.Num() > 0)
+        {
+            Record.ParentName = Record.AncestorNames[0].ToString();
+        }
+    }
+    return ActorClassRecords;
+}
+
+const TArray<FSpirrowBlueprintClassRecord>& FSpirrowBridgeClassIndex::GetBlueprintClassRecords()
+{
+    if (!bBlueprintRecordsDirty)
+    {
+        return BlueprintClassRecords;
+    }
+    bBlueprintRecordsDirty = false;
+    BlueprintClassRecords.Reset();
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    TArray<FAssetData> AssetDataList;
+    AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetDataList, true);
+
+    auto GetClassPathTag = [](const FAssetData& AssetData, FName Tag)
+    {
+        FString Value;
+        return AssetData.GetTagValue(Tag, Value)
+            ? FTopLevelAssetPath(FPackageName::ExportTextPathToObjectPath(Value))
+            : FTopLevelAssetPath();
+    };
+
+    TMap<FTopLevelAssetPath, int32> RecordByGeneratedClass;
+    BlueprintClassRecords.Reserve(AssetDataList.Num());
+    for (const FAssetData& AssetData : AssetDataList)
+    {
+        FSpirrowBlueprintClassRecord& Record = BlueprintClassRecords.AddDefaulted_GetRef();
+        Record.AssetName = AssetData.AssetName;
+        Record.ObjectPath = AssetData.GetObjectPathString();
+        Record.PackagePath = AssetData.PackagePath.ToString();
+        Record.GeneratedClassPath = GetClassPathTag(AssetData, FBlueprintTags::GeneratedClassPath);
+        Record.ParentClassPath = GetClassPathTag(AssetData, FBlueprintTags::ParentClassPath);
+        Record.NativeParentClassPath = GetClassPathTag(AssetData, FBlueprintTags::NativeParentClassPath);
+        Record.ParentName = Record.ParentClassPath.GetAssetName().ToString();
+
+        if (Record.GeneratedClassPath.IsValid())
+        {
+            RecordByGeneratedClass.Add(Record.GeneratedClassPath, BlueprintClassRecords.Num() - 1);
+        }
+    }
+
+    // Ancestors: follow Blueprint parents through the other records, then the loaded native chain
+    for (FSpirrowBlueprintClassRecord& Record : BlueprintClassRecords)
+    {
+        FTopLevelAssetPath ParentPath = Record.ParentClassPath;
+        for (int32 Depth = 0; ParentPath.IsValid() && Depth < 64; ++Depth)
+        {
+            Record.AncestorNames.Add(ParentPath.GetAssetName());
+            Record.AncestorPaths.Add(ParentPath);
+            const int32* ParentRecord = RecordByGeneratedClass.Find(ParentPath);
+            if (!ParentRecord)
+            {
+                break;
+            }
+            ParentPath = BlueprintClassRecords[*ParentRecord].ParentClassPath;
+        }
+
+        if (const UClass* NativeParent = FindObject<UClass>(Record.NativeParentClassPath))
+        {
+            for (const UClass* Super = NativeParent; Super; Super = Super->GetSuperClass())
+            {
+                Record.AncestorNames.AddUnique(Super->GetFName());
+                Record.AncestorPaths.AddUnique(Super->GetClassPathName());
+            }
+        }
+    }
+    return BlueprintClassRecords;
+}
+
+void FSpirrowBridgeClassIndex::EnsureNativeIndex()
+{
+    if (!bNativeIndexDirty)
+    {
+        return;
+    }
+    bNativeIndexDirty = false;
+    NativeClasses.Reset();
+
+    const double StartTime = FPlatformTime::Seconds();
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        UClass* Class = *It;
+        if (!Class->HasAnyClassFlags(CLASS_Native) || Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+        {
+            continue;
+        }
+
+        const FString Name = Class->GetName();
+        NativeClasses.FindOrAdd(FName(*Name)).Add(Class);
+        NativeClasses.FindOrAdd(FName(*(FString(Class->GetPrefixCPP()) + Name))).AddUnique(Class);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("SpirrowBridge: Indexed %d native class names in %.1f ms"),
+        NativeClasses.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FSpirrowBridgeClassIndex::EnsureBlueprintIndex()
+{
+    if (!bBlueprintIndexDirty)
+    {
+        return;
+    }
+    bBlueprintIndexDirty = false;
+    BlueprintClasses.Reset();
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    TArray<FAssetData> AssetDataList;
+    AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), AssetDataList, true);
+    for (const FAssetData& AssetData : AssetDataList)
+    {
+        AddBlueprintEntry(AssetData);
+    }
+}
+
+void FSpirrowBridgeClassIndex::AddBlueprintEntry(const FAssetData& AssetData)
+{
+    FBlueprintClassEntry Entry;
+
+    // Tags hold export text paths: /Script/Engine.BlueprintGeneratedClass'/Game/BP_Enemy.BP_Enemy_C'
+    FString GeneratedClassPath;
+    if (AssetData.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassPath))
+    {
+        Entry.GeneratedClassPath = FSoftClassPath(FPackageName::ExportTextPathToObjectPath(GeneratedClassPath));
+    }
+    else
+    {
+        Entry.GeneratedClassPath = FSoftClassPath(AssetData.GetObjectPathString() + TEXT("_C"));
+    }
+
+    FString NativeParentClassPath;
+    if (AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentClassPath))
+    {
+        Entry.NativeParentClassPath = FTopLevelAssetPath(FPackageName::ExportTextPathToObjectPath(NativeParentClassPath));
+    }
+
+    BlueprintClasses.FindOrAdd(AssetData.AssetName).Add(Entry);
+    BlueprintClasses.FindOrAdd(FName(*Entry.GeneratedClassPath.GetAssetName())).Add(Entry);
+}
+
+UClass* FSpirrowBridgeClassIndex::LoadBlueprintClass(const FBlueprintClassEntry& Entry, UClass* BaseClass)
+{
+    // Reject by native parent before loading the Blueprint
+    if (BaseClass && BaseClass->HasAnyClassFlags(CLASS_Native) && !Entry.NativeParentClassPath.IsNull())
+    {
+        const UClass* NativeParent = FindObject<UClass>(Entry.NativeParentClassPath);
+        if (NativeParent && !NativeParent->IsChildOf(BaseClass))
+        {
+            return nullptr;
+        }
+    }
+
+    UClass* Class = Entry.GeneratedClassPath.TryLoadClass<UObject>();
+    return Class && (!BaseClass || Class->IsChildOf(BaseClass)) ? Class : nullptr;
+}
+
+void FSpirrowBridgeClassIndex::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    if (Reason == EModuleChangeReason::ModuleLoaded)
+    {
+        MarkNativeDirty();
+    }
+}
+
+void FSpirrowBridgeClassIndex::OnReloadComplete(EReloadCompleteReason Reason)
+{
+    MarkNativeDirty();
+    MarkBlueprintsDirty();
+}
+
+void FSpirrowBridgeClassIndex::OnBlueprintAssetAdded(const FAssetData& AssetData)
+{
+    // New Blueprints extend a built name index in place; removals and renames rebuild it
+    if (AssetData.TagsAndValues.Contains(FBlueprintTags::GeneratedClassPath))
+    {
+        if (!bBlueprintIndexDirty)
+        {
+            AddBlueprintEntry(AssetData);
+        }
+        bBlueprintRecordsDirty = true;
+        ++Generation;
+    }
+}
+
+void FSpirrowBridgeClassIndex::OnBlueprintAssetChanged(const FAssetData& AssetData)
+{
+    if (AssetData.TagsAndValues.Contains(FBlueprintTags::GeneratedClassPath))
+    {
+        MarkBlueprintsDirty();
+    }
+}
+
+void FSpirrowBridgeClassIndex::OnBlueprintAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    OnBlueprintAssetChanged(AssetData);
+}
+
+void FSpirrowBridgeClassIndex::OnBlueprintAssetUpdated(const FAssetData& AssetData)
+{
+    // A saved Blueprint may have been reparented; only the scan records depend on parents
+    if (AssetData.TagsAndValues.Contains(FBlueprintTags::GeneratedClassPath))
+    {
+        bBlueprintRecordsDirty = true;
+        ++Generation;
+    }
+}
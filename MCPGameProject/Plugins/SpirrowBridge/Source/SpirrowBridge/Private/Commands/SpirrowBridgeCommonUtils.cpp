@@ -1,4 +1,6 @@
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgePropertyPathCache.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Blueprint.h"
 #include "WidgetBlueprint.h"
@@ -17,6 +19,7 @@
 #include "Components/LightComponent.h"
 #include "Components/PrimitiveComponent.h"
 #include "Components/SceneComponent.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
 #include "UObject/UObjectIterator.h"
 #include "Engine/Selection.h"
 #include "EditorAssetLibrary.h"
@@ -180,16 +183,8 @@ UBlueprint* FSpirrowBridgeCommonUtils::FindBlueprint(const FString& BlueprintNam
 
 UBlueprint* FSpirrowBridgeCommonUtils::FindBlueprintByName(const FString& BlueprintName, const FString& Path)
 {
-    // Normalize path to ensure it ends with /
-    FString NormalizedPath = Path;
-    if (!NormalizedPath.EndsWith(TEXT("/")))
-    {
-        NormalizedPath += TEXT("/");
-    }
-
-    // Construct asset path: /Path/BlueprintName.BlueprintName
-    FString AssetPath = FString::Printf(TEXT("%s%s.%s"), *NormalizedPath, *BlueprintName, *BlueprintName);
-    return LoadObject<UBlueprint>(nullptr, *AssetPath);
+    // Cached by (name, path); the resolver builds /Path/BlueprintName.BlueprintName on a miss
+    return FSpirrowBridgeAssetResolver::Get().Resolve<UBlueprint>(BlueprintName, Path);
 }
 
 UEdGraph* FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(UBlueprint* Blueprint)
@@ -523,6 +518,64 @@ TSharedPtr<FJsonObject> FSpirrowBridgeCommonUtils::ActorToJsonObject(AActor* Act
     return ActorObject;
 }
 
+TSharedPtr<FJsonValue> FSpirrowBridgeCommonUtils::ActorDescToJson(const FWorldPartitionActorDescInstance* ActorDesc)
+{
+    if (!ActorDesc)
+    {
+        return MakeShared<FJsonValueNull>();
+    }
+
+    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
+    ActorObject->SetStringField(TEXT("name"), ActorDesc->GetActorName().ToString());
+    ActorObject->SetStringField(TEXT("label"), ActorDesc->GetActorLabel().ToString());
+
+    // Blueprint actors report their generated class, native actors their C++ class
+    const FTopLevelAssetPath BaseClass = ActorDesc->GetBaseClass();
+    const UClass* NativeClass = ActorDesc->GetActorNativeClass();
+    ActorObject->SetStringField(TEXT("class"), BaseClass.IsValid()
+        ? BaseClass.GetAssetName().ToString()
+        : (NativeClass ? NativeClass->GetName() : FString()));
+
+    ActorObject->SetStringField(TEXT("guid"), ActorDesc->GetGuid().ToString());
+    ActorObject->SetStringField(TEXT("package"), ActorDesc->GetActorPackage().ToString());
+    ActorObject->SetBoolField(TEXT("loaded"), ActorDesc->IsLoaded());
+    ActorObject->SetBoolField(TEXT("spatially_loaded"), ActorDesc->GetIsSpatiallyLoaded());
+    ActorObject->SetStringField(TEXT("runtime_grid"), ActorDesc->GetRuntimeGrid().ToString());
+
+    // Descriptors carry bounds but no transform; the bounds center stands in for the location
+    const FBox Bounds = ActorDesc->GetEditorBounds();
+    TArray<TSharedPtr<FJsonValue>> LocationArray;
+    TArray<TSharedPtr<FJsonValue>> MinArray;
+    TArray<TSharedPtr<FJsonValue>> MaxArray;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        LocationArray.Add(MakeShared<FJsonValueNumber>(Bounds.GetCenter()[Axis]));
+        MinArray.Add(MakeShared<FJsonValueNumber>(Bounds.Min[Axis]));
+        MaxArray.Add(MakeShared<FJsonValueNumber>(Bounds.Max[Axis]));
+    }
+    ActorObject->SetArrayField(TEXT("location"), LocationArray);
+    TSharedPtr<FJsonObject> BoundsObject = MakeShared<FJsonObject>();
+    BoundsObject->SetArrayField(TEXT("min"), MinArray);
+    BoundsObject->SetArrayField(TEXT("max"), MaxArray);
+    ActorObject->SetObjectField(TEXT("bounds"), BoundsObject);
+
+    TArray<TSharedPtr<FJsonValue>> DataLayerArray;
+    for (const FName& DataLayer : ActorDesc->GetDataLayerInstanceNames().ToArray())
+    {
+        DataLayerArray.Add(MakeShared<FJsonValueString>(DataLayer.ToString()));
+    }
+    ActorObject->SetArrayField(TEXT("data_layers"), DataLayerArray);
+
+    TArray<TSharedPtr<FJsonValue>> ReferenceArray;
+    for (const FGuid& Reference : ActorDesc->GetReferences())
+    {
+        ReferenceArray.Add(MakeShared<FJsonValueString>(Reference.ToString()));
+    }
+    ActorObject->SetArrayField(TEXT("references"), ReferenceArray);
+
+    return MakeShared<FJsonValueObject>(ActorObject);
+}
+
 UK2Node_Event* FSpirrowBridgeCommonUtils::FindExistingEventNode(UEdGraph* Graph, const FString& EventName)
 {
     if (!Graph)
@@ -544,487 +597,517 @@ UK2Node_Event* FSpirrowBridgeCommonUtils::FindExistingEventNode(UEdGraph* Graph,
     return nullptr;
 }
 
-bool FSpirrowBridgeCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName, 
-                                     const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+// ============================================
+// Property setters
+// One function per property type, picked once per property path by GetPropertySetter
+// ============================================
+
+namespace
 {
-    if (!Object)
+    bool IsNullReference(const FString& Path)
     {
-        OutErrorMessage = TEXT("Invalid object");
-        return false;
+        return Path.IsEmpty() ||
+            Path.Equals(TEXT("None"), ESearchCase::IgnoreCase) ||
+            Path.Equals(TEXT("nullptr"), ESearchCase::IgnoreCase) ||
+            Path.Equals(TEXT("null"), ESearchCase::IgnoreCase);
     }
 
-    // Search through class hierarchy for the property
-    FProperty* Property = nullptr;
-    UClass* CurrentClass = Object->GetClass();
-
-    while (CurrentClass && !Property)
+    /** Enum value from a number, a numeric string, "Value" or "EEnum::Value" */
+    bool ResolveEnumValue(UEnum* EnumDef, const TSharedPtr<FJsonValue>& Value, const FString& PropertyPath,
+                          int64& OutValue, FString& OutErrorMessage)
     {
-        Property = CurrentClass->FindPropertyByName(*PropertyName);
-        if (!Property)
+        if (Value->Type == EJson::Number)
         {
-            CurrentClass = CurrentClass->GetSuperClass();
+            OutValue = static_cast<int64>(Value->AsNumber());
+            UE_LOG(LogTemp, Verbose, TEXT("Setting enum property %s to numeric value: %lld"), *PropertyPath, OutValue);
+            return true;
         }
-    }
-
-    if (!Property)
-    {
-        // Log available properties for debugging
-        UE_LOG(LogTemp, Warning, TEXT("SetObjectProperty - Property '%s' not found. Available properties:"), *PropertyName);
-        for (TFieldIterator<FProperty> PropIt(Object->GetClass()); PropIt; ++PropIt)
+        if (Value->Type != EJson::String)
         {
-            UE_LOG(LogTemp, Warning, TEXT("  - %s (%s)"), *PropIt->GetName(), *PropIt->GetCPPType());
+            OutErrorMessage = FString::Printf(TEXT("Enum property %s requires a number or string value"), *PropertyPath);
+            return false;
         }
-        OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
-        return false;
-    }
 
-    void* PropertyAddr = Property->ContainerPtrToValuePtr<void>(Object);
-    
-    // Handle different property types
-    if (Property->IsA<FBoolProperty>())
-    {
-        ((FBoolProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsBool());
-        return true;
-    }
-    else if (Property->IsA<FIntProperty>())
-    {
-        int32 IntValue = static_cast<int32>(Value->AsNumber());
-        FIntProperty* IntProperty = CastField<FIntProperty>(Property);
-        if (IntProperty)
+        FString EnumValueName = Value->AsString();
+
+        // Try to convert numeric string to number first
+        if (EnumValueName.IsNumeric())
         {
-            IntProperty->SetPropertyValue_InContainer(Object, IntValue);
+            OutValue = FCString::Atoi64(*EnumValueName);
+            UE_LOG(LogTemp, Verbose, TEXT("Setting enum property %s to numeric string value: %s -> %lld"),
+                  *PropertyPath, *EnumValueName, OutValue);
             return true;
         }
-    }
-    else if (Property->IsA<FFloatProperty>())
-    {
-        ((FFloatProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsNumber());
-        return true;
-    }
-    else if (Property->IsA<FStrProperty>())
-    {
-        ((FStrProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsString());
+
+        // Handle qualified enum names (e.g., "Player0" or "EAutoReceiveInput::Player0")
+        if (EnumValueName.Contains(TEXT("::")))
+        {
+            EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
+        }
+
+        int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
+        if (EnumValue == INDEX_NONE)
+        {
+            // Try with full name as fallback
+            EnumValue = EnumDef->GetValueByNameString(Value->AsString());
+        }
+
+        if (EnumValue == INDEX_NONE)
+        {
+            // Log all possible enum values for debugging
+            UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
+            for (int32 i = 0; i < EnumDef->NumEnums(); i++)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %lld)"),
+                       *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
+            }
+
+            OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
+            return false;
+        }
+
+        OutValue = EnumValue;
+        UE_LOG(LogTemp, Verbose, TEXT("Setting enum property %s to name value: %s -> %lld"),
+              *PropertyPath, *EnumValueName, EnumValue);
         return true;
     }
-    else if (Property->IsA<FByteProperty>())
+
+    /** Load an asset by object path, retrying "/Path/Asset" as "/Path/Asset.Asset" */
+    UObject* LoadAssetWithFallback(const FString& AssetPath)
     {
-        FByteProperty* ByteProp = CastField<FByteProperty>(Property);
-        UEnum* EnumDef = ByteProp ? ByteProp->GetIntPropertyEnum() : nullptr;
-        
-        // If this is a TEnumAsByte property (has associated enum)
-        if (EnumDef)
+        UObject* LoadedAsset = UEditorAssetLibrary::LoadAsset(AssetPath);
+        if (!LoadedAsset && !AssetPath.Contains(TEXT(".")))
         {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
+            FString AssetName = FPaths::GetCleanFilename(AssetPath);
+            FString AlternativePath = AssetPath + TEXT(".") + AssetName;
+            LoadedAsset = UEditorAssetLibrary::LoadAsset(AlternativePath);
+
+            if (LoadedAsset)
             {
-                uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-                ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %d"), 
-                      *PropertyName, ByteValue);
-                return true;
+                UE_LOG(LogTemp, Verbose, TEXT("Loaded asset via alternative path: %s"), *AlternativePath);
             }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
+        }
+        return LoadedAsset;
+    }
+
+    /** ImportText form of a JSON value: arrays become "(a,b)", objects "(Key=Value,...)" */
+    bool JsonValueToImportText(const TSharedPtr<FJsonValue>& Value, FString& OutText, bool bQuoteStrings = false)
+    {
+        switch (Value->Type)
+        {
+        case EJson::String:
+            OutText = bQuoteStrings ? FString::Printf(TEXT("\"%s\""), *Value->AsString().ReplaceCharWithEscapedChar()) : Value->AsString();
+            return true;
+        case EJson::Number:
+        {
+            const double Number = Value->AsNumber();
+            OutText = (Number == FMath::RoundToDouble(Number) && FMath::Abs(Number) < 9.0e15)
+                ? FString::Printf(TEXT("%lld"), static_cast<int64>(Number))
+                : FString::SanitizeFloat(Number);
+            return true;
+        }
+        case EJson::Boolean:
+            OutText = Value->AsBool() ? TEXT("True") : TEXT("False");
+            return true;
+        case EJson::Null:
+            OutText = TEXT("None");
+            return true;
+        case EJson::Array:
+        {
+            TArray<FString> Elements;
+            for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
             {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    uint8 ByteValue = FCString::Atoi(*EnumValueName);
-                    ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %d"), 
-                          *PropertyName, *EnumValueName, ByteValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names (e.g., "Player0" or "EAutoReceiveInput::Player0")
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
-                {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
-                }
-                
-                if (EnumValue != INDEX_NONE)
+                if (!JsonValueToImportText(Element, Elements.AddDefaulted_GetRef(), true))
                 {
-                    ByteProp->SetPropertyValue(PropertyAddr, static_cast<uint8>(EnumValue));
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                else
-                {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
                     return false;
                 }
             }
-        }
-        else
-        {
-            // Regular byte property
-            uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-            ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
+            OutText = TEXT("(") + FString::Join(Elements, TEXT(",")) + TEXT(")");
             return true;
         }
-    }
-    else if (Property->IsA<FEnumProperty>())
-    {
-        FEnumProperty* EnumProp = CastField<FEnumProperty>(Property);
-        UEnum* EnumDef = EnumProp ? EnumProp->GetEnum() : nullptr;
-        FNumericProperty* UnderlyingNumericProp = EnumProp ? EnumProp->GetUnderlyingProperty() : nullptr;
-        
-        if (EnumDef && UnderlyingNumericProp)
+        case EJson::Object:
         {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
+            TArray<FString> Fields;
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Value->AsObject()->Values)
             {
-                int64 EnumValue = static_cast<int64>(Value->AsNumber());
-                UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %lld"), 
-                      *PropertyName, EnumValue);
-                return true;
-            }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
-            {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    int64 EnumValue = FCString::Atoi64(*EnumValueName);
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
-                {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
-                }
-                
-                if (EnumValue != INDEX_NONE)
-                {
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                else
+                FString FieldText;
+                if (!JsonValueToImportText(Field.Value, FieldText, true))
                 {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
                     return false;
                 }
+                Fields.Add(Field.Key + TEXT("=") + FieldText);
             }
+            OutText = TEXT("(") + FString::Join(Fields, TEXT(",")) + TEXT(")");
+            return true;
+        }
+        default:
+            return false;
         }
     }
-    // IMPORTANT: Check derived classes BEFORE base classes to avoid incorrect type matching
-    // FClassProperty and FSoftObjectProperty are derived from FObjectProperty
-    else if (FClassProperty* ClassProp = CastField<FClassProperty>(Property))
+
+    bool SetBoolValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                      const FString& PropertyPath, FString& OutErrorMessage)
     {
-        // Handle class reference properties (TSubclassOf<T>) - MUST CHECK BEFORE FObjectProperty
-        if (Value->Type == EJson::String)
+        static_cast<FBoolProperty*>(Property)->SetPropertyValue(ValueAddr, Value->AsBool());
+        return true;
+    }
+
+    bool SetNumericValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                         const FString& PropertyPath, FString& OutErrorMessage)
+    {
+        FNumericProperty* NumericProp = static_cast<FNumericProperty*>(Property);
+        if (NumericProp->IsFloatingPoint())
+        {
+            NumericProp->SetFloatingPointPropertyValue(ValueAddr, Value->AsNumber());
+        }
+        else
         {
-            FString ClassPath = Value->AsString();
+            NumericProp->SetIntPropertyValue(ValueAddr, static_cast<int64>(Value->AsNumber()));
+        }
+        return true;
+    }
+
+    bool SetByteValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                      const FString& PropertyPath, FString& OutErrorMessage)
+    {
+        FByteProperty* ByteProp = static_cast<FByteProperty*>(Property);
 
-            // ★ Handle None/empty/nullptr as null value ★
-            if (ClassPath.IsEmpty() ||
-                ClassPath.Equals(TEXT("None"), ESearchCase::IgnoreCase) ||
-                ClassPath.Equals(TEXT("nullptr"), ESearchCase::IgnoreCase) ||
-                ClassPath.Equals(TEXT("null"), ESearchCase::IgnoreCase))
+        // TEnumAsByte properties carry their enum
+        if (UEnum* EnumDef = ByteProp->GetIntPropertyEnum())
+        {
+            int64 EnumValue = 0;
+            if (!ResolveEnumValue(EnumDef, Value, PropertyPath, EnumValue, OutErrorMessage))
             {
-                ClassProp->SetObjectPropertyValue(PropertyAddr, nullptr);
-                UE_LOG(LogTemp, Display, TEXT("Set class property %s to null (value: '%s')"), *PropertyName, *ClassPath);
-                return true;
+                return false;
             }
+            ByteProp->SetPropertyValue(ValueAddr, static_cast<uint8>(EnumValue));
+            return true;
+        }
 
-            UClass* LoadedClass = nullptr;
+        // Regular byte property
+        ByteProp->SetPropertyValue(ValueAddr, static_cast<uint8>(Value->AsNumber()));
+        return true;
+    }
 
-            // Method 1: Try LoadClass for C++ classes (e.g., "/Script/Engine.Character")
-            LoadedClass = LoadClass<UObject>(nullptr, *ClassPath);
+    bool SetEnumValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                      const FString& PropertyPath, FString& OutErrorMessage)
+    {
+        FEnumProperty* EnumProp = static_cast<FEnumProperty*>(Property);
+        UEnum* EnumDef = EnumProp->GetEnum();
+        FNumericProperty* UnderlyingNumericProp = EnumProp->GetUnderlyingProperty();
+        if (!EnumDef || !UnderlyingNumericProp)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Enum property %s has no enum definition"), *PropertyPath);
+            return false;
+        }
 
-            // Method 2: If LoadClass failed, try loading as Blueprint asset
-            if (!LoadedClass)
-            {
-                UObject* LoadedAsset = UEditorAssetLibrary::LoadAsset(ClassPath);
+        int64 EnumValue = 0;
+        if (!ResolveEnumValue(EnumDef, Value, PropertyPath, EnumValue, OutErrorMessage))
+        {
+            return false;
+        }
+        UnderlyingNumericProp->SetIntPropertyValue(ValueAddr, EnumValue);
+        return true;
+    }
 
-                if (LoadedAsset)
-                {
-                    // Check if it's a Blueprint asset
-                    UBlueprint* Blueprint = Cast<UBlueprint>(LoadedAsset);
-                    if (Blueprint && Blueprint->GeneratedClass)
-                    {
-                        LoadedClass = Blueprint->GeneratedClass;
-                        UE_LOG(LogTemp, Display, TEXT("Loaded Blueprint class: %s -> %s"),
-                               *ClassPath, *LoadedClass->GetName());
-                    }
-                    // Check if it's already a UClass (loaded via different path)
-                    else if (UClass* DirectClass = Cast<UClass>(LoadedAsset))
-                    {
-                        LoadedClass = DirectClass;
-                        UE_LOG(LogTemp, Display, TEXT("Loaded class directly: %s"), *ClassPath);
-                    }
-                }
-            }
+    bool SetStrValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                     const FString& PropertyPath, FString& OutErrorMessage)
+    {
+        static_cast<FStrProperty*>(Property)->SetPropertyValue(ValueAddr, Value->AsString());
+        return true;
+    }
 
-            // Method 3: Try alternative path format (without .AssetName suffix)
-            if (!LoadedClass && !ClassPath.Contains(TEXT(".")))
-            {
-                FString AssetName = FPaths::GetCleanFilename(ClassPath);
-                FString AlternativePath = ClassPath + TEXT(".") + AssetName;
+    bool SetNameValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                      const FString& PropertyPath, FString& OutErrorMessage)
+    {
+        if (Value->Type != EJson::String)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Name property %s requires a string value"), *PropertyPath);
+            return false;
+        }
 
-                UObject* LoadedAsset = UEditorAssetLibrary::LoadAsset(AlternativePath);
-                if (LoadedAsset)
-                {
-                    UBlueprint* Blueprint = Cast<UBlueprint>(LoadedAsset);
-                    if (Blueprint && Blueprint->GeneratedClass)
-                    {
-                        LoadedClass = Blueprint->GeneratedClass;
-                        UE_LOG(LogTemp, Display, TEXT("Loaded Blueprint class via alternative path: %s -> %s"),
-                               *AlternativePath, *LoadedClass->GetName());
-                    }
-                }
-            }
+        FName NameValue = FName(*Value->AsString());
+        static_cast<FNameProperty*>(Property)->SetPropertyValue(ValueAddr, NameValue);
+        UE_LOG(LogTemp, Verbose, TEXT("Set name property %s to: %s"), *PropertyPath, *NameValue.ToString());
+        return true;
+    }
 
-            if (LoadedClass)
-            {
-                // Verify the class is compatible with the property's meta class
-                UClass* MetaClass = ClassProp->MetaClass;
-                if (LoadedClass->IsChildOf(MetaClass))
-                {
-                    ClassProp->SetObjectPropertyValue(PropertyAddr, LoadedClass);
-                    UE_LOG(LogTemp, Display, TEXT("Set class property %s to: %s (MetaClass: %s)"),
-                           *PropertyName, *LoadedClass->GetName(), *MetaClass->GetName());
-                    return true;
-                }
-                else
-                {
-                    OutErrorMessage = FString::Printf(
-                        TEXT("Class type mismatch for property %s: Expected child of %s, got %s"),
-                        *PropertyName,
-                        *MetaClass->GetName(),
-                        *LoadedClass->GetName()
-                    );
-                    return false;
-                }
-            }
-            else
-            {
-                OutErrorMessage = FString::Printf(TEXT("Failed to load class: %s"), *ClassPath);
-                return false;
-            }
-        }
-        else if (Value->Type == EJson::Null)
+    bool SetTextValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                      const FString& PropertyPath, FString& OutErrorMessage)
+    {
+        static_cast<FTextProperty*>(Property)->SetPropertyValue(ValueAddr, FText::FromString(Value->AsString()));
+        return true;
+    }
+
+    bool SetClassValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                       const FString& PropertyPath, FString& OutErrorMessage)
+    {
+        FClassProperty* ClassProp = static_cast<FClassProperty*>(Property);
+
+        if (Value->Type == EJson::Null)
         {
-            ClassProp->SetObjectPropertyValue(PropertyAddr, nullptr);
-            UE_LOG(LogTemp, Display, TEXT("Set class property %s to null"), *PropertyName);
+            ClassProp->SetObjectPropertyValue(ValueAddr, nullptr);
+            UE_LOG(LogTemp, Verbose, TEXT("Set class property %s to null"), *PropertyPath);
             return true;
         }
-        else
+        if (Value->Type != EJson::String)
         {
             OutErrorMessage = FString::Printf(
                 TEXT("Class property %s requires a string (class path) or null value"),
-                *PropertyName
+                *PropertyPath
             );
             return false;
         }
-    }
-    else if (FSoftObjectProperty* SoftObjectProp = CastField<FSoftObjectProperty>(Property))
-    {
-        // Handle soft object reference properties (TSoftObjectPtr<T>) - CHECK BEFORE FObjectProperty
-        if (Value->Type == EJson::String)
+
+        FString ClassPath = Value->AsString();
+
+        // ★ Handle None/empty/nullptr as null value ★
+        if (IsNullReference(ClassPath))
+        {
+            ClassProp->SetObjectPropertyValue(ValueAddr, nullptr);
+            UE_LOG(LogTemp, Verbose, TEXT("Set class property %s to null (value: '%s')"), *PropertyPath, *ClassPath);
+            return true;
+        }
+
+        // Method 1: Try LoadClass for C++ classes (e.g., "/Script/Engine.Character")
+        UClass* LoadedClass = LoadClass<UObject>(nullptr, *ClassPath);
+
+        // Method 2: If LoadClass failed, try loading as Blueprint asset (also "/Path/BP" as "/Path/BP.BP")
+        if (!LoadedClass)
         {
-            FString AssetPath = Value->AsString();
+            UObject* LoadedAsset = LoadAssetWithFallback(ClassPath);
 
-            // ★ Handle None/empty/nullptr as null value ★
-            if (AssetPath.IsEmpty() ||
-                AssetPath.Equals(TEXT("None"), ESearchCase::IgnoreCase) ||
-                AssetPath.Equals(TEXT("nullptr"), ESearchCase::IgnoreCase) ||
-                AssetPath.Equals(TEXT("null"), ESearchCase::IgnoreCase))
+            // Check if it's a Blueprint asset
+            UBlueprint* Blueprint = Cast<UBlueprint>(LoadedAsset);
+            if (Blueprint && Blueprint->GeneratedClass)
             {
-                FSoftObjectPtr NullPtr;
-                SoftObjectProp->SetPropertyValue(PropertyAddr, NullPtr);
-                UE_LOG(LogTemp, Display, TEXT("Set soft object property %s to null (value: '%s')"), *PropertyName, *AssetPath);
-                return true;
+                LoadedClass = Blueprint->GeneratedClass;
+                UE_LOG(LogTemp, Verbose, TEXT("Loaded Blueprint class: %s -> %s"),
+                       *ClassPath, *LoadedClass->GetName());
             }
+            // Check if it's already a UClass (loaded via different path)
+            else if (UClass* DirectClass = Cast<UClass>(LoadedAsset))
+            {
+                LoadedClass = DirectClass;
+                UE_LOG(LogTemp, Verbose, TEXT("Loaded class directly: %s"), *ClassPath);
+            }
+        }
 
-            // Create soft object path and set it
-            FSoftObjectPath TempPath(AssetPath);
-            FSoftObjectPtr SoftPtr(TempPath);
-            SoftObjectProp->SetPropertyValue(PropertyAddr, SoftPtr);
+        if (!LoadedClass)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Failed to load class: %s"), *ClassPath);
+            return false;
+        }
 
-            UE_LOG(LogTemp, Display, TEXT("Set soft object property %s to: %s"),
-                   *PropertyName, *AssetPath);
-            return true;
+        // Verify the class is compatible with the property's meta class
+        UClass* MetaClass = ClassProp->MetaClass;
+        if (!LoadedClass->IsChildOf(MetaClass))
+        {
+            OutErrorMessage = FString::Printf(
+                TEXT("Class type mismatch for property %s: Expected child of %s, got %s"),
+                *PropertyPath,
+                *MetaClass->GetName(),
+                *LoadedClass->GetName()
+            );
+            return false;
         }
-        else if (Value->Type == EJson::Null)
+
+        ClassProp->SetObjectPropertyValue(ValueAddr, LoadedClass);
+        UE_LOG(LogTemp, Verbose, TEXT("Set class property %s to: %s (MetaClass: %s)"),
+               *PropertyPath, *LoadedClass->GetName(), *MetaClass->GetName());
+        return true;
+    }
+
+    bool SetSoftObjectValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                            const FString& PropertyPath, FString& OutErrorMessage)
+    {
+        FSoftObjectProperty* SoftObjectProp = static_cast<FSoftObjectProperty*>(Property);
+
+        if (Value->Type == EJson::Null)
         {
-            FSoftObjectPtr NullPtr;
-            SoftObjectProp->SetPropertyValue(PropertyAddr, NullPtr);
-            UE_LOG(LogTemp, Display, TEXT("Set soft object property %s to null"), *PropertyName);
+            SoftObjectProp->SetPropertyValue(ValueAddr, FSoftObjectPtr());
+            UE_LOG(LogTemp, Verbose, TEXT("Set soft object property %s to null"), *PropertyPath);
             return true;
         }
-        else
+        if (Value->Type != EJson::String)
         {
             OutErrorMessage = FString::Printf(
                 TEXT("Soft object property %s requires a string (asset path) or null value"),
-                *PropertyName
+                *PropertyPath
             );
             return false;
         }
-    }
-    else if (FObjectProperty* ObjectProp = CastField<FObjectProperty>(Property))
-    {
-        // Handle object reference properties (TObjectPtr<T>) - CHECK LAST (base class)
-        if (Value->Type == EJson::String)
-        {
-            FString AssetPath = Value->AsString();
 
-            // ★ Handle None/empty/nullptr as null value ★
-            if (AssetPath.IsEmpty() ||
-                AssetPath.Equals(TEXT("None"), ESearchCase::IgnoreCase) ||
-                AssetPath.Equals(TEXT("nullptr"), ESearchCase::IgnoreCase) ||
-                AssetPath.Equals(TEXT("null"), ESearchCase::IgnoreCase))
-            {
-                ObjectProp->SetObjectPropertyValue(PropertyAddr, nullptr);
-                UE_LOG(LogTemp, Display, TEXT("Set object property %s to null (value: '%s')"), *PropertyName, *AssetPath);
-                return true;
-            }
+        FString AssetPath = Value->AsString();
 
-            // Try to load the asset
-            UObject* LoadedAsset = UEditorAssetLibrary::LoadAsset(AssetPath);
+        // ★ Handle None/empty/nullptr as null value ★
+        if (IsNullReference(AssetPath))
+        {
+            SoftObjectProp->SetPropertyValue(ValueAddr, FSoftObjectPtr());
+            UE_LOG(LogTemp, Verbose, TEXT("Set soft object property %s to null (value: '%s')"), *PropertyPath, *AssetPath);
+            return true;
+        }
 
-            // If loading failed and path doesn't contain a dot, try alternative format
-            if (!LoadedAsset && !AssetPath.Contains(TEXT(".")))
-            {
-                FString AssetName = FPaths::GetCleanFilename(AssetPath);
-                FString AlternativePath = AssetPath + TEXT(".") + AssetName;
-                LoadedAsset = UEditorAssetLibrary::LoadAsset(AlternativePath);
+        // Create soft object path and set it
+        SoftObjectProp->SetPropertyValue(ValueAddr, FSoftObjectPtr(FSoftObjectPath(AssetPath)));
+        UE_LOG(LogTemp, Verbose, TEXT("Set soft object property %s to: %s"), *PropertyPath, *AssetPath);
+        return true;
+    }
 
-                if (LoadedAsset)
-                {
-                    UE_LOG(LogTemp, Display, TEXT("Loaded asset via alternative path: %s"), *AlternativePath);
-                }
-            }
+    bool SetObjectValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                        const FString& PropertyPath, FString& OutErrorMessage)
+    {
+        FObjectProperty* ObjectProp = static_cast<FObjectProperty*>(Property);
 
-            if (LoadedAsset)
-            {
-                // Verify the loaded asset is compatible with the property's expected class
-                UClass* ExpectedClass = ObjectProp->PropertyClass;
-                if (LoadedAsset->IsA(ExpectedClass))
-                {
-                    ObjectProp->SetObjectPropertyValue(PropertyAddr, LoadedAsset);
-                    UE_LOG(LogTemp, Display, TEXT("Set object property %s to: %s (Class: %s)"),
-                           *PropertyName, *LoadedAsset->GetName(), *ExpectedClass->GetName());
-                    return true;
-                }
-                else
-                {
-                    OutErrorMessage = FString::Printf(
-                        TEXT("Asset type mismatch for property %s: Expected %s, got %s"),
-                        *PropertyName,
-                        *ExpectedClass->GetName(),
-                        *LoadedAsset->GetClass()->GetName()
-                    );
-                    return false;
-                }
-            }
-            else
-            {
-                OutErrorMessage = FString::Printf(TEXT("Failed to load asset: %s"), *AssetPath);
-                return false;
-            }
-        }
-        else if (Value->Type == EJson::Null)
+        if (Value->Type == EJson::Null)
         {
-            ObjectProp->SetObjectPropertyValue(PropertyAddr, nullptr);
-            UE_LOG(LogTemp, Display, TEXT("Set object property %s to null"), *PropertyName);
+            ObjectProp->SetObjectPropertyValue(ValueAddr, nullptr);
+            UE_LOG(LogTemp, Verbose, TEXT("Set object property %s to null"), *PropertyPath);
             return true;
         }
-        else
+        if (Value->Type != EJson::String)
         {
             OutErrorMessage = FString::Printf(
                 TEXT("Object property %s requires a string (asset path) or null value"),
-                *PropertyName
+                *PropertyPath
             );
             return false;
         }
+
+        FString AssetPath = Value->AsString();
+
+        // ★ Handle None/empty/nullptr as null value ★
+        if (IsNullReference(AssetPath))
+        {
+            ObjectProp->SetObjectPropertyValue(ValueAddr, nullptr);
+            UE_LOG(LogTemp, Verbose, TEXT("Set object property %s to null (value: '%s')"), *PropertyPath, *AssetPath);
+            return true;
+        }
+
+        UObject* LoadedAsset = LoadAssetWithFallback(AssetPath);
+        if (!LoadedAsset)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Failed to load asset: %s"), *AssetPath);
+            return false;
+        }
+
+        // Verify the loaded asset is compatible with the property's expected class
+        UClass* ExpectedClass = ObjectProp->PropertyClass;
+        if (!LoadedAsset->IsA(ExpectedClass))
+        {
+            OutErrorMessage = FString::Printf(
+                TEXT("Asset type mismatch for property %s: Expected %s, got %s"),
+                *PropertyPath,
+                *ExpectedClass->GetName(),
+                *LoadedAsset->GetClass()->GetName()
+            );
+            return false;
+        }
+
+        ObjectProp->SetObjectPropertyValue(ValueAddr, LoadedAsset);
+        UE_LOG(LogTemp, Verbose, TEXT("Set object property %s to: %s (Class: %s)"),
+               *PropertyPath, *LoadedAsset->GetName(), *ExpectedClass->GetName());
+        return true;
     }
-    // ============================================
-    // FStructProperty handling
-    // ============================================
-    else if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+
+    bool SetStructValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                        const FString& PropertyPath, FString& OutErrorMessage)
     {
-        return SetStructPropertyValue(PropertyAddr, StructProp, Value, OutErrorMessage);
+        return FSpirrowBridgeCommonUtils::SetStructPropertyValue(ValueAddr, static_cast<FStructProperty*>(Property), Value, OutErrorMessage);
     }
-    // ============================================
-    // FNameProperty handling
-    // ============================================
-    else if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
+
+    /** Fallback for containers and other types without a dedicated setter */
+    bool ImportTextValue(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+                         const FString& PropertyPath, FString& OutErrorMessage)
     {
-        if (Value->Type == EJson::String)
+        FString Text;
+        if (!JsonValueToImportText(Value, Text))
         {
-            FName NameValue = FName(*Value->AsString());
-            NameProp->SetPropertyValue(PropertyAddr, NameValue);
-            UE_LOG(LogTemp, Display, TEXT("Set name property %s to: %s"), *PropertyName, *NameValue.ToString());
-            return true;
+            OutErrorMessage = FString::Printf(TEXT("Unsupported value for %s property %s"),
+                                            *Property->GetClass()->GetName(), *PropertyPath);
+            return false;
         }
-        else
+
+        if (!Property->ImportText_Direct(*Text, ValueAddr, nullptr, PPF_None))
         {
-            OutErrorMessage = FString::Printf(TEXT("Name property %s requires a string value"), *PropertyName);
+            OutErrorMessage = FString::Printf(TEXT("Failed to import '%s' into %s property %s"),
+                                            *Text, *Property->GetClass()->GetName(), *PropertyPath);
             return false;
         }
+        return true;
     }
-    // ============================================
-    // FDoubleProperty handling (UE5)
-    // ============================================
-    else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
+}
+
+FSpirrowPropertySetter FSpirrowBridgeCommonUtils::GetPropertySetter(FProperty* Property)
+{
+    // IMPORTANT: Check derived classes BEFORE base classes to avoid incorrect type matching
+    // FByteProperty is an FNumericProperty; FClassProperty derives from FObjectProperty
+    if (Property->IsA<FBoolProperty>())
     {
-        DoubleProp->SetPropertyValue(PropertyAddr, Value->AsNumber());
-        UE_LOG(LogTemp, Display, TEXT("Set double property %s to: %f"), *PropertyName, Value->AsNumber());
-        return true;
+        return &SetBoolValue;
+    }
+    if (Property->IsA<FEnumProperty>())
+    {
+        return &SetEnumValue;
+    }
+    if (Property->IsA<FByteProperty>())
+    {
+        return &SetByteValue;
+    }
+    if (Property->IsA<FNumericProperty>())
+    {
+        return &SetNumericValue;
+    }
+    if (Property->IsA<FStrProperty>())
+    {
+        return &SetStrValue;
+    }
+    if (Property->IsA<FNameProperty>())
+    {
+        return &SetNameValue;
+    }
+    if (Property->IsA<FTextProperty>())
+    {
+        return &SetTextValue;
+    }
+    if (Property->IsA<FClassProperty>())
+    {
+        return &SetClassValue;
+    }
+    if (Property->IsA<FSoftObjectProperty>())
+    {
+        return &SetSoftObjectValue;
+    }
+    if (Property->IsA<FObjectProperty>())
+    {
+        return &SetObjectValue;
     }
+    if (Property->IsA<FStructProperty>())
+    {
+        return &SetStructValue;
+    }
+    return &ImportTextValue;
+}
 
-    OutErrorMessage = FString::Printf(TEXT("Unsupported property type: %s for property %s"),
-                                    *Property->GetClass()->GetName(), *PropertyName);
-    return false;
+bool FSpirrowBridgeCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName, 
+                                     const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+{
+    if (!Object)
+    {
+        OutErrorMessage = TEXT("Invalid object");
+        return false;
+    }
+
+    // Path compiled once per (class, path): leaf property, byte offset and setter
+    const FSpirrowPropertyPath* CachedPath = FSpirrowBridgePropertyPathCache::Get().Find(Object->GetClass(), PropertyName, OutErrorMessage);
+    if (!CachedPath)
+    {
+        return false;
+    }
+
+    // Copy: a setter that loads assets can trigger a compile, which clears the cache
+    const FSpirrowPropertyPath Path = *CachedPath;
+    return Path.Setter(Path.Property, Path.GetValuePtr(Object), Value, PropertyName, OutErrorMessage);
 }
 
 // ============================================
@@ -1181,6 +1264,13 @@ TSharedPtr<FJsonObject> FSpirrowBridgeCommonUtils::ValidateBlueprint(
     
     if (!OutBlueprint)
     {
+        TArray<FSoftObjectPath> Candidates;
+        if (FSpirrowBridgeAssetResolver::Get().FindByName(BlueprintName, UBlueprint::StaticClass(), Candidates) == ESpirrowAssetLookup::Ambiguous)
+        {
+            return FSpirrowBridgeAssetResolver::Get().MakeResolveError(BlueprintName, Path, UBlueprint::StaticClass(),
+                ESpirrowErrorCode::BlueprintNotFound, FString());
+        }
+
         TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
         Details->SetStringField(TEXT("blueprint_name"), BlueprintName);
         Details->SetStringField(TEXT("path"), Path);
@@ -1322,7 +1412,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
     }
 
     FString StructName = ScriptStruct->GetName();
-    UE_LOG(LogTemp, Display, TEXT("SetStructPropertyValue: Processing struct type '%s'"), *StructName);
+    UE_LOG(LogTemp, Verbose, TEXT("SetStructPropertyValue: Processing struct type '%s'"), *StructName);
 
     // ============================================
     // Handle FBlackboardKeySelector (BehaviorTree)
@@ -1335,7 +1425,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
         if (Value->Type == EJson::String)
         {
             KeySelector->SelectedKeyName = FName(*Value->AsString());
-            UE_LOG(LogTemp, Display, TEXT("Set FBlackboardKeySelector.SelectedKeyName to: %s"), 
+            UE_LOG(LogTemp, Verbose, TEXT("Set FBlackboardKeySelector.SelectedKeyName to: %s"), 
                    *KeySelector->SelectedKeyName.ToString());
             return true;
         }
@@ -1351,7 +1441,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
                 if (JsonObj->TryGetStringField(TEXT("SelectedKeyName"), KeyName))
                 {
                     KeySelector->SelectedKeyName = FName(*KeyName);
-                    UE_LOG(LogTemp, Display, TEXT("Set FBlackboardKeySelector.SelectedKeyName to: %s"), *KeyName);
+                    UE_LOG(LogTemp, Verbose, TEXT("Set FBlackboardKeySelector.SelectedKeyName to: %s"), *KeyName);
                 }
             }
             
@@ -1378,7 +1468,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
                 VectorPtr->X = JsonArray[0]->AsNumber();
                 VectorPtr->Y = JsonArray[1]->AsNumber();
                 VectorPtr->Z = JsonArray[2]->AsNumber();
-                UE_LOG(LogTemp, Display, TEXT("Set FVector to: (%f, %f, %f)"), VectorPtr->X, VectorPtr->Y, VectorPtr->Z);
+                UE_LOG(LogTemp, Verbose, TEXT("Set FVector to: (%f, %f, %f)"), VectorPtr->X, VectorPtr->Y, VectorPtr->Z);
                 return true;
             }
         }
@@ -1388,7 +1478,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
             if (JsonObj->HasField(TEXT("X"))) VectorPtr->X = JsonObj->GetNumberField(TEXT("X"));
             if (JsonObj->HasField(TEXT("Y"))) VectorPtr->Y = JsonObj->GetNumberField(TEXT("Y"));
             if (JsonObj->HasField(TEXT("Z"))) VectorPtr->Z = JsonObj->GetNumberField(TEXT("Z"));
-            UE_LOG(LogTemp, Display, TEXT("Set FVector to: (%f, %f, %f)"), VectorPtr->X, VectorPtr->Y, VectorPtr->Z);
+            UE_LOG(LogTemp, Verbose, TEXT("Set FVector to: (%f, %f, %f)"), VectorPtr->X, VectorPtr->Y, VectorPtr->Z);
             return true;
         }
         OutErrorMessage = TEXT("FVector requires an array [X, Y, Z] or object {X, Y, Z}");
@@ -1408,7 +1498,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
             {
                 Vector2DPtr->X = JsonArray[0]->AsNumber();
                 Vector2DPtr->Y = JsonArray[1]->AsNumber();
-                UE_LOG(LogTemp, Display, TEXT("Set FVector2D to: (%f, %f)"), Vector2DPtr->X, Vector2DPtr->Y);
+                UE_LOG(LogTemp, Verbose, TEXT("Set FVector2D to: (%f, %f)"), Vector2DPtr->X, Vector2DPtr->Y);
                 return true;
             }
         }
@@ -1417,7 +1507,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
             const TSharedPtr<FJsonObject>& JsonObj = Value->AsObject();
             if (JsonObj->HasField(TEXT("X"))) Vector2DPtr->X = JsonObj->GetNumberField(TEXT("X"));
             if (JsonObj->HasField(TEXT("Y"))) Vector2DPtr->Y = JsonObj->GetNumberField(TEXT("Y"));
-            UE_LOG(LogTemp, Display, TEXT("Set FVector2D to: (%f, %f)"), Vector2DPtr->X, Vector2DPtr->Y);
+            UE_LOG(LogTemp, Verbose, TEXT("Set FVector2D to: (%f, %f)"), Vector2DPtr->X, Vector2DPtr->Y);
             return true;
         }
         OutErrorMessage = TEXT("FVector2D requires an array [X, Y] or object {X, Y}");
@@ -1438,7 +1528,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
                 RotatorPtr->Pitch = JsonArray[0]->AsNumber();
                 RotatorPtr->Yaw = JsonArray[1]->AsNumber();
                 RotatorPtr->Roll = JsonArray[2]->AsNumber();
-                UE_LOG(LogTemp, Display, TEXT("Set FRotator to: (Pitch=%f, Yaw=%f, Roll=%f)"), 
+                UE_LOG(LogTemp, Verbose, TEXT("Set FRotator to: (Pitch=%f, Yaw=%f, Roll=%f)"), 
                        RotatorPtr->Pitch, RotatorPtr->Yaw, RotatorPtr->Roll);
                 return true;
             }
@@ -1449,7 +1539,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
             if (JsonObj->HasField(TEXT("Pitch"))) RotatorPtr->Pitch = JsonObj->GetNumberField(TEXT("Pitch"));
             if (JsonObj->HasField(TEXT("Yaw"))) RotatorPtr->Yaw = JsonObj->GetNumberField(TEXT("Yaw"));
             if (JsonObj->HasField(TEXT("Roll"))) RotatorPtr->Roll = JsonObj->GetNumberField(TEXT("Roll"));
-            UE_LOG(LogTemp, Display, TEXT("Set FRotator to: (Pitch=%f, Yaw=%f, Roll=%f)"), 
+            UE_LOG(LogTemp, Verbose, TEXT("Set FRotator to: (Pitch=%f, Yaw=%f, Roll=%f)"), 
                    RotatorPtr->Pitch, RotatorPtr->Yaw, RotatorPtr->Roll);
             return true;
         }
@@ -1472,7 +1562,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
                 ColorPtr->G = JsonArray[1]->AsNumber();
                 ColorPtr->B = JsonArray[2]->AsNumber();
                 ColorPtr->A = JsonArray.Num() >= 4 ? JsonArray[3]->AsNumber() : 1.0f;
-                UE_LOG(LogTemp, Display, TEXT("Set FLinearColor to: (R=%f, G=%f, B=%f, A=%f)"), 
+                UE_LOG(LogTemp, Verbose, TEXT("Set FLinearColor to: (R=%f, G=%f, B=%f, A=%f)"), 
                        ColorPtr->R, ColorPtr->G, ColorPtr->B, ColorPtr->A);
                 return true;
             }
@@ -1484,7 +1574,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
             if (JsonObj->HasField(TEXT("G"))) ColorPtr->G = JsonObj->GetNumberField(TEXT("G"));
             if (JsonObj->HasField(TEXT("B"))) ColorPtr->B = JsonObj->GetNumberField(TEXT("B"));
             if (JsonObj->HasField(TEXT("A"))) ColorPtr->A = JsonObj->GetNumberField(TEXT("A"));
-            UE_LOG(LogTemp, Display, TEXT("Set FLinearColor to: (R=%f, G=%f, B=%f, A=%f)"), 
+            UE_LOG(LogTemp, Verbose, TEXT("Set FLinearColor to: (R=%f, G=%f, B=%f, A=%f)"), 
                    ColorPtr->R, ColorPtr->G, ColorPtr->B, ColorPtr->A);
             return true;
         }
@@ -1507,7 +1597,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
                 ColorPtr->G = static_cast<uint8>(JsonArray[1]->AsNumber());
                 ColorPtr->B = static_cast<uint8>(JsonArray[2]->AsNumber());
                 ColorPtr->A = JsonArray.Num() >= 4 ? static_cast<uint8>(JsonArray[3]->AsNumber()) : 255;
-                UE_LOG(LogTemp, Display, TEXT("Set FColor to: (R=%d, G=%d, B=%d, A=%d)"), 
+                UE_LOG(LogTemp, Verbose, TEXT("Set FColor to: (R=%d, G=%d, B=%d, A=%d)"), 
                        ColorPtr->R, ColorPtr->G, ColorPtr->B, ColorPtr->A);
                 return true;
             }
@@ -1519,7 +1609,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
             if (JsonObj->HasField(TEXT("G"))) ColorPtr->G = static_cast<uint8>(JsonObj->GetNumberField(TEXT("G")));
             if (JsonObj->HasField(TEXT("B"))) ColorPtr->B = static_cast<uint8>(JsonObj->GetNumberField(TEXT("B")));
             if (JsonObj->HasField(TEXT("A"))) ColorPtr->A = static_cast<uint8>(JsonObj->GetNumberField(TEXT("A")));
-            UE_LOG(LogTemp, Display, TEXT("Set FColor to: (R=%d, G=%d, B=%d, A=%d)"), 
+            UE_LOG(LogTemp, Verbose, TEXT("Set FColor to: (R=%d, G=%d, B=%d, A=%d)"), 
                    ColorPtr->R, ColorPtr->G, ColorPtr->B, ColorPtr->A);
             return true;
         }
@@ -1536,7 +1626,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
         if (Value->Type == EJson::Number)
         {
             DataProviderPtr->DefaultValue = Value->AsNumber();
-            UE_LOG(LogTemp, Display, TEXT("Set FAIDataProviderFloatValue.DefaultValue to: %f"), 
+            UE_LOG(LogTemp, Verbose, TEXT("Set FAIDataProviderFloatValue.DefaultValue to: %f"), 
                    DataProviderPtr->DefaultValue);
             return true;
         }
@@ -1551,7 +1641,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
             {
                 DataProviderPtr->DefaultValue = JsonObj->GetNumberField(TEXT("Value"));
             }
-            UE_LOG(LogTemp, Display, TEXT("Set FAIDataProviderFloatValue.DefaultValue to: %f"), 
+            UE_LOG(LogTemp, Verbose, TEXT("Set FAIDataProviderFloatValue.DefaultValue to: %f"), 
                    DataProviderPtr->DefaultValue);
             return true;
         }
@@ -1568,7 +1658,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
         if (Value->Type == EJson::Number)
         {
             DataProviderPtr->DefaultValue = static_cast<int32>(Value->AsNumber());
-            UE_LOG(LogTemp, Display, TEXT("Set FAIDataProviderIntValue.DefaultValue to: %d"), 
+            UE_LOG(LogTemp, Verbose, TEXT("Set FAIDataProviderIntValue.DefaultValue to: %d"), 
                    DataProviderPtr->DefaultValue);
             return true;
         }
@@ -1583,7 +1673,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
             {
                 DataProviderPtr->DefaultValue = static_cast<int32>(JsonObj->GetNumberField(TEXT("Value")));
             }
-            UE_LOG(LogTemp, Display, TEXT("Set FAIDataProviderIntValue.DefaultValue to: %d"), 
+            UE_LOG(LogTemp, Verbose, TEXT("Set FAIDataProviderIntValue.DefaultValue to: %d"), 
                    DataProviderPtr->DefaultValue);
             return true;
         }
@@ -1600,7 +1690,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
         if (Value->Type == EJson::Boolean)
         {
             DataProviderPtr->DefaultValue = Value->AsBool();
-            UE_LOG(LogTemp, Display, TEXT("Set FAIDataProviderBoolValue.DefaultValue to: %s"), 
+            UE_LOG(LogTemp, Verbose, TEXT("Set FAIDataProviderBoolValue.DefaultValue to: %s"), 
                    DataProviderPtr->DefaultValue ? TEXT("true") : TEXT("false"));
             return true;
         }
@@ -1615,7 +1705,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
             {
                 DataProviderPtr->DefaultValue = JsonObj->GetBoolField(TEXT("Value"));
             }
-            UE_LOG(LogTemp, Display, TEXT("Set FAIDataProviderBoolValue.DefaultValue to: %s"), 
+            UE_LOG(LogTemp, Verbose, TEXT("Set FAIDataProviderBoolValue.DefaultValue to: %s"), 
                    DataProviderPtr->DefaultValue ? TEXT("true") : TEXT("false"));
             return true;
         }
@@ -1682,7 +1772,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
                 }
             }
             
-            UE_LOG(LogTemp, Display, TEXT("Set FTransform"));
+            UE_LOG(LogTemp, Verbose, TEXT("Set FTransform"));
             return true;
         }
         OutErrorMessage = TEXT("FTransform requires an object with Location/Rotation/Scale arrays");
@@ -1695,7 +1785,7 @@ bool FSpirrowBridgeCommonUtils::SetStructPropertyValue(void* StructAddr, FStruct
     {
         const TSharedPtr<FJsonObject>& JsonObj = Value->AsObject();
         
-        UE_LOG(LogTemp, Display, TEXT("Attempting generic struct handling for '%s'"), *StructName);
+        UE_LOG(LogTemp, Verbose, TEXT("Attempting generic struct handling for '%s'"), *StructName);
         
         // Iterate through JSON fields and set corresponding struct properties
         bool bSuccess = true;
@@ -0,0 +1,365 @@
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "BlueprintCompilationManager.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+
+FSpirrowBridgeCompileScheduler& FSpirrowBridgeCompileScheduler::Get()
+{
+    static FSpirrowBridgeCompileScheduler Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeCompileScheduler::Startup()
+{
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FSpirrowBridgeCompileScheduler::Tick), 0.1f);
+    }
+}
+
+void FSpirrowBridgeCompileScheduler::Shutdown()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+    CompilePending();
+}
+
+void FSpirrowBridgeCompileScheduler::RequestCompile(UBlueprint* Blueprint, bool bForceImmediate)
+{
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    ++TotalRequests;
+    if (bForceImmediate || (Policy == ESpirrowCompilePolicy::Immediate && DeferralDepth == 0))
+    {
+        PendingBlueprints.Remove(Blueprint);
+        ++TotalCompiles;
+        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        return;
+    }
+
+    PendingBlueprints.Add(Blueprint);
+    LastRequestTime = FPlatformTime::Seconds();
+}
+
+void FSpirrowBridgeCompileScheduler::EnsureCompiled(UBlueprint* Blueprint)
+{
+    if (Blueprint && PendingBlueprints.Remove(Blueprint) > 0)
+    {
+        ++TotalCompiles;
+        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    }
+}
+
+bool FSpirrowBridgeCompileScheduler::IsPending(const UBlueprint* Blueprint) const
+{
+    return PendingBlueprints.Contains(Blueprint);
+}
+
+int32 FSpirrowBridgeCompileScheduler::CompilePending(TArray<FSpirrowBlueprintCompileResult>* OutResults)
+{
+    TArray<UBlueprint*> BlueprintsToCompile;
+    for (const TWeakObjectPtr<UBlueprint>& BlueprintPtr : PendingBlueprints)
+    {
+        if (UBlueprint* Blueprint = BlueprintPtr.Get())
+        {
+            BlueprintsToCompile.Add(Blueprint);
+        }
+    }
+    PendingBlueprints.Reset();
+
+    TArray<FSpirrowBlueprintCompileResult> Results;
+    CompileBlueprints(BlueprintsToCompile, Results);
+
+    int32 CompiledCount = 0;
+    for (const FSpirrowBlueprintCompileResult& Result : Results)
+    {
+        CompiledCount += Result.bSuccess ? 1 : 0;
+    }
+    if (OutResults)
+    {
+        OutResults->Append(MoveTemp(Results));
+    }
+    return CompiledCount;
+}
+
+void FSpirrowBridgeCompileScheduler::CompileBlueprints(const TArray<UBlueprint*>& Blueprints, TArray<FSpirrowBlueprintCompileResult>& OutResults)
+{
+    TArray<UBlueprint*> Queued;
+    TSet<UBlueprint*> Seen;
+    Seen.Reserve(Blueprints.Num());
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        bool bAlreadySeen = false;
+        Seen.Add(Blueprint, &bAlreadySeen);
+        if (Blueprint && !bAlreadySeen)
+        {
+            PendingBlueprints.Remove(Blueprint);
+            Queued.Add(Blueprint);
+        }
+    }
+
+    // A single Blueprint takes the regular path, which also yields a full results log
+    if (Queued.Num() == 1)
+    {
+        ++TotalCompiles;
+        CompileBlueprint(Queued[0], OutResults.AddDefaulted_GetRef());
+        return;
+    }
+    if (Queued.Num() == 0)
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    for (UBlueprint* Blueprint : Queued)
+    {
+        FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+    }
+    FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TotalCompiles += Queued.Num();
+
+    // The manager keeps no per-Blueprint log; node-level compiler messages carry the details
+    for (UBlueprint* Blueprint : Queued)
+    {
+        FSpirrowBlueprintCompileResult& Result = OutResults.AddDefaulted_GetRef();
+        Result.BlueprintPath = Blueprint->GetPathName();
+        Result.ElapsedMs = ElapsedMs;
+        Result.bBatched = true;
+
+        TArray<UEdGraph*> Graphs;
+        Blueprint->GetAllGraphs(Graphs);
+        for (const UEdGraph* Graph : Graphs)
+        {
+            for (const UEdGraphNode* Node : Graph->Nodes)
+            {
+                if (!Node || !Node->bHasCompilerMessage)
+                {
+                    continue;
+                }
+
+                const FString Message = FString::Printf(TEXT("%s (%s): %s"),
+                    *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Graph->GetName(), *Node->ErrorMsg);
+                if (Node->ErrorType <= EMessageSeverity::Error)
+                {
+                    Result.Errors.Add(Message);
+                }
+                else if (Node->ErrorType == EMessageSeverity::Warning || Node->ErrorType == EMessageSeverity::PerformanceWarning)
+                {
+                    Result.Warnings.Add(Message);
+                }
+            }
+        }
+
+        Result.NumErrors = Result.Errors.Num();
+        Result.NumWarnings = Result.Warnings.Num();
+        Result.bSuccess = Blueprint->Status != BS_Error && Result.NumErrors == 0;
+    }
+}
+
+void FSpirrowBridgeCompileScheduler::CompileBlueprint(UBlueprint* Blueprint, FSpirrowBlueprintCompileResult& OutResult)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    FCompilerResultsLog ResultsLog;
+    ResultsLog.SetSourcePath(Blueprint->GetPathName());
+    FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &ResultsLog);
+
+    OutResult.BlueprintPath = Blueprint->GetPathName();
+    OutResult.bSuccess = Blueprint->Status != BS_Error && ResultsLog.NumErrors == 0;
+    OutResult.NumWarnings = ResultsLog.NumWarnings;
+    OutResult.NumErrors = ResultsLog.NumErrors;
+    OutResult.ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    OutResult.bBatched = false;
+
+    for (const TSharedRef<FTokenizedMessage>& Message : ResultsLog.Messages)
+    {
+        if (Message->GetSeverity() <= EMessageSeverity::Error)
+        {
+            OutResult.Errors.Add(Message->ToText().ToString());
+        }
+        else if (Message->GetSeverity() == EMessageSeverity::Warning || Message->GetSeverity() == EMessageSeverity::PerformanceWarning)
+        {
+            OutResult.Warnings.Add(Message->ToText().ToString());
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeCompileScheduler::CompileResultToJson(const FSpirrowBlueprintCompileResult& Result, bool bIncludeMessages)
+{
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("blueprint"), Result.BlueprintPath);
+    ResultObj->SetBoolField(TEXT("success"), Result.bSuccess);
+    ResultObj->SetStringField(TEXT("status"), !Result.bSuccess ? TEXT("error") : Result.NumWarnings > 0 ? TEXT("warnings") : TEXT("up_to_date"));
+    ResultObj->SetNumberField(TEXT("warning_count"), Result.NumWarnings);
+    ResultObj->SetNumberField(TEXT("error_count"), Result.NumErrors);
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), Result.ElapsedMs);
+    ResultObj->SetBoolField(TEXT("batched"), Result.bBatched);
+
+    if (bIncludeMessages)
+    {
+        TArray<TSharedPtr<FJsonValue>> WarningArray, ErrorArray;
+        for (const FString& Warning : Result.Warnings)
+        {
+            WarningArray.Add(MakeShared<FJsonValueString>(Warning));
+        }
+        for (const FString& Error : Result.Errors)
+        {
+            ErrorArray.Add(MakeShared<FJsonValueString>(Error));
+        }
+        ResultObj->SetArrayField(TEXT("warnings"), WarningArray);
+        ResultObj->SetArrayField(TEXT("errors"), ErrorArray);
+    }
+    return ResultObj;
+}
+
+FSpirrowBridgeCompileScheduler::FScopedDeferral::FScopedDeferral()
+{
+    ++FSpirrowBridgeCompileScheduler::Get().DeferralDepth;
+}
+
+FSpirrowBridgeCompileScheduler::FScopedDeferral::~FScopedDeferral()
+{
+    FSpirrowBridgeCompileScheduler& Scheduler = FSpirrowBridgeCompileScheduler::Get();
+    if (--Scheduler.DeferralDepth == 0 && Scheduler.Policy == ESpirrowCompilePolicy::Immediate)
+    {
+        Scheduler.CompilePending();
+    }
+}
+
+bool FSpirrowBridgeCompileScheduler::Tick(float DeltaTime)
+{
+    if (Policy != ESpirrowCompilePolicy::Deferred || DeferralDepth > 0 || PendingBlueprints.Num() == 0 ||
+        FPlatformTime::Seconds() - LastRequestTime < IdleSeconds)
+    {
+        return true;
+    }
+
+    // Spread a large queue over several ticks so the editor stays responsive; always make progress
+    const double StartTime = FPlatformTime::Seconds();
+    int32 CompiledCount = 0;
+    while (PendingBlueprints.Num() > 0)
+    {
+        // Fresh iterator each pass: compiling can queue further Blueprints
+        auto It = PendingBlueprints.CreateIterator();
+        UBlueprint* Blueprint = It->Get();
+        It.RemoveCurrent();
+        if (Blueprint)
+        {
+            ++TotalCompiles;
+            ++CompiledCount;
+            FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        }
+
+        if ((FPlatformTime::Seconds() - StartTime) * 1000.0 >= TickBudgetMs)
+        {
+            break;
+        }
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("SpirrowBridge: Idle compile of %d Blueprint(s), %d still queued"),
+        CompiledCount, PendingBlueprints.Num());
+    return true;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeCompileScheduler::MakeStatusJson() const
+{
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("policy"), Policy == ESpirrowCompilePolicy::Deferred ? TEXT("deferred") : TEXT("immediate"));
+    ResultObj->SetNumberField(TEXT("idle_seconds"), IdleSeconds);
+    ResultObj->SetNumberField(TEXT("tick_budget_ms"), TickBudgetMs);
+    ResultObj->SetNumberField(TEXT("pending"), PendingBlueprints.Num());
+    ResultObj->SetNumberField(TEXT("total_requests"), TotalRequests);
+    ResultObj->SetNumberField(TEXT("total_compiles"), TotalCompiles);
+
+    TArray<TSharedPtr<FJsonValue>> PendingArray;
+    for (const TWeakObjectPtr<UBlueprint>& BlueprintPtr : PendingBlueprints)
+    {
+        if (const UBlueprint* Blueprint = BlueprintPtr.Get())
+        {
+            PendingArray.Add(MakeShared<FJsonValueString>(Blueprint->GetPathName()));
+        }
+    }
+    ResultObj->SetArrayField(TEXT("pending_blueprints"), PendingArray);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeCompileScheduler::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("set_compile_policy"))
+    {
+        FString PolicyName;
+        if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("policy"), PolicyName))
+        {
+            return Error;
+        }
+
+        ESpirrowCompilePolicy NewPolicy;
+        if (PolicyName.Equals(TEXT("immediate"), ESearchCase::IgnoreCase))
+        {
+            NewPolicy = ESpirrowCompilePolicy::Immediate;
+        }
+        else if (PolicyName.Equals(TEXT("deferred"), ESearchCase::IgnoreCase))
+        {
+            NewPolicy = ESpirrowCompilePolicy::Deferred;
+        }
+        else
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParamValue,
+                FString::Printf(TEXT("Invalid policy '%s' (expected immediate or deferred)"), *PolicyName));
+        }
+
+        FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("idle_seconds"), IdleSeconds, IdleSeconds);
+        FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("tick_budget_ms"), TickBudgetMs, TickBudgetMs);
+        IdleSeconds = FMath::Max(0.0, IdleSeconds);
+        TickBudgetMs = FMath::Max(0.0, TickBudgetMs);
+        Policy = NewPolicy;
+
+        // Switching back to immediate must not leave stale generated classes around
+        if (Policy == ESpirrowCompilePolicy::Immediate && DeferralDepth == 0)
+        {
+            CompilePending();
+        }
+        return MakeStatusJson();
+    }
+    else if (CommandType == TEXT("compile_pending"))
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        TArray<FSpirrowBlueprintCompileResult> Results;
+        CompilePending(&Results);
+
+        TSharedPtr<FJsonObject> ResultObj = MakeStatusJson();
+        TArray<TSharedPtr<FJsonValue>> CompiledArray;
+        int32 FailedCount = 0;
+        for (const FSpirrowBlueprintCompileResult& Result : Results)
+        {
+            CompiledArray.Add(MakeShared<FJsonValueObject>(CompileResultToJson(Result, true)));
+            FailedCount += Result.bSuccess ? 0 : 1;
+        }
+        ResultObj->SetArrayField(TEXT("compiled"), CompiledArray);
+        ResultObj->SetNumberField(TEXT("failed"), FailedCount);
+        ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+        return ResultObj;
+    }
+    else if (CommandType == TEXT("get_compile_status"))
+    {
+        return MakeStatusJson();
+    }
+
+    return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+        ESpirrowErrorCode::UnknownCommand,
+        FString::Printf(TEXT("Unknown compile command: %s"), *CommandType));
+}
@@ -0,0 +1,876 @@
+// SpirrowBridgeDataTableCommands.cpp
+#include "Commands/SpirrowBridgeDataTableCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
+#include "Commands/SpirrowBridgePropertyPathCache.h"
+#include "Engine/DataTable.h"
+#include "DataTableUtils.h"
+#include "DataTableEditorUtils.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    constexpr int64 FileChunkSize = 64 * 1024;
+
+    bool IsJsonSpace(uint8 C)
+    {
+        return C == ' ' || C == '\t' || C == '\r' || C == '\n';
+    }
+
+    FString Utf8BytesToString(const TArray<uint8>& Bytes)
+    {
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+        return FString(Converted.Length(), Converted.Get());
+    }
+
+    /** Read a file in fixed size chunks so large imports never hold the whole file */
+    bool StreamFile(const FString& FilePath, TFunctionRef<bool(const uint8*, int64)> OnChunk, FString& OutErrorMessage)
+    {
+        TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+        if (!Reader)
+        {
+            OutErrorMessage = FString::Printf(TEXT("Failed to open file: %s"), *FilePath);
+            return false;
+        }
+
+        TArray<uint8> Buffer;
+        Buffer.SetNumUninitialized(FileChunkSize);
+        int64 Remaining = Reader->TotalSize();
+        while (Remaining > 0)
+        {
+            const int64 ChunkSize = FMath::Min(Remaining, FileChunkSize);
+            Reader->Serialize(Buffer.GetData(), ChunkSize);
+            if (Reader->IsError())
+            {
+                OutErrorMessage = FString::Printf(TEXT("Failed to read file: %s"), *FilePath);
+                return false;
+            }
+            Remaining -= ChunkSize;
+            if (!OnChunk(Buffer.GetData(), ChunkSize))
+            {
+                return true;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Splits UTF-8 CSV bytes into records. Newlines inside quoted fields stay in the record;
+     * a leading byte order mark is dropped.
+     */
+    class FCsvRecordSplitter
+    {
+    public:
+        /** @return false when OnRecord asked to stop */
+        bool Feed(const uint8* Data, int64 Num, TFunctionRef<bool(const FString&)> OnRecord)
+        {
+            for (int64 Index = 0; Index < Num; ++Index)
+            {
+                const uint8 C = Data[Index];
+                if (BomBytesChecked < 3)
+                {
+                    static const uint8 Bom[3] = { 0xEF, 0xBB, 0xBF };
+                    if (C == Bom[BomBytesChecked] && Pending.Num() == BomBytesChecked)
+                    {
+                        ++BomBytesChecked;
+                        if (BomBytesChecked == 3)
+                        {
+                            Pending.Reset();
+                            continue;
+                        }
+                        Pending.Add(C);
+                        continue;
+                    }
+                    BomBytesChecked = 3;
+                }
+
+                if (C == '"')
+                {
+                    bInQuotes = !bInQuotes;
+                }
+                else if (C == '\n' && !bInQuotes)
+                {
+                    if (!EmitRecord(OnRecord))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                Pending.Add(C);
+            }
+            return true;
+        }
+
+        bool Finish(TFunctionRef<bool(const FString&)> OnRecord)
+        {
+            return Pending.Num() == 0 || EmitRecord(OnRecord);
+        }
+
+    private:
+        bool EmitRecord(TFunctionRef<bool(const FString&)> OnRecord)
+        {
+            if (Pending.Num() > 0 && Pending.Last() == '\r')
+            {
+                Pending.Pop(EAllowShrinking::No);
+            }
+            const FString Record = Utf8BytesToString(Pending);
+            Pending.Reset();
+            return OnRecord(Record);
+        }
+
+        TArray<uint8> Pending;
+        int32 BomBytesChecked = 0;
+        bool bInQuotes = false;
+    };
+
+    /** Split one CSV record into fields; "" inside a quoted field is a literal quote */
+    void ParseCsvFields(const FString& Record, TArray<FString>& OutFields)
+    {
+        OutFields.Reset();
+        FString Field;
+        bool bInQuotes = false;
+        for (int32 Index = 0; Index < Record.Len(); ++Index)
+        {
+            const TCHAR C = Record[Index];
+            if (bInQuotes)
+            {
+                if (C == TEXT('"'))
+                {
+                    if (Index + 1 < Record.Len() && Record[Index + 1] == TEXT('"'))
+                    {
+                        Field.AppendChar(TEXT('"'));
+                        ++Index;
+                    }
+                    else
+                    {
+                        bInQuotes = false;
+                    }
+                }
+                else
+                {
+                    Field.AppendChar(C);
+                }
+            }
+            else if (C == TEXT('"'))
+            {
+                bInQuotes = true;
+            }
+            else if (C == TEXT(','))
+            {
+                OutFields.Add(MoveTemp(Field));
+                Field.Reset();
+            }
+            else
+            {
+                Field.AppendChar(C);
+            }
+        }
+        OutFields.Add(MoveTemp(Field));
+    }
+
+    /**
+     * Splits UTF-8 bytes of a JSON array ("[{...}, {...}]", the DataTable JSON export format)
+     * into the text of each row object without parsing the whole document.
+     */
+    class FJsonRowSplitter
+    {
+    public:
+        /** @return false on malformed input (see Error) or when OnRow asked to stop */
+        bool Feed(const uint8* Data, int64 Num, TFunctionRef<bool(const FString&)> OnRow)
+        {
+            for (int64 Index = 0; Index < Num; ++Index)
+            {
+                const uint8 C = Data[Index];
+                if (bDone)
+                {
+                    continue;
+                }
+                if (Depth == 0)
+                {
+                    if (IsJsonSpace(C) || C == 0xEF || C == 0xBB || C == 0xBF)
+                    {
+                        continue;
+                    }
+                    if (C != '[')
+                    {
+                        Error = TEXT("JSON rows must be an array of row objects");
+                        return false;
+                    }
+                    Depth = 1;
+                    continue;
+                }
+                if (Depth == 1 && Element.Num() == 0)
+                {
+                    if (IsJsonSpace(C) || C == ',')
+                    {
+                        continue;
+                    }
+                    if (C == ']')
+                    {
+                        Depth = 0;
+                        bDone = true;
+                        continue;
+                    }
+                    if (C != '{')
+                    {
+                        Error = FString::Printf(TEXT("Row %d is not a JSON object"), RowCount + 1);
+                        return false;
+                    }
+                }
+
+                Element.Add(C);
+                if (bInString)
+                {
+                    if (bEscape)
+                    {
+                        bEscape = false;
+                    }
+                    else if (C == '\\')
+                    {
+                        bEscape = true;
+                    }
+                    else if (C == '"')
+                    {
+                        bInString = false;
+                    }
+                    continue;
+                }
+
+                if (C == '"')
+                {
+                    bInString = true;
+                }
+                else if (C == '{' || C == '[')
+                {
+                    ++Depth;
+                }
+                else if ((C == '}' || C == ']') && --Depth == 1)
+                {
+                    ++RowCount;
+                    const FString RowText = Utf8BytesToString(Element);
+                    Element.Reset();
+                    if (!OnRow(RowText))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool Finish()
+        {
+            if (!bDone && Error.IsEmpty())
+            {
+                Error = TEXT("Unexpected end of JSON rows");
+            }
+            return bDone;
+        }
+
+        FString Error;
+
+    private:
+        TArray<uint8> Element;
+        int32 Depth = 0;
+        int32 RowCount = 0;
+        bool bInString = false;
+        bool bEscape = false;
+        bool bDone = false;
+    };
+
+    /**
+     * Applies rows to one DataTable. Each row is built in a scratch buffer (a copy of the
+     * existing row, or the struct defaults for a new one) and committed only when every field
+     * was set, so a bad cell never leaves a half written row. Columns are resolved once.
+     */
+    class FDataTableRowUpserter
+    {
+    public:
+        FDataTableRowUpserter(UDataTable* InTable, bool bInDryRun, int32 InMaxErrors)
+            : Table(InTable)
+            , RowStruct(InTable->GetRowStruct())
+            , bDryRun(bInDryRun)
+            , MaxErrors(InMaxErrors)
+        {
+            Scratch = static_cast<uint8*>(FMemory::Malloc(RowStruct->GetStructureSize(), RowStruct->GetMinAlignment()));
+            RowStruct->InitializeStruct(Scratch);
+        }
+
+        ~FDataTableRowUpserter()
+        {
+            RowStruct->DestroyStruct(Scratch);
+            FMemory::Free(Scratch);
+        }
+
+        /** CSV header: the key column (or the first one) names rows, the rest bind to fields */
+        void SetHeader(const TArray<FString>& InColumns, const FString& KeyField)
+        {
+            HeaderColumns.Reset();
+            KeyColumnIndex = InColumns.IndexOfByKey(KeyField);
+            if (KeyColumnIndex == INDEX_NONE)
+            {
+                KeyColumnIndex = 0;
+            }
+            for (int32 Index = 0; Index < InColumns.Num(); ++Index)
+            {
+                const FString ColumnName = InColumns[Index].TrimStartAndEnd();
+                HeaderColumns.Add(Index == KeyColumnIndex || ColumnName.IsEmpty() ? nullptr : BindColumn(ColumnName, 0));
+            }
+        }
+
+        /** CSV record: cells go through the same text import as the editor's CSV import; empty cells keep the current value */
+        void UpsertRecord(const TArray<FString>& Fields)
+        {
+            ++Processed;
+            if (!Fields.IsValidIndex(KeyColumnIndex) || Fields[KeyColumnIndex].TrimStartAndEnd().IsEmpty())
+            {
+                FailRow(FString(), FString(), TEXT("Missing row name"));
+                return;
+            }
+            if (Fields.Num() > HeaderColumns.Num())
+            {
+                FailRow(Fields[KeyColumnIndex], FString(), FString::Printf(TEXT("Row has %d cells, header has %d"), Fields.Num(), HeaderColumns.Num()));
+                return;
+            }
+
+            const FName RowName(*Fields[KeyColumnIndex].TrimStartAndEnd());
+            uint8* Existing = BeginRow(RowName);
+            for (int32 Index = 0; Index < Fields.Num(); ++Index)
+            {
+                const FColumn* Column = HeaderColumns[Index];
+                if (!Column || Fields[Index].IsEmpty())
+                {
+                    continue;
+                }
+                const FString ImportError = DataTableUtils::AssignStringToPropertyDirect(
+                    Fields[Index], Column->Path.Property, static_cast<uint8*>(Column->Path.GetValuePtr(Scratch)));
+                if (!ImportError.IsEmpty())
+                {
+                    FailRow(RowName.ToString(), Column->Name, ImportError);
+                    return;
+                }
+            }
+            CommitRow(RowName, Existing);
+        }
+
+        /** JSON row: values go through the typed property setters used by set_*_property */
+        void UpsertObject(const FString& RowNameString, const TSharedPtr<FJsonObject>& Row, const FString& KeyField)
+        {
+            ++Processed;
+            if (RowNameString.IsEmpty())
+            {
+                FailRow(FString(), FString(), FString::Printf(TEXT("Missing row name ('%s' field)"), *KeyField));
+                return;
+            }
+
+            const FName RowName(*RowNameString);
+            uint8* Existing = BeginRow(RowName);
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Row->Values)
+            {
+                if (Field.Key == KeyField)
+                {
+                    continue;
+                }
+                const FColumn* Column = BindColumn(Field.Key, Processed);
+                if (!Column)
+                {
+                    continue;
+                }
+                FString SetError;
+                if (!Column->Path.Setter(Column->Path.Property, Column->Path.GetValuePtr(Scratch), Field.Value, Field.Key, SetError))
+                {
+                    FailRow(RowNameString, Field.Key, SetError);
+                    return;
+                }
+            }
+            CommitRow(RowName, Existing);
+        }
+
+        /** Row that could not be parsed at all */
+        void FailRow(const FString& RowName, const FString& Column, const FString& Message)
+        {
+            ++Failed;
+            AddError(Processed, RowName, Column, Message);
+        }
+
+        void AddError(int32 RowIndex, const FString& RowName, const FString& Column, const FString& Message)
+        {
+            if (Errors.Num() >= MaxErrors)
+            {
+                bErrorsTruncated = true;
+                return;
+            }
+            TSharedPtr<FJsonObject> Error = MakeShared<FJsonObject>();
+            Error->SetNumberField(TEXT("row"), RowIndex);
+            if (!RowName.IsEmpty())
+            {
+                Error->SetStringField(TEXT("name"), RowName);
+            }
+            if (!Column.IsEmpty())
+            {
+                Error->SetStringField(TEXT("column"), Column);
+            }
+            Error->SetStringField(TEXT("message"), Message);
+            Errors.Add(MakeShared<FJsonValueObject>(Error));
+        }
+
+        /** Remove every row the import did not mention (rows that failed to import still count as mentioned) */
+        int32 RemoveUnseenRows()
+        {
+            TArray<FName> Unseen;
+            for (const FName& RowName : Table->GetRowNames())
+            {
+                if (!SeenRows.Contains(RowName))
+                {
+                    Unseen.Add(RowName);
+                }
+            }
+            if (!bDryRun)
+            {
+                for (const FName& RowName : Unseen)
+                {
+                    Table->RemoveRow(RowName);
+                }
+            }
+            return Unseen.Num();
+        }
+
+        int32 Processed = 0;
+        int32 Inserted = 0;
+        int32 Updated = 0;
+        int32 Failed = 0;
+        bool bErrorsTruncated = false;
+        TArray<TSharedPtr<FJsonValue>> Errors;
+
+    private:
+        struct FColumn
+        {
+            FString Name;
+            FSpirrowPropertyPath Path;
+        };
+
+        /** Resolve a column to a row struct field once; unknown columns are reported once and skipped */
+        const FColumn* BindColumn(const FString& ColumnName, int32 RowIndex)
+        {
+            if (const TOptional<FColumn>* Bound = Columns.Find(ColumnName))
+            {
+                return Bound->IsSet() ? &Bound->GetValue() : nullptr;
+            }
+
+            FString ErrorMessage;
+            TOptional<FColumn>& Bound = Columns.Add(ColumnName);
+            if (const FSpirrowPropertyPath* CachedPath = FSpirrowBridgePropertyPathCache::Get().Find(RowStruct, ColumnName, ErrorMessage))
+            {
+                Bound = FColumn{ ColumnName, *CachedPath };
+                return &Bound.GetValue();
+            }
+
+            // User defined structs store fields as "Health_2_<guid>"; match the authored name
+            for (TFieldIterator<FProperty> It(RowStruct); It; ++It)
+            {
+                if (RowStruct->GetAuthoredNameForField(*It) == ColumnName)
+                {
+                    FSpirrowPropertyPath Path;
+                    Path.Property = *It;
+                    Path.Offset = It->GetOffset_ForInternal();
+                    Path.Setter = FSpirrowBridgeCommonUtils::GetPropertySetter(*It);
+                    Bound = FColumn{ ColumnName, Path };
+                    return &Bound.GetValue();
+                }
+            }
+
+            AddError(RowIndex, FString(), ColumnName,
+                FString::Printf(TEXT("No field '%s' in %s; column ignored"), *ColumnName, *RowStruct->GetName()));
+            return nullptr;
+        }
+
+        uint8* BeginRow(FName RowName)
+        {
+            // Named in the source: kept by remove_missing even if a cell fails below
+            SeenRows.Add(RowName);
+            uint8* Existing = Table->FindRowUnchecked(RowName);
+            if (Existing)
+            {
+                RowStruct->CopyScriptStruct(Scratch, Existing);
+            }
+            else
+            {
+                RowStruct->ClearScriptStruct(Scratch);
+            }
+            return Existing;
+        }
+
+        void CommitRow(FName RowName, uint8* Existing)
+        {
+            if (Existing)
+            {
+                ++Updated;
+                if (!bDryRun)
+                {
+                    RowStruct->CopyScriptStruct(Existing, Scratch);
+                }
+            }
+            else
+            {
+                ++Inserted;
+                if (!bDryRun)
+                {
+                    Table->AddRow(RowName, Scratch, RowStruct);
+                }
+            }
+        }
+
+        UDataTable* Table;
+        const UScriptStruct* RowStruct;
+        uint8* Scratch = nullptr;
+        bool bDryRun;
+        int32 MaxErrors;
+        TMap<FString, TOptional<FColumn>> Columns;
+        TArray<const FColumn*> HeaderColumns;
+        int32 KeyColumnIndex = 0;
+        TSet<FName> SeenRows;
+    };
+}
+
+FSpirrowBridgeDataTableCommands::FSpirrowBridgeDataTableCommands()
+{
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeDataTableCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("upsert_datatable_rows"))
+    {
+        return HandleUpsertDataTableRows(Params);
+    }
+
+    return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+        ESpirrowErrorCode::UnknownCommand,
+        FString::Printf(TEXT("Unknown DataTable command: %s"), *CommandType));
+}
+
+UScriptStruct* FSpirrowBridgeDataTableCommands::FindRowStruct(const FString& StructName)
+{
+    if (StructName.Contains(TEXT("/")))
+    {
+        return LoadObject<UScriptStruct>(nullptr, *StructName);
+    }
+
+    UScriptStruct* Struct = FindFirstObject<UScriptStruct>(*StructName, EFindFirstObjectOptions::NativeFirst);
+    if (!Struct && StructName.StartsWith(TEXT("F")))
+    {
+        Struct = FindFirstObject<UScriptStruct>(*StructName.RightChop(1), EFindFirstObjectOptions::NativeFirst);
+    }
+    return Struct;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeDataTableCommands::HandleUpsertDataTableRows(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    FString TableName;
+    if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("datatable_name"), TableName))
+    {
+        return Error;
+    }
+
+    FString Path, RowStructName, FilePath, Format, CsvText, KeyField;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Data"));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("row_struct"), RowStructName);
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("file_path"), FilePath);
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("format"), Format);
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("csv"), CsvText);
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("key_field"), KeyField, TEXT("Name"));
+
+    bool bRemoveMissing = false;
+    bool bDryRun = false;
+    double MaxErrors = 100.0;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("remove_missing"), bRemoveMissing, false);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("dry_run"), bDryRun, false);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("max_errors"), MaxErrors, 100.0);
+
+    const TArray<TSharedPtr<FJsonValue>>* InlineRows = nullptr;
+    const TSharedPtr<FJsonObject>* InlineRowMap = nullptr;
+    if (!Params->TryGetArrayField(TEXT("rows"), InlineRows))
+    {
+        Params->TryGetObjectField(TEXT("rows"), InlineRowMap);
+    }
+
+    const int32 SourceCount = (FilePath.IsEmpty() ? 0 : 1) + (CsvText.IsEmpty() ? 0 : 1) + (InlineRows || InlineRowMap ? 1 : 0);
+    if (SourceCount != 1)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParams,
+            TEXT("Provide exactly one row source: file_path, csv or rows"));
+    }
+
+    if (!FilePath.IsEmpty())
+    {
+        if (FPaths::IsRelative(FilePath))
+        {
+            FilePath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), FilePath);
+        }
+        if (!FPaths::FileExists(FilePath))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::FileReadFailed,
+                FString::Printf(TEXT("File not found: %s"), *FilePath));
+        }
+        if (Format.IsEmpty())
+        {
+            Format = FPaths::GetExtension(FilePath).ToLower();
+        }
+        if (Format != TEXT("csv") && Format != TEXT("json"))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParamValue,
+                FString::Printf(TEXT("Unsupported format '%s'. Use csv or json"), *Format));
+        }
+        if (Format == TEXT("json"))
+        {
+            // Check the array structure before touching the table: a malformed row halfway through
+            // the file must not leave the rows before it applied
+            FString StructureError;
+            FJsonRowSplitter Scanner;
+            const bool bRead = StreamFile(FilePath, [&Scanner](const uint8* Data, int64 Num)
+            {
+                return Scanner.Feed(Data, Num, [](const FString&) { return true; });
+            }, StructureError);
+            if (!bRead)
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(ESpirrowErrorCode::FileReadFailed, StructureError);
+            }
+            if (!Scanner.Error.IsEmpty() || !Scanner.Finish())
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::InvalidParamValue,
+                    FString::Printf(TEXT("%s: %s"), *FilePath, *Scanner.Error));
+            }
+        }
+    }
+
+    // Resolve the row struct first: it is needed to create a missing table and to validate an existing one
+    UScriptStruct* RowStruct = nullptr;
+    if (!RowStructName.IsEmpty())
+    {
+        RowStruct = FindRowStruct(RowStructName);
+        if (!RowStruct || !FDataTableEditorUtils::IsValidTableStruct(RowStruct))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParamValue,
+                FString::Printf(TEXT("Row struct not found or not usable in a DataTable: %s"), *RowStructName));
+        }
+    }
+
+    bool bCreated = false;
+    UDataTable* Table = FSpirrowBridgeAssetResolver::Get().Resolve<UDataTable>(TableName, Path);
+    if (!Table)
+    {
+        TArray<FSoftObjectPath> Candidates;
+        if (!RowStruct || FSpirrowBridgeAssetResolver::Get().FindByName(TableName, UDataTable::StaticClass(), Candidates) == ESpirrowAssetLookup::Ambiguous)
+        {
+            return FSpirrowBridgeAssetResolver::Get().MakeResolveError(TableName, Path, UDataTable::StaticClass(),
+                ESpirrowErrorCode::AssetNotFound,
+                FString::Printf(TEXT("DataTable not found: %s at %s (pass row_struct to create it)"), *TableName, *Path));
+        }
+        if (!bDryRun)
+        {
+            const FString PackagePath = Path / TableName;
+            UPackage* Package = CreatePackage(*PackagePath);
+            if (!Package)
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::AssetCreationFailed,
+                    TEXT("Failed to create package"));
+            }
+
+            Table = NewObject<UDataTable>(Package, *TableName, RF_Public | RF_Standalone | RF_Transactional);
+            Table->RowStruct = RowStruct;
+            FAssetRegistryModule::AssetCreated(Table);
+            bCreated = true;
+        }
+        else
+        {
+            // Validate against a throwaway table so dry runs never create assets
+            Table = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+            Table->RowStruct = RowStruct;
+        }
+    }
+    else if (RowStruct && Table->GetRowStruct() != RowStruct)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::PropertyTypeMismatch,
+            FString::Printf(TEXT("DataTable %s uses row struct %s, not %s"),
+                *TableName, *GetNameSafe(Table->GetRowStruct()), *RowStruct->GetName()));
+    }
+
+    if (!Table->GetRowStruct())
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidOperation,
+            FString::Printf(TEXT("DataTable %s has no row struct"), *TableName));
+    }
+
+    if (!bDryRun)
+    {
+        Table->Modify();
+        FDataTableEditorUtils::BroadcastPreChange(Table, FDataTableEditorUtils::EDataTableChangeInfo::RowList);
+    }
+
+    FDataTableRowUpserter Upserter(Table, bDryRun, FMath::Max(0, static_cast<int32>(MaxErrors)));
+    FString FatalError;
+    FString Source;
+
+    const auto UpsertJsonRow = [&Upserter, &KeyField](const TSharedPtr<FJsonObject>& Row)
+    {
+        FString RowName;
+        Row->TryGetStringField(KeyField, RowName);
+        Upserter.UpsertObject(RowName, Row, KeyField);
+    };
+
+    if (!CsvText.IsEmpty() || Format == TEXT("csv"))
+    {
+        // First record is the header, every later one a row
+        bool bHaveHeader = false;
+        TArray<FString> Fields;
+        const auto OnRecord = [&](const FString& Record)
+        {
+            if (Record.TrimStartAndEnd().IsEmpty())
+            {
+                return true;
+            }
+            ParseCsvFields(Record, Fields);
+            if (!bHaveHeader)
+            {
+                Upserter.SetHeader(Fields, KeyField);
+                bHaveHeader = true;
+            }
+            else
+            {
+                Upserter.UpsertRecord(Fields);
+            }
+            return true;
+        };
+
+        FCsvRecordSplitter Splitter;
+        if (!CsvText.IsEmpty())
+        {
+            Source = TEXT("csv");
+            const FTCHARToUTF8 Utf8(*CsvText);
+            Splitter.Feed(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length(), OnRecord);
+        }
+        else
+        {
+            Source = TEXT("csv_file");
+            StreamFile(FilePath, [&Splitter, &OnRecord](const uint8* Data, int64 Num)
+            {
+                return Splitter.Feed(Data, Num, OnRecord);
+            }, FatalError);
+        }
+        Splitter.Finish(OnRecord);
+    }
+    else if (Format == TEXT("json"))
+    {
+        Source = TEXT("json_file");
+        FJsonRowSplitter Splitter;
+        const auto OnRow = [&Upserter, &UpsertJsonRow](const FString& RowText)
+        {
+            TSharedPtr<FJsonObject> Row;
+            if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(RowText), Row) || !Row.IsValid())
+            {
+                ++Upserter.Processed;
+                Upserter.FailRow(FString(), FString(), TEXT("Row is not valid JSON"));
+                return true;
+            }
+            UpsertJsonRow(Row);
+            return true;
+        };
+        const bool bRead = StreamFile(FilePath, [&Splitter, &OnRow](const uint8* Data, int64 Num)
+        {
+            return Splitter.Feed(Data, Num, OnRow);
+        }, FatalError);
+        if (bRead && (!Splitter.Error.IsEmpty() || !Splitter.Finish()))
+        {
+            FatalError = Splitter.Error;
+        }
+    }
+    else if (InlineRows)
+    {
+        Source = TEXT("rows");
+        for (const TSharedPtr<FJsonValue>& RowValue : *InlineRows)
+        {
+            const TSharedPtr<FJsonObject>* Row = nullptr;
+            if (!RowValue.IsValid() || !RowValue->TryGetObject(Row))
+            {
+                ++Upserter.Processed;
+                Upserter.FailRow(FString(), FString(), TEXT("Row is not a JSON object"));
+                continue;
+            }
+            UpsertJsonRow(*Row);
+        }
+    }
+    else
+    {
+        // { "RowName": { ...fields } }
+        Source = TEXT("rows");
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*InlineRowMap)->Values)
+        {
+            const TSharedPtr<FJsonObject>* Row = nullptr;
+            if (!Entry.Value.IsValid() || !Entry.Value->TryGetObject(Row))
+            {
+                ++Upserter.Processed;
+                Upserter.FailRow(Entry.Key, FString(), TEXT("Row is not a JSON object"));
+                continue;
+            }
+            Upserter.UpsertObject(Entry.Key, *Row, KeyField);
+        }
+    }
+
+    // Only prune when the whole source was read, otherwise a truncated file would empty the table
+    int32 Removed = 0;
+    if (bRemoveMissing && FatalError.IsEmpty())
+    {
+        Removed = Upserter.RemoveUnseenRows();
+    }
+
+    if (!bDryRun)
+    {
+        FDataTableEditorUtils::BroadcastPostChange(Table, FDataTableEditorUtils::EDataTableChangeInfo::RowList);
+        Table->MarkPackageDirty();
+        // Only a read error can still stop the import here; never persist half a file
+        if (FatalError.IsEmpty())
+        {
+            FSpirrowBridgeSaveManager::Get().RequestSave(Table);
+        }
+    }
+
+    if (!FatalError.IsEmpty() && !bDryRun)
+    {
+        FatalError += FString::Printf(TEXT(" (%d row(s) applied before the error were not saved)"),
+            Upserter.Inserted + Upserter.Updated);
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+    Result->SetBoolField(TEXT("success"), FatalError.IsEmpty());
+    if (!FatalError.IsEmpty())
+    {
+        Result->SetStringField(TEXT("error"), FatalError);
+    }
+    Result->SetStringField(TEXT("datatable"), Table->HasAnyFlags(RF_Transient) ? Path / TableName : Table->GetPathName());
+    Result->SetStringField(TEXT("row_struct"), Table->GetRowStruct()->GetName());
+    Result->SetStringField(TEXT("source"), Source);
+    Result->SetBoolField(TEXT("created"), bCreated);
+    Result->SetBoolField(TEXT("dry_run"), bDryRun);
+    Result->SetNumberField(TEXT("processed"), Upserter.Processed);
+    Result->SetNumberField(TEXT("inserted"), Upserter.Inserted);
+    Result->SetNumberField(TEXT("updated"), Upserter.Updated);
+    Result->SetNumberField(TEXT("failed"), Upserter.Failed);
+    Result->SetNumberField(TEXT("removed"), Removed);
+    Result->SetNumberField(TEXT("row_count"), Table->GetRowMap().Num());
+    Result->SetArrayField(TEXT("errors"), Upserter.Errors);
+    Result->SetBoolField(TEXT("errors_truncated"), Upserter.bErrorsTruncated);
+    Result->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return Result;
+}
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeEQSCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 
 // Asset includes
 #include "EditorAssetLibrary.h"
@@ -121,10 +122,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeEQSCommands::HandleCreateEQSQuery(const TS
 	NewQuery->MarkPackageDirty();
 
 	// Save the package
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Package, NewQuery, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(NewQuery);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
@@ -249,11 +247,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeEQSCommands::HandleAddEQSGenerator(const T
 	// Mark as dirty and save
 	Query->MarkPackageDirty();
 
-	FString PackagePath = FString::Printf(TEXT("%s/%s"), *Path, *QueryName);
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Query->GetOutermost(), Query, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Query);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
@@ -371,11 +365,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeEQSCommands::HandleAddEQSTest(const TShare
 	// Mark as dirty and save
 	Query->MarkPackageDirty();
 
-	FString PackagePath = FString::Printf(TEXT("%s/%s"), *Path, *QueryName);
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Query->GetOutermost(), Query, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Query);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
@@ -473,11 +463,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeEQSCommands::HandleSetEQSTestProperty(cons
 	// Mark as dirty and save
 	Query->MarkPackageDirty();
 
-	FString PackagePath = FString::Printf(TEXT("%s/%s"), *Path, *QueryName);
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	UPackage::SavePackage(Query->GetOutermost(), Query, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(Query);
 
 	// Build response
 	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
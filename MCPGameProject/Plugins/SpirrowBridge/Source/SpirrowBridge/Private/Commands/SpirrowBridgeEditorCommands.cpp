@@ -1,5 +1,7 @@
 #include "Commands/SpirrowBridgeEditorCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeLevelCommands.h"
 #include "Editor.h"
 #include "EditorViewportClient.h"
 #include "LevelEditorViewport.h"
@@ -35,6 +37,76 @@
 // For creating brush geometry
 #include "ActorFactories/ActorFactory.h"
 #include "Builders/CubeBuilder.h"
+// World Partition descriptor queries
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+
+namespace
+{
+    /**
+     * Read the shared "source" and "bounds" query params.
+     * source: "loaded" (default, actors in memory) or "descriptors" (World Partition actor descriptors, nothing is loaded)
+     */
+    TSharedPtr<FJsonObject> ParseActorQuery(const TSharedPtr<FJsonObject>& Params, FString& OutSource, FSpirrowBridgeActorFilter& OutFilter)
+    {
+        FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("source"), OutSource, TEXT("loaded"));
+        if (OutSource != TEXT("loaded") && OutSource != TEXT("descriptors"))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParamValue,
+                FString::Printf(TEXT("Invalid source '%s' (expected 'loaded' or 'descriptors')"), *OutSource));
+        }
+
+        const TSharedPtr<FJsonObject>* BoundsObj = nullptr;
+        if (Params.IsValid() && Params->TryGetObjectField(TEXT("bounds"), BoundsObj))
+        {
+            if (!(*BoundsObj)->HasField(TEXT("min")) || !(*BoundsObj)->HasField(TEXT("max")))
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::InvalidParamValue,
+                    TEXT("bounds requires both 'min' and 'max' as [x, y, z]"));
+            }
+            const FVector Min = FSpirrowBridgeCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("min"));
+            const FVector Max = FSpirrowBridgeCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("max"));
+            OutFilter.Bounds = FBox(Min.ComponentMin(Max), Min.ComponentMax(Max));
+            OutFilter.bHasBounds = true;
+        }
+        return nullptr;
+    }
+
+    /** The editor world; GWorld can point at a PIE world while a session is running */
+    UWorld* GetEditorWorld()
+    {
+        return GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    }
+
+    /** Name pattern match shared by loaded actors and descriptors, so both sources return the same actors */
+    bool MatchesNamePattern(const FString& Name, const FString& Label, const FString& Pattern)
+    {
+        return Name.Contains(Pattern) || Label.Contains(Pattern);
+    }
+
+    /** Visit every actor descriptor of the editor world. Returns an error response if the map is not World Partition */
+    TSharedPtr<FJsonObject> ForEachActorDesc(TFunctionRef<void(const FWorldPartitionActorDescInstance*)> Func)
+    {
+        UWorld* World = GetEditorWorld();
+        UWorldPartition* WorldPartition = World ? World->GetWorldPartition() : nullptr;
+        if (!WorldPartition)
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParamValue,
+                TEXT("source 'descriptors' requires a World Partition map"));
+        }
+
+        FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, AActor::StaticClass(), [&Func](const FWorldPartitionActorDescInstance* ActorDesc)
+        {
+            Func(ActorDesc);
+            return true;
+        });
+        return nullptr;
+    }
+}
 
 FSpirrowBridgeEditorCommands::FSpirrowBridgeEditorCommands()
 {
@@ -108,20 +180,46 @@ TSharedPtr<FJsonObject> FSpirrowBridgeEditorCommands::HandleCommand(const FStrin
 
 TSharedPtr<FJsonObject> FSpirrowBridgeEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
 {
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
+    FString Source;
+    FSpirrowBridgeActorFilter Filter;
+    if (auto Error = ParseActorQuery(Params, Source, Filter))
+    {
+        return Error;
+    }
+
     TArray<TSharedPtr<FJsonValue>> ActorArray;
-    for (AActor* Actor : AllActors)
+    if (Source == TEXT("descriptors"))
     {
-        if (Actor)
+        auto Error = ForEachActorDesc([&ActorArray, &Filter](const FWorldPartitionActorDescInstance* ActorDesc)
         {
-            ActorArray.Add(FSpirrowBridgeCommonUtils::ActorToJson(Actor));
+            if (!Filter.bHasBounds || Filter.Bounds.Intersect(ActorDesc->GetEditorBounds()))
+            {
+                ActorArray.Add(FSpirrowBridgeCommonUtils::ActorDescToJson(ActorDesc));
+            }
+        });
+        if (Error)
+        {
+            return Error;
+        }
+    }
+    else
+    {
+        TArray<AActor*> AllActors;
+        UGameplayStatics::GetAllActorsOfClass(GetEditorWorld(), AActor::StaticClass(), AllActors);
+        
+        for (AActor* Actor : AllActors)
+        {
+            if (Actor && Filter.Matches(Actor))
+            {
+                ActorArray.Add(FSpirrowBridgeCommonUtils::ActorToJson(Actor));
+            }
         }
     }
     
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetArrayField(TEXT("actors"), ActorArray);
+    ResultObj->SetNumberField(TEXT("count"), ActorArray.Num());
+    ResultObj->SetStringField(TEXT("source"), Source);
     
     return ResultObj;
 }
@@ -135,21 +233,47 @@ TSharedPtr<FJsonObject> FSpirrowBridgeEditorCommands::HandleFindActorsByName(con
         return Error;
     }
     
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
+    FString Source;
+    FSpirrowBridgeActorFilter Filter;
+    if (auto Error = ParseActorQuery(Params, Source, Filter))
+    {
+        return Error;
+    }
+
     TArray<TSharedPtr<FJsonValue>> MatchingActors;
-    for (AActor* Actor : AllActors)
+    if (Source == TEXT("descriptors"))
     {
-        if (Actor && Actor->GetName().Contains(Pattern))
+        auto Error = ForEachActorDesc([&MatchingActors, &Filter, &Pattern](const FWorldPartitionActorDescInstance* ActorDesc)
         {
-            MatchingActors.Add(FSpirrowBridgeCommonUtils::ActorToJson(Actor));
+            if (MatchesNamePattern(ActorDesc->GetActorName().ToString(), ActorDesc->GetActorLabel().ToString(), Pattern) &&
+                (!Filter.bHasBounds || Filter.Bounds.Intersect(ActorDesc->GetEditorBounds())))
+            {
+                MatchingActors.Add(FSpirrowBridgeCommonUtils::ActorDescToJson(ActorDesc));
+            }
+        });
+        if (Error)
+        {
+            return Error;
+        }
+    }
+    else
+    {
+        TArray<AActor*> AllActors;
+        UGameplayStatics::GetAllActorsOfClass(GetEditorWorld(), AActor::StaticClass(), AllActors);
+        
+        for (AActor* Actor : AllActors)
+        {
+            if (Actor && MatchesNamePattern(Actor->GetName(), Actor->GetActorLabel(), Pattern) && Filter.Matches(Actor))
+            {
+                MatchingActors.Add(FSpirrowBridgeCommonUtils::ActorToJson(Actor));
+            }
         }
     }
     
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetBoolField(TEXT("success"), true);
     ResultObj->SetStringField(TEXT("pattern"), Pattern);
+    ResultObj->SetStringField(TEXT("source"), Source);
     ResultObj->SetArrayField(TEXT("actors"), MatchingActors);
     ResultObj->SetNumberField(TEXT("count"), MatchingActors.Num());
 
@@ -685,6 +809,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeEditorCommands::HandleSpawnBlueprintActor(
     FActorSpawnParameters SpawnParams;
     SpawnParams.Name = *ActorName;
 
+    FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
     AActor* NewActor = World->SpawnActor<AActor>(Blueprint->GeneratedClass, SpawnTransform, SpawnParams);
     if (NewActor)
     {
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeGASCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFileManager.h"
@@ -639,10 +640,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeGASCommands::HandleCreateGameplayEffect(co
     Blueprint->MarkPackageDirty();
     FKismetEditorUtilities::CompileBlueprint(Blueprint);
 
-    FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+    FSpirrowBridgeSaveManager::Get().RequestSave(Blueprint);
 
     FAssetRegistryModule::AssetCreated(Blueprint);
 
@@ -1067,10 +1065,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeGASCommands::HandleCreateGameplayAbility(c
     Blueprint->MarkPackageDirty();
     FKismetEditorUtilities::CompileBlueprint(Blueprint);
 
-    FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs);
+    FSpirrowBridgeSaveManager::Get().RequestSave(Blueprint);
 
     FAssetRegistryModule::AssetCreated(Blueprint);
 
@@ -0,0 +1,1520 @@
+#include "Commands/SpirrowBridgeLevelCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeLevelSnapshot.h"
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgePropertyPathCache.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "ScopedTransaction.h"
+#include "GameFramework/Actor.h"
+#include "Engine/Blueprint.h"
+#include "Engine/Level.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/Paths.h"
+#include "Misc/PackageName.h"
+#include "HAL/FileManager.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+#include "WorldPartition/WorldPartitionEditorLoaderAdapter.h"
+#include "WorldPartition/LoaderAdapter/LoaderAdapterShape.h"
+
+// ============================================
+// Actor filter
+// ============================================
+
+TSharedPtr<FJsonObject> FSpirrowBridgeActorFilter::Parse(const TSharedPtr<FJsonObject>& Params, const FString& FieldName, FSpirrowBridgeActorFilter& OutFilter)
+{
+    OutFilter = FSpirrowBridgeActorFilter();
+
+    const TSharedPtr<FJsonObject>* FilterObj = nullptr;
+    if (!Params.IsValid() || !Params->TryGetObjectField(FieldName, FilterObj) || !FilterObj || !(*FilterObj).IsValid())
+    {
+        // No filter means "every actor"
+        return nullptr;
+    }
+    const TSharedPtr<FJsonObject>& Filter = *FilterObj;
+
+    // A misspelled key would otherwise widen the filter to every actor
+    static const TSet<FString> KnownKeys = {
+        TEXT("names"), TEXT("selected"), TEXT("class"), TEXT("label"), TEXT("tag"),
+        TEXT("folder"), TEXT("bounds"), TEXT("load_region"), TEXT("all")
+    };
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Filter->Values)
+    {
+        if (!KnownKeys.Contains(Field.Key))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParamValue,
+                FString::Printf(TEXT("Unknown %s key '%s' (expected names, selected, class, label, tag, folder, bounds, load_region or all)"),
+                    *FieldName, *Field.Key));
+        }
+    }
+    Filter->TryGetBoolField(TEXT("all"), OutFilter.bAll);
+
+    const TArray<TSharedPtr<FJsonValue>>* NamesArray = nullptr;
+    if (Filter->TryGetArrayField(TEXT("names"), NamesArray))
+    {
+        for (const TSharedPtr<FJsonValue>& NameValue : *NamesArray)
+        {
+            OutFilter.Names.Add(NameValue->AsString());
+        }
+    }
+
+    Filter->TryGetBoolField(TEXT("selected"), OutFilter.bSelectedOnly);
+    Filter->TryGetStringField(TEXT("label"), OutFilter.LabelPattern);
+    Filter->TryGetStringField(TEXT("folder"), OutFilter.FolderPath);
+
+    FString TagString;
+    if (Filter->TryGetStringField(TEXT("tag"), TagString) && !TagString.IsEmpty())
+    {
+        OutFilter.Tag = FName(*TagString);
+    }
+
+    FString ClassName;
+    if (Filter->TryGetStringField(TEXT("class"), ClassName) && !ClassName.IsEmpty())
+    {
+        OutFilter.ActorClass = ResolveActorClass(ClassName);
+        if (!OutFilter.ActorClass)
+        {
+            TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
+            Details->SetStringField(TEXT("class"), ClassName);
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::ClassNotFound,
+                FString::Printf(TEXT("Actor class not found: %s"), *ClassName),
+                Details);
+        }
+    }
+
+    const TSharedPtr<FJsonObject>* BoundsObj = nullptr;
+    if (Filter->TryGetObjectField(TEXT("bounds"), BoundsObj) && BoundsObj && (*BoundsObj).IsValid())
+    {
+        if (!(*BoundsObj)->HasField(TEXT("min")) || !(*BoundsObj)->HasField(TEXT("max")))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParamValue,
+                TEXT("filter.bounds requires both 'min' and 'max' as [x, y, z]"));
+        }
+        const FVector Min = FSpirrowBridgeCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("min"));
+        const FVector Max = FSpirrowBridgeCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("max"));
+        OutFilter.Bounds = FBox(Min.ComponentMin(Max), Min.ComponentMax(Max));
+        OutFilter.bHasBounds = true;
+    }
+
+    Filter->TryGetBoolField(TEXT("load_region"), OutFilter.bLoadRegion);
+    if (OutFilter.bLoadRegion && !OutFilter.bHasBounds)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            TEXT("filter.load_region requires filter.bounds"));
+    }
+
+    return nullptr;
+}
+
+bool FSpirrowBridgeActorFilter::HasCriteria() const
+{
+    return Names.Num() > 0 || bSelectedOnly || ActorClass || !LabelPattern.IsEmpty() ||
+        !Tag.IsNone() || !FolderPath.IsEmpty() || bHasBounds;
+}
+
+UClass* FSpirrowBridgeActorFilter::ResolveActorClass(const FString& ClassName)
+{
+    UClass* FoundClass = nullptr;
+
+    if (ClassName.StartsWith(TEXT("/")))
+    {
+        // Native class path (/Script/Engine.StaticMeshActor) or Blueprint asset path
+        FoundClass = LoadClass<AActor>(nullptr, *ClassName);
+        if (!FoundClass)
+        {
+            if (UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *ClassName))
+            {
+                FoundClass = Blueprint->GeneratedClass;
+            }
+        }
+    }
+    else
+    {
+        FoundClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
+
+        // Accept the C++ prefixed form as well ("AStaticMeshActor")
+        if (!FoundClass && ClassName.Len() > 1 && ClassName[0] == TEXT('A'))
+        {
+            FoundClass = FindFirstObject<UClass>(*ClassName.RightChop(1), EFindFirstObjectOptions::NativeFirst);
+        }
+    }
+
+    return (FoundClass && FoundClass->IsChildOf(AActor::StaticClass())) ? FoundClass : nullptr;
+}
+
+bool FSpirrowBridgeActorFilter::Matches(AActor* Actor) const
+{
+    if (!IsValid(Actor))
+    {
+        return false;
+    }
+
+    // Cheapest checks first
+    if (ActorClass && !Actor->IsA(ActorClass))
+    {
+        return false;
+    }
+    if (bSelectedOnly && !Actor->IsSelected())
+    {
+        return false;
+    }
+    if (!Tag.IsNone() && !Actor->ActorHasTag(Tag))
+    {
+        return false;
+    }
+    if (Names.Num() > 0 && !Names.Contains(Actor->GetName()) && !Names.Contains(Actor->GetActorLabel()))
+    {
+        return false;
+    }
+    if (!LabelPattern.IsEmpty() && !Actor->GetActorLabel().MatchesWildcard(LabelPattern))
+    {
+        return false;
+    }
+    if (!FolderPath.IsEmpty())
+    {
+        // Folder filter also matches sub-folders ("Props" matches "Props/Trees")
+        const FString ActorFolder = Actor->GetFolderPath().ToString();
+        if (ActorFolder != FolderPath && !ActorFolder.StartsWith(FolderPath + TEXT("/")))
+        {
+            return false;
+        }
+    }
+    if (bHasBounds)
+    {
+        // Actors without primitive bounds (lights, cameras) are tested by location
+        const FBox ActorBounds = Actor->GetComponentsBoundingBox(true);
+        const bool bInside = ActorBounds.IsValid
+            ? Bounds.Intersect(ActorBounds)
+            : Bounds.IsInsideOrOn(Actor->GetActorLocation());
+        if (!bInside)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FSpirrowBridgeActorFilter::Collect(UWorld* World, TArray<AActor*>& OutActors) const
+{
+    if (!World)
+    {
+        return;
+    }
+
+    // Class-filtered iteration lets the world skip unrelated actor buckets
+    for (TActorIterator<AActor> It(World, ActorClass ? ActorClass : AActor::StaticClass()); It; ++It)
+    {
+        if (Matches(*It))
+        {
+            OutActors.Add(*It);
+        }
+    }
+}
+
+namespace
+{
+    /** A World Partition region loaded by the bridge; one per world and bounds */
+    struct FBridgeLoadedRegion
+    {
+        TWeakObjectPtr<UWorld> World;
+        FBox Bounds = FBox(ForceInit);
+        TWeakObjectPtr<UWorldPartitionEditorLoaderAdapter> Adapter;
+        /** Set once any caller needs the region to outlive its command */
+        bool bKeepLoaded = false;
+    };
+
+    TArray<FBridgeLoadedRegion>& GetLoadedRegions()
+    {
+        static TArray<FBridgeLoadedRegion> Regions;
+        return Regions;
+    }
+
+    /** Drop entries whose world or adapter is gone (map change, region removed in the editor) */
+    void PruneLoadedRegions()
+    {
+        GetLoadedRegions().RemoveAll([](const FBridgeLoadedRegion& Region)
+        {
+            return !Region.World.IsValid() || !Region.Adapter.IsValid();
+        });
+    }
+
+    FBridgeLoadedRegion* FindLoadedRegion(UWorld* World, const FBox& Bounds)
+    {
+        return GetLoadedRegions().FindByPredicate([World, &Bounds](const FBridgeLoadedRegion& Region)
+        {
+            return Region.World.Get() == World && Region.Bounds.Equals(Bounds);
+        });
+    }
+
+    bool HasDirtyActorsInBounds(UWorldPartition* WorldPartition, const FBox& Bounds)
+    {
+        bool bDirty = false;
+        FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, AActor::StaticClass(), [&Bounds, &bDirty](const FWorldPartitionActorDescInstance* ActorDesc)
+        {
+            AActor* Actor = ActorDesc->IsLoaded() ? ActorDesc->GetActor() : nullptr;
+            if (Actor && Bounds.Intersect(ActorDesc->GetEditorBounds()) && Actor->GetPackage()->IsDirty())
+            {
+                bDirty = true;
+                return false;
+            }
+            return true;
+        });
+        return bDirty;
+    }
+
+    void UnloadRegion(UWorld* World, UWorldPartitionEditorLoaderAdapter* Adapter)
+    {
+        if (Adapter->GetLoaderAdapter())
+        {
+            Adapter->GetLoaderAdapter()->Unload();
+        }
+        if (UWorldPartition* WorldPartition = World->GetWorldPartition())
+        {
+            WorldPartition->ReleaseEditorLoaderAdapter(Adapter);
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeActorFilter::LoadRegion(UWorld* World, int32& OutActorsLoaded, bool bKeepLoaded) const
+{
+    OutActorsLoaded = 0;
+    if (!bLoadRegion)
+    {
+        return nullptr;
+    }
+
+    UWorldPartition* WorldPartition = World ? World->GetWorldPartition() : nullptr;
+    if (!WorldPartition)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            TEXT("load_region requires a World Partition map"));
+    }
+
+    PruneLoadedRegions();
+    if (FBridgeLoadedRegion* Existing = FindLoadedRegion(World, Bounds))
+    {
+        // Already loaded by an earlier command: nothing new comes in
+        Existing->bKeepLoaded |= bKeepLoaded;
+        return nullptr;
+    }
+
+    auto CountLoadedInBounds = [this, WorldPartition]()
+    {
+        int32 Count = 0;
+        FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, AActor::StaticClass(), [this, &Count](const FWorldPartitionActorDescInstance* ActorDesc)
+        {
+            if (ActorDesc->IsLoaded() && Bounds.Intersect(ActorDesc->GetEditorBounds()))
+            {
+                ++Count;
+            }
+            return true;
+        });
+        return Count;
+    };
+
+    const int32 LoadedBefore = CountLoadedInBounds();
+
+    // Same path as "Load Region" in the World Partition editor
+    UWorldPartitionEditorLoaderAdapter* EditorLoaderAdapter =
+        WorldPartition->CreateEditorLoaderAdapter<FLoaderAdapterShape>(World, Bounds, TEXT("SpirrowBridge Region"));
+    if (!EditorLoaderAdapter || !EditorLoaderAdapter->GetLoaderAdapter())
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::OperationFailed,
+            TEXT("Failed to create World Partition loader region"));
+    }
+    EditorLoaderAdapter->GetLoaderAdapter()->SetUserCreated(true);
+    EditorLoaderAdapter->GetLoaderAdapter()->Load();
+
+    FBridgeLoadedRegion& Region = GetLoadedRegions().AddDefaulted_GetRef();
+    Region.World = World;
+    Region.Bounds = Bounds;
+    Region.Adapter = EditorLoaderAdapter;
+    Region.bKeepLoaded = bKeepLoaded;
+
+    OutActorsLoaded = CountLoadedInBounds() - LoadedBefore;
+    return nullptr;
+}
+
+void FSpirrowBridgeActorFilter::ReleaseRegion(UWorld* World) const
+{
+    if (!bLoadRegion)
+    {
+        return;
+    }
+
+    PruneLoadedRegions();
+    TArray<FBridgeLoadedRegion>& Regions = GetLoadedRegions();
+    const int32 Index = Regions.IndexOfByPredicate([World, this](const FBridgeLoadedRegion& Region)
+    {
+        return Region.World.Get() == World && Region.Bounds.Equals(Bounds);
+    });
+    if (Index == INDEX_NONE || Regions[Index].bKeepLoaded)
+    {
+        return;
+    }
+
+    UnloadRegion(World, Regions[Index].Adapter.Get());
+    Regions.RemoveAt(Index);
+}
+
+int32 FSpirrowBridgeActorFilter::UnloadRegions(UWorld* World, const FBox* InBounds, int32& OutSkippedDirty)
+{
+    OutSkippedDirty = 0;
+    UWorldPartition* WorldPartition = World ? World->GetWorldPartition() : nullptr;
+    if (!WorldPartition)
+    {
+        return 0;
+    }
+
+    PruneLoadedRegions();
+    int32 Unloaded = 0;
+    TArray<FBridgeLoadedRegion>& Regions = GetLoadedRegions();
+    for (int32 Index = Regions.Num() - 1; Index >= 0; --Index)
+    {
+        const FBridgeLoadedRegion& Region = Regions[Index];
+        if (Region.World.Get() != World || (InBounds && !Region.Bounds.Equals(*InBounds)))
+        {
+            continue;
+        }
+        // Unloading would drop edits that have not been saved yet
+        if (HasDirtyActorsInBounds(WorldPartition, Region.Bounds))
+        {
+            ++OutSkippedDirty;
+            continue;
+        }
+
+        UnloadRegion(World, Region.Adapter.Get());
+        Regions.RemoveAt(Index);
+        ++Unloaded;
+    }
+    return Unloaded;
+}
+
+// ============================================
+// Level commands
+// ============================================
+
+FSpirrowBridgeLevelCommands::FSpirrowBridgeLevelCommands()
+{
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeLevelCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("consolidate_to_instances"))
+    {
+        return HandleConsolidateToInstances(Params);
+    }
+    else if (CommandType == TEXT("update_actors_where"))
+    {
+        return HandleUpdateActorsWhere(Params);
+    }
+    else if (CommandType == TEXT("get_properties_batch"))
+    {
+        return HandleGetPropertiesBatch(Params);
+    }
+    else if (CommandType == TEXT("export_level_snapshot"))
+    {
+        return HandleExportLevelSnapshot(Params);
+    }
+    else if (CommandType == TEXT("diff_level_snapshots"))
+    {
+        return HandleDiffLevelSnapshots(Params);
+    }
+    else if (CommandType == TEXT("load_world_partition_region"))
+    {
+        return HandleLoadWorldPartitionRegion(Params);
+    }
+    else if (CommandType == TEXT("unload_world_partition_region"))
+    {
+        return HandleUnloadWorldPartitionRegion(Params);
+    }
+
+    return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+        ESpirrowErrorCode::UnknownCommand,
+        FString::Printf(TEXT("Unknown level command: %s"), *CommandType));
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeLevelCommands::HandleConsolidateToInstances(const TSharedPtr<FJsonObject>& Params)
+{
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::OperationFailed,
+            TEXT("Failed to get editor world"));
+    }
+
+    FSpirrowBridgeActorFilter Filter;
+    if (auto Error = FSpirrowBridgeActorFilter::Parse(Params, TEXT("filter"), Filter))
+    {
+        return Error;
+    }
+    if (!Filter.ActorClass)
+    {
+        Filter.ActorClass = AStaticMeshActor::StaticClass();
+    }
+
+    double MinInstancesValue;
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("min_instances"), MinInstancesValue, 2.0);
+    const int32 MinInstances = FMath::Max(1, static_cast<int32>(MinInstancesValue));
+
+    bool bDeleteOriginals, bDryRun;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("delete_originals"), bDeleteOriginals, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("dry_run"), bDryRun, false);
+
+    FString NamePrefix, TargetFolder;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("name_prefix"), NamePrefix, TEXT("HISM_"));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("target_folder"), TargetFolder);
+
+    // Edited actors must stay loaded until saved; a dry run releases the region again
+    int32 RegionActorsLoaded = 0;
+    if (auto Error = Filter.LoadRegion(World, RegionActorsLoaded, !bDryRun))
+    {
+        return Error;
+    }
+
+    TArray<AActor*> Candidates;
+    Filter.Collect(World, Candidates);
+
+    // Group by level + mesh + material set. Only plain StaticMeshActors are merged;
+    // anything carrying extra behaviour (children, instanced components) is skipped.
+    struct FInstanceGroup
+    {
+        ULevel* Level = nullptr;
+        UStaticMesh* Mesh = nullptr;
+        UStaticMeshComponent* Template = nullptr;
+        TArray<UMaterialInterface*> Materials;
+        TArray<AActor*> Actors;
+        TArray<FTransform> Transforms;
+        int32 ComponentCount = 0;
+    };
+    TMap<FString, FInstanceGroup> Groups;
+    TArray<TSharedPtr<FJsonValue>> SkippedArray;
+
+    auto AddSkipped = [&SkippedArray](AActor* Actor, const TCHAR* Reason)
+    {
+        TSharedPtr<FJsonObject> SkippedObj = MakeShared<FJsonObject>();
+        SkippedObj->SetStringField(TEXT("actor"), Actor->GetName());
+        SkippedObj->SetStringField(TEXT("reason"), Reason);
+        SkippedArray.Add(MakeShared<FJsonValueObject>(SkippedObj));
+    };
+
+    for (AActor* Actor : Candidates)
+    {
+        AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(Actor);
+        UStaticMeshComponent* MeshComp = MeshActor ? MeshActor->GetStaticMeshComponent() : nullptr;
+        if (!MeshComp || MeshComp->IsA<UInstancedStaticMeshComponent>())
+        {
+            AddSkipped(Actor, TEXT("not a plain StaticMeshActor"));
+            continue;
+        }
+        if (!MeshComp->GetStaticMesh())
+        {
+            AddSkipped(Actor, TEXT("no static mesh assigned"));
+            continue;
+        }
+
+        TArray<AActor*> AttachedActors;
+        Actor->GetAttachedActors(AttachedActors);
+        if (AttachedActors.Num() > 0)
+        {
+            AddSkipped(Actor, TEXT("has attached actors"));
+            continue;
+        }
+        // A child follows its parent; instancing it would detach it from the hierarchy
+        if (Actor->GetAttachParentActor())
+        {
+            AddSkipped(Actor, TEXT("attached to another actor"));
+            continue;
+        }
+
+        FString GroupKey = Actor->GetLevel()->GetPathName() + TEXT("|") + MeshComp->GetStaticMesh()->GetPathName();
+        TArray<UMaterialInterface*> Materials;
+        for (int32 SlotIndex = 0; SlotIndex < MeshComp->GetNumMaterials(); ++SlotIndex)
+        {
+            UMaterialInterface* Material = MeshComp->GetMaterial(SlotIndex);
+            Materials.Add(Material);
+            GroupKey += TEXT("|") + (Material ? Material->GetPathName() : FString(TEXT("None")));
+        }
+
+        FInstanceGroup& Group = Groups.FindOrAdd(GroupKey);
+        if (!Group.Mesh)
+        {
+            Group.Level = Actor->GetLevel();
+            Group.Mesh = MeshComp->GetStaticMesh();
+            Group.Template = MeshComp;
+            Group.Materials = MoveTemp(Materials);
+        }
+        Group.Actors.Add(Actor);
+        Group.Transforms.Add(MeshComp->GetComponentTransform());
+        Group.ComponentCount += Actor->GetComponents().Num();
+    }
+
+    const int32 LevelActorsBefore = World->GetActorCount();
+    int32 ActorsConsolidated = 0;
+    int32 ComponentsBefore = 0;
+    int32 ComponentsAfter = 0;
+    int32 InstancesCreated = 0;
+    TArray<TSharedPtr<FJsonValue>> GroupArray;
+
+    TUniquePtr<FScopedTransaction> Transaction;
+    if (!bDryRun)
+    {
+        Transaction = MakeUnique<FScopedTransaction>(NSLOCTEXT("SpirrowBridge", "ConsolidateToInstances", "Consolidate Static Mesh Actors To Instances"));
+    }
+
+    for (TPair<FString, FInstanceGroup>& GroupPair : Groups)
+    {
+        FInstanceGroup& Group = GroupPair.Value;
+        if (Group.Actors.Num() < MinInstances)
+        {
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> GroupObj = MakeShared<FJsonObject>();
+        GroupObj->SetStringField(TEXT("mesh"), Group.Mesh->GetPathName());
+        TArray<TSharedPtr<FJsonValue>> MaterialArray;
+        for (UMaterialInterface* Material : Group.Materials)
+        {
+            MaterialArray.Add(MakeShared<FJsonValueString>(Material ? Material->GetPathName() : TEXT("None")));
+        }
+        GroupObj->SetArrayField(TEXT("materials"), MaterialArray);
+        GroupObj->SetNumberField(TEXT("instance_count"), Group.Actors.Num());
+
+        ComponentsBefore += Group.ComponentCount;
+        // Originals that are kept still count after the merge
+        const int32 OriginalComponentsKept = bDeleteOriginals ? 0 : Group.ComponentCount;
+
+        if (bDryRun)
+        {
+            // The instance actor owns exactly one component, the HISM
+            ActorsConsolidated += Group.Actors.Num();
+            ComponentsAfter += 1 + OriginalComponentsKept;
+            GroupArray.Add(MakeShared<FJsonValueObject>(GroupObj));
+            continue;
+        }
+
+        // Pivot at the centre of the instance locations keeps instance-local transforms small
+        FBox LocationBox(ForceInit);
+        for (const FTransform& InstanceTransform : Group.Transforms)
+        {
+            LocationBox += InstanceTransform.GetLocation();
+        }
+        const FTransform PivotTransform(LocationBox.GetCenter());
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.OverrideLevel = Group.Level;
+        SpawnParams.Name = MakeUniqueObjectName(Group.Level, AActor::StaticClass(), FName(*(NamePrefix + Group.Mesh->GetName())));
+
+        AActor* InstanceActor = World->SpawnActor<AActor>(AActor::StaticClass(), PivotTransform, SpawnParams);
+        if (!InstanceActor)
+        {
+            ComponentsAfter += Group.ComponentCount;
+            GroupObj->SetStringField(TEXT("error"), TEXT("Failed to spawn instance actor"));
+            GroupArray.Add(MakeShared<FJsonValueObject>(GroupObj));
+            continue;
+        }
+
+        UHierarchicalInstancedStaticMeshComponent* HISM = NewObject<UHierarchicalInstancedStaticMeshComponent>(
+            InstanceActor, TEXT("InstancedMesh"), RF_Transactional);
+        HISM->SetMobility(Group.Template->Mobility);
+        InstanceActor->SetRootComponent(HISM);
+        InstanceActor->AddInstanceComponent(HISM);
+        HISM->SetWorldTransform(PivotTransform);
+        HISM->SetStaticMesh(Group.Mesh);
+        for (int32 SlotIndex = 0; SlotIndex < Group.Materials.Num(); ++SlotIndex)
+        {
+            HISM->SetMaterial(SlotIndex, Group.Materials[SlotIndex]);
+        }
+        HISM->SetCollisionProfileName(Group.Template->GetCollisionProfileName());
+        HISM->SetCastShadow(Group.Template->CastShadow);
+        HISM->RegisterComponent();
+        HISM->AddInstances(Group.Transforms, false, /*bWorldSpace*/ true);
+
+        InstanceActor->SetActorLabel(SpawnParams.Name.ToString());
+        InstanceActor->SetFolderPath(FName(*(TargetFolder.IsEmpty() ? Group.Actors[0]->GetFolderPath().ToString() : TargetFolder)));
+
+        if (bDeleteOriginals)
+        {
+            for (AActor* SourceActor : Group.Actors)
+            {
+                World->EditorDestroyActor(SourceActor, true);
+            }
+        }
+
+        ActorsConsolidated += Group.Actors.Num();
+        ComponentsAfter += InstanceActor->GetComponents().Num() + OriginalComponentsKept;
+        InstancesCreated += HISM->GetInstanceCount();
+
+        GroupObj->SetStringField(TEXT("actor_name"), InstanceActor->GetName());
+        GroupArray.Add(MakeShared<FJsonValueObject>(GroupObj));
+    }
+
+    Filter.ReleaseRegion(World);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetBoolField(TEXT("dry_run"), bDryRun);
+    if (Filter.bLoadRegion)
+    {
+        ResultObj->SetNumberField(TEXT("region_actors_loaded"), RegionActorsLoaded);
+    }
+    ResultObj->SetNumberField(TEXT("candidates"), Candidates.Num());
+    ResultObj->SetNumberField(TEXT("actors_consolidated"), ActorsConsolidated);
+    ResultObj->SetNumberField(TEXT("instances_created"), InstancesCreated);
+    ResultObj->SetNumberField(TEXT("level_actors_before"), LevelActorsBefore);
+    // A dry run predicts one instance actor per group, minus the originals that would be deleted
+    const int32 LevelActorsAfter = bDryRun
+        ? LevelActorsBefore + GroupArray.Num() - (bDeleteOriginals ? ActorsConsolidated : 0)
+        : World->GetActorCount();
+    ResultObj->SetNumberField(TEXT("level_actors_after"), LevelActorsAfter);
+    ResultObj->SetNumberField(TEXT("components_before"), ComponentsBefore);
+    ResultObj->SetNumberField(TEXT("components_after"), ComponentsAfter);
+    ResultObj->SetArrayField(TEXT("groups"), GroupArray);
+    ResultObj->SetArrayField(TEXT("skipped"), SkippedArray);
+    return ResultObj;
+}
+
+namespace
+{
+    /** Owned copy of one property value, used to tell whether an assignment changed anything */
+    class FPropertyValueCopy
+    {
+    public:
+        FPropertyValueCopy(const FProperty* InProperty, const void* Source)
+            : Property(InProperty)
+            , Data(FMemory::Malloc(InProperty->GetSize(), InProperty->GetMinAlignment()))
+        {
+            Property->InitializeValue(Data);
+            Property->CopyCompleteValue(Data, Source);
+        }
+
+        ~FPropertyValueCopy()
+        {
+            Property->DestroyValue(Data);
+            FMemory::Free(Data);
+        }
+
+        FPropertyValueCopy(const FPropertyValueCopy&) = delete;
+        FPropertyValueCopy& operator=(const FPropertyValueCopy&) = delete;
+
+        const void* GetData() const { return Data; }
+        void CopyTo(void* Dest) const { Property->CopyCompleteValue(Dest, Data); }
+
+    private:
+        const FProperty* Property;
+        void* Data;
+    };
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeLevelCommands::HandleUpdateActorsWhere(const TSharedPtr<FJsonObject>& Params)
+{
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::OperationFailed,
+            TEXT("Failed to get editor world"));
+    }
+
+    FSpirrowBridgeActorFilter Filter;
+    if (auto Error = FSpirrowBridgeActorFilter::Parse(Params, TEXT("filter"), Filter))
+    {
+        return Error;
+    }
+    if (!Filter.HasCriteria() && !Filter.bAll)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("'filter' needs at least one criterion; pass {\"all\": true} to edit every actor in the level"));
+    }
+
+    const TSharedPtr<FJsonObject>* ActorPropsObj = nullptr;
+    Params->TryGetObjectField(TEXT("properties"), ActorPropsObj);
+
+    // Component assignments: { "component": "Name" } or { "component_class": "PointLightComponent" }
+    struct FComponentAssignment
+    {
+        FString ComponentName;
+        UClass* ComponentClass = nullptr;
+        TSharedPtr<FJsonObject> Properties;
+    };
+    TArray<FComponentAssignment> ComponentAssignments;
+
+    const TArray<TSharedPtr<FJsonValue>>* ComponentArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("component_properties"), ComponentArray))
+    {
+        for (const TSharedPtr<FJsonValue>& EntryValue : *ComponentArray)
+        {
+            const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+            if (!EntryValue->TryGetObject(EntryObj) || !(*EntryObj)->HasTypedField<EJson::Object>(TEXT("properties")))
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::InvalidParamValue,
+                    TEXT("Each component_properties entry needs a 'properties' object"));
+            }
+
+            FComponentAssignment Assignment;
+            Assignment.Properties = (*EntryObj)->GetObjectField(TEXT("properties"));
+            (*EntryObj)->TryGetStringField(TEXT("component"), Assignment.ComponentName);
+
+            FString ComponentClassName;
+            if ((*EntryObj)->TryGetStringField(TEXT("component_class"), ComponentClassName))
+            {
+                Assignment.ComponentClass = FindFirstObject<UClass>(*ComponentClassName, EFindFirstObjectOptions::NativeFirst);
+                if (!Assignment.ComponentClass || !Assignment.ComponentClass->IsChildOf(UActorComponent::StaticClass()))
+                {
+                    return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                        ESpirrowErrorCode::ClassNotFound,
+                        FString::Printf(TEXT("Component class not found: %s"), *ComponentClassName));
+                }
+            }
+
+            if (Assignment.ComponentName.IsEmpty() && !Assignment.ComponentClass)
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::InvalidParamValue,
+                    TEXT("Each component_properties entry needs 'component' or 'component_class'"));
+            }
+            ComponentAssignments.Add(MoveTemp(Assignment));
+        }
+    }
+
+    const bool bHasActorProps = ActorPropsObj && (*ActorPropsObj).IsValid() && (*ActorPropsObj)->Values.Num() > 0;
+    if (!bHasActorProps && ComponentAssignments.Num() == 0)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("Provide 'properties' and/or 'component_properties'"));
+    }
+
+    bool bDryRun;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("dry_run"), bDryRun, false);
+
+    // Edited actors must stay loaded until saved; a dry run releases the region again
+    int32 RegionActorsLoaded = 0;
+    if (auto Error = Filter.LoadRegion(World, RegionActorsLoaded, !bDryRun))
+    {
+        return Error;
+    }
+
+    TArray<AActor*> Actors;
+    Filter.Collect(World, Actors);
+
+    TArray<TSharedPtr<FJsonValue>> ResultArray;
+    int32 SucceededCount = 0;
+    int32 FailedCount = 0;
+    int32 AssignmentCount = 0;
+    int32 ChangedCount = 0;
+
+    if (bDryRun)
+    {
+        for (AActor* Actor : Actors)
+        {
+            ResultArray.Add(MakeShared<FJsonValueString>(Actor->GetName()));
+        }
+    }
+    else
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("SpirrowBridge", "UpdateActorsWhere", "Update Actors Where"));
+
+        // Properties missing on a class are reported once per class instead of retried per actor
+        TSet<TPair<UClass*, FString>> MissingProperties;
+        // Objects whose values actually changed: only these are recorded for undo, dirtied and notified
+        TSet<UObject*> ModifiedObjects;
+        auto ApplyProperties = [&MissingProperties, &ModifiedObjects](UObject* Target, const TSharedPtr<FJsonObject>& Properties, TArray<FString>& OutErrors, int32& OutApplied)
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Properties->Values)
+            {
+                const TPair<UClass*, FString> Key(Target->GetClass(), Pair.Key);
+                if (MissingProperties.Contains(Key))
+                {
+                    OutErrors.Add(FString::Printf(TEXT("%s: property not found: %s"), *Target->GetName(), *Pair.Key));
+                    continue;
+                }
+                FString LookupError;
+                const FSpirrowPropertyPath* CachedPath = FSpirrowBridgePropertyPathCache::Get().Find(Target->GetClass(), Pair.Key, LookupError);
+                if (!CachedPath)
+                {
+                    MissingProperties.Add(Key);
+                    OutErrors.Add(FString::Printf(TEXT("%s: property not found: %s"), *Target->GetName(), *Pair.Key));
+                    continue;
+                }
+
+                // Copy: a setter that loads assets can trigger a compile, which clears the cache
+                const FSpirrowPropertyPath Path = *CachedPath;
+                void* ValuePtr = Path.GetValuePtr(Target);
+                const FPropertyValueCopy OldValue(Path.Property, ValuePtr);
+
+                FString ErrorMessage;
+                if (!Path.Setter(Path.Property, ValuePtr, Pair.Value, Pair.Key, ErrorMessage))
+                {
+                    OldValue.CopyTo(ValuePtr);
+                    OutErrors.Add(FString::Printf(TEXT("%s: %s"), *Target->GetName(), *ErrorMessage));
+                    continue;
+                }
+                ++OutApplied;
+
+                if (Path.Property->Identical(OldValue.GetData(), ValuePtr, PPF_None) || ModifiedObjects.Contains(Target))
+                {
+                    continue;
+                }
+                // First change on this object: Modify() must snapshot the old value for undo
+                const FPropertyValueCopy NewValue(Path.Property, ValuePtr);
+                OldValue.CopyTo(ValuePtr);
+                Target->Modify();
+                NewValue.CopyTo(ValuePtr);
+                ModifiedObjects.Add(Target);
+            }
+        };
+
+        for (AActor* Actor : Actors)
+        {
+            TArray<FString> Errors;
+            int32 Applied = 0;
+
+            if (bHasActorProps)
+            {
+                ApplyProperties(Actor, *ActorPropsObj, Errors, Applied);
+            }
+
+            TArray<UActorComponent*> TouchedComponents;
+            if (ComponentAssignments.Num() > 0)
+            {
+                TInlineComponentArray<UActorComponent*> Components(Actor);
+                for (const FComponentAssignment& Assignment : ComponentAssignments)
+                {
+                    bool bAnyComponent = false;
+                    for (UActorComponent* Component : Components)
+                    {
+                        if (!Component ||
+                            (!Assignment.ComponentName.IsEmpty() && Component->GetName() != Assignment.ComponentName) ||
+                            (Assignment.ComponentClass && !Component->IsA(Assignment.ComponentClass)))
+                        {
+                            continue;
+                        }
+
+                        bAnyComponent = true;
+                        TouchedComponents.AddUnique(Component);
+                        ApplyProperties(Component, Assignment.Properties, Errors, Applied);
+                    }
+
+                    if (!bAnyComponent)
+                    {
+                        Errors.Add(FString::Printf(TEXT("No component matching '%s' on %s"),
+                            Assignment.ComponentName.IsEmpty() ? *Assignment.ComponentClass->GetName() : *Assignment.ComponentName,
+                            *Actor->GetName()));
+                    }
+                }
+            }
+
+            // One change notification per changed object after all assignments are in
+            bool bActorChanged = ModifiedObjects.Contains(Actor);
+            for (UActorComponent* Component : TouchedComponents)
+            {
+                if (ModifiedObjects.Contains(Component))
+                {
+                    Component->PostEditChange();
+                    bActorChanged = true;
+                }
+            }
+            if (bActorChanged)
+            {
+                if (!ModifiedObjects.Contains(Actor))
+                {
+                    Actor->Modify();
+                }
+                Actor->PostEditChange();
+                ++ChangedCount;
+            }
+
+            AssignmentCount += Applied;
+            if (Errors.Num() == 0)
+            {
+                ++SucceededCount;
+            }
+            else
+            {
+                ++FailedCount;
+                TSharedPtr<FJsonObject> FailureObj = MakeShared<FJsonObject>();
+                FailureObj->SetStringField(TEXT("actor"), Actor->GetName());
+                FailureObj->SetNumberField(TEXT("applied"), Applied);
+                TArray<TSharedPtr<FJsonValue>> ErrorArray;
+                for (const FString& Error : Errors)
+                {
+                    ErrorArray.Add(MakeShared<FJsonValueString>(Error));
+                }
+                FailureObj->SetArrayField(TEXT("errors"), ErrorArray);
+                ResultArray.Add(MakeShared<FJsonValueObject>(FailureObj));
+            }
+        }
+    }
+
+    Filter.ReleaseRegion(World);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetBoolField(TEXT("dry_run"), bDryRun);
+    if (Filter.bLoadRegion)
+    {
+        ResultObj->SetNumberField(TEXT("region_actors_loaded"), RegionActorsLoaded);
+    }
+    ResultObj->SetNumberField(TEXT("matched"), Actors.Num());
+    ResultObj->SetNumberField(TEXT("succeeded"), SucceededCount);
+    ResultObj->SetNumberField(TEXT("failed"), FailedCount);
+    ResultObj->SetNumberField(TEXT("assignments_applied"), AssignmentCount);
+    ResultObj->SetNumberField(TEXT("actors_changed"), ChangedCount);
+    ResultObj->SetArrayField(bDryRun ? TEXT("actors") : TEXT("failures"), ResultArray);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeLevelCommands::HandleGetPropertiesBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    const TArray<TSharedPtr<FJsonValue>>* PropertyArray = nullptr;
+    if (!Params->TryGetArrayField(TEXT("properties"), PropertyArray) || PropertyArray->Num() == 0)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("Missing required parameter: properties (array of property paths)"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* ObjectArray = nullptr;
+    Params->TryGetArrayField(TEXT("objects"), ObjectArray);
+    const bool bHasFilter = Params->HasTypedField<EJson::Object>(TEXT("filter"));
+    if (!ObjectArray && !bHasFilter)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("Provide 'objects' (object paths) and/or 'filter' (actor filter)"));
+    }
+
+    bool bDiffFromDefaults;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("diff_from_defaults"), bDiffFromDefaults, false);
+
+    TArray<FString> PropertyPaths;
+    for (const TSharedPtr<FJsonValue>& PropertyValue : *PropertyArray)
+    {
+        PropertyPaths.Add(PropertyValue->AsString());
+    }
+
+    // Rows are (label, object); Blueprint assets are read through their class defaults
+    TArray<TPair<FString, UObject*>> Targets;
+    TArray<TSharedPtr<FJsonValue>> ErrorArray;
+
+    if (ObjectArray)
+    {
+        for (const TSharedPtr<FJsonValue>& ObjectValue : *ObjectArray)
+        {
+            const FString ObjectPath = ObjectValue->AsString();
+            const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+            const FString AssetName = ObjectPath.Contains(TEXT("."))
+                ? FPackageName::ObjectPathToObjectName(ObjectPath)
+                : FPackageName::GetShortName(ObjectPath);
+
+            UObject* Object = FSpirrowBridgeAssetResolver::Get().Resolve(AssetName, FPackageName::GetLongPackagePath(PackageName), UObject::StaticClass());
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+            {
+                // A deferred compile would leave the class defaults stale
+                FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(Blueprint);
+                Object = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+            }
+            if (!Object)
+            {
+                ErrorArray.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Object not found: %s"), *ObjectPath)));
+                continue;
+            }
+            Targets.Emplace(ObjectPath, Object);
+        }
+    }
+
+    int32 RegionActorsLoaded = 0;
+    FSpirrowBridgeActorFilter Filter;
+    UWorld* World = nullptr;
+    if (bHasFilter)
+    {
+        World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+        if (!World)
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::OperationFailed,
+                TEXT("Failed to get editor world"));
+        }
+        if (auto Error = FSpirrowBridgeActorFilter::Parse(Params, TEXT("filter"), Filter))
+        {
+            return Error;
+        }
+        // Read-only: the region is released once the values are read
+        if (auto Error = Filter.LoadRegion(World, RegionActorsLoaded, false))
+        {
+            return Error;
+        }
+
+        TArray<AActor*> Actors;
+        Filter.Collect(World, Actors);
+        for (AActor* Actor : Actors)
+        {
+            Targets.Emplace(Actor->GetName(), Actor);
+        }
+    }
+
+    // One row per object: [label, value...]; null marks a missing property or, with diff_from_defaults, a default value
+    FSpirrowBridgePropertyPathCache& PathCache = FSpirrowBridgePropertyPathCache::Get();
+    TSet<TPair<UClass*, FString>> ReportedMissing;
+    TArray<TSharedPtr<FJsonValue>> Rows;
+    int32 ValueCount = 0;
+    for (const TPair<FString, UObject*>& Target : Targets)
+    {
+        UObject* Object = Target.Value;
+        UClass* Class = Object->GetClass();
+        // Instances compare with their class defaults; Blueprint CDOs with the parent class defaults
+        const UObject* Defaults = nullptr;
+        if (bDiffFromDefaults)
+        {
+            Defaults = Object->HasAnyFlags(RF_ClassDefaultObject)
+                ? (Class->GetSuperClass() ? Class->GetSuperClass()->GetDefaultObject() : nullptr)
+                : Class->GetDefaultObject();
+        }
+
+        TArray<TSharedPtr<FJsonValue>> Row;
+        Row.Reserve(PropertyPaths.Num() + 1);
+        Row.Add(MakeShared<FJsonValueString>(Target.Key));
+
+        for (const FString& PropertyPath : PropertyPaths)
+        {
+            FString ErrorMessage;
+            const FSpirrowPropertyPath* Path = PathCache.Find(Class, PropertyPath, ErrorMessage);
+            if (!Path)
+            {
+                if (!ReportedMissing.Contains(TPair<UClass*, FString>(Class, PropertyPath)))
+                {
+                    ReportedMissing.Add(TPair<UClass*, FString>(Class, PropertyPath));
+                    ErrorArray.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s: %s"), *Class->GetName(), *ErrorMessage)));
+                }
+                Row.Add(MakeShared<FJsonValueNull>());
+                continue;
+            }
+
+            // Copied out: the next Find may add an entry and move the one Path points to
+            FProperty* Property = Path->Property;
+            const void* ValuePtr = Path->GetValuePtr(Object);
+
+            // Properties the parent class does not have (variables added by this Blueprint) have no default
+            if (Defaults && Defaults != Object)
+            {
+                const void* DefaultValuePtr = nullptr;
+                if (Defaults->GetClass() == Class)
+                {
+                    DefaultValuePtr = Path->GetValuePtr(const_cast<UObject*>(Defaults));
+                }
+                else
+                {
+                    FString DefaultsError;
+                    const FSpirrowPropertyPath* DefaultsPath = PathCache.Find(Defaults->GetClass(), PropertyPath, DefaultsError);
+                    if (DefaultsPath && DefaultsPath->Property == Property)
+                    {
+                        DefaultValuePtr = DefaultsPath->GetValuePtr(const_cast<UObject*>(Defaults));
+                    }
+                }
+                if (DefaultValuePtr && Property->Identical(ValuePtr, DefaultValuePtr, PPF_None))
+                {
+                    Row.Add(MakeShared<FJsonValueNull>());
+                    continue;
+                }
+            }
+
+            FString ValueText;
+            Property->ExportTextItem_Direct(ValueText, ValuePtr, nullptr, Object, PPF_None);
+            Row.Add(MakeShared<FJsonValueString>(ValueText));
+            ++ValueCount;
+        }
+        Rows.Add(MakeShared<FJsonValueArray>(Row));
+    }
+    if (World)
+    {
+        Filter.ReleaseRegion(World);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Columns;
+    Columns.Add(MakeShared<FJsonValueString>(TEXT("object")));
+    for (const FString& PropertyPath : PropertyPaths)
+    {
+        Columns.Add(MakeShared<FJsonValueString>(PropertyPath));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetArrayField(TEXT("columns"), Columns);
+    ResultObj->SetArrayField(TEXT("rows"), Rows);
+    ResultObj->SetNumberField(TEXT("count"), Rows.Num());
+    ResultObj->SetNumberField(TEXT("values"), ValueCount);
+    ResultObj->SetBoolField(TEXT("diff_from_defaults"), bDiffFromDefaults);
+    if (Filter.bLoadRegion)
+    {
+        ResultObj->SetNumberField(TEXT("region_actors_loaded"), RegionActorsLoaded);
+    }
+    ResultObj->SetArrayField(TEXT("errors"), ErrorArray);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeLevelCommands::HandleExportLevelSnapshot(const TSharedPtr<FJsonObject>& Params)
+{
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::OperationFailed,
+            TEXT("Failed to get editor world"));
+    }
+
+    FString FilePath;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("file_path"), FilePath, TEXT(""));
+    if (FilePath.IsEmpty())
+    {
+        FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("LevelSnapshots"),
+            FString::Printf(TEXT("%s_%s.sbls"), *World->GetMapName(), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"))));
+    }
+    FilePath = FPaths::ConvertRelativePathToFull(FilePath);
+
+    const double CaptureStart = FPlatformTime::Seconds();
+    FSpirrowBridgeLevelSnapshot Snapshot;
+    FSpirrowBridgeLevelSnapshot::Capture(World, Snapshot);
+    const double WriteStart = FPlatformTime::Seconds();
+
+    FString ErrorMessage;
+    if (!Snapshot.SaveToFile(FilePath, ErrorMessage))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(ESpirrowErrorCode::FileWriteFailed, ErrorMessage);
+    }
+    const double WriteEnd = FPlatformTime::Seconds();
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("file_path"), FilePath);
+    ResultObj->SetStringField(TEXT("map"), Snapshot.MapName);
+    ResultObj->SetNumberField(TEXT("actor_count"), Snapshot.Num());
+    ResultObj->SetNumberField(TEXT("string_count"), Snapshot.Strings.Num());
+    ResultObj->SetNumberField(TEXT("file_size"), (double)IFileManager::Get().FileSize(*FilePath));
+    ResultObj->SetNumberField(TEXT("capture_ms"), (WriteStart - CaptureStart) * 1000.0);
+    ResultObj->SetNumberField(TEXT("write_ms"), (WriteEnd - WriteStart) * 1000.0);
+    return ResultObj;
+}
+
+namespace
+{
+    TSharedPtr<FJsonObject> SnapshotActorToJson(const FSpirrowBridgeLevelSnapshot& Snapshot, int32 Row)
+    {
+        TSharedPtr<FJsonObject> ActorObj = MakeShared<FJsonObject>();
+        // Ids do not fit in a JSON double, send them as hex
+        ActorObj->SetStringField(TEXT("id"), FString::Printf(TEXT("%016llx"), Snapshot.Ids[Row]));
+        ActorObj->SetStringField(TEXT("name"), Snapshot.GetString(Snapshot.NameIds[Row]));
+        ActorObj->SetStringField(TEXT("label"), Snapshot.GetString(Snapshot.LabelIds[Row]));
+        ActorObj->SetStringField(TEXT("class"), Snapshot.GetString(Snapshot.ClassIds[Row]));
+        ActorObj->SetStringField(TEXT("level"), Snapshot.GetString(Snapshot.LevelIds[Row]));
+        return ActorObj;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> VectorToJsonArray(const FVector& Vector)
+    {
+        return {
+            MakeShared<FJsonValueNumber>(Vector.X),
+            MakeShared<FJsonValueNumber>(Vector.Y),
+            MakeShared<FJsonValueNumber>(Vector.Z)
+        };
+    }
+
+    FString JoinSnapshotList(const FSpirrowBridgeLevelSnapshot& Snapshot, const TArray<uint32>& Starts, const TArray<uint32>& Ids, int32 Row)
+    {
+        TArray<FString> Values;
+        for (uint32 Index = Starts[Row]; Index < Starts[Row + 1]; ++Index)
+        {
+            Values.Add(Snapshot.GetString(Ids[Index]));
+        }
+        return FString::Join(Values, TEXT(";"));
+    }
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeLevelCommands::HandleDiffLevelSnapshots(const TSharedPtr<FJsonObject>& Params)
+{
+    FString PathA;
+    if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("snapshot_a"), PathA))
+    {
+        return Error;
+    }
+
+    FString PathB;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("snapshot_b"), PathB, TEXT(""));
+
+    double Tolerance;
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("tolerance"), Tolerance, 0.01);
+    double MaxResultsValue;
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("max_results"), MaxResultsValue, 1000.0);
+    const int32 MaxResults = FMath::Max(0, (int32)MaxResultsValue);
+    bool bAllowMapMismatch;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("allow_map_mismatch"), bAllowMapMismatch, false);
+
+    FString ErrorMessage;
+    FSpirrowBridgeLevelSnapshot A;
+    if (!A.LoadFromFile(PathA, ErrorMessage))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(ESpirrowErrorCode::FileReadFailed, ErrorMessage);
+    }
+
+    FSpirrowBridgeLevelSnapshot B;
+    if (PathB.IsEmpty())
+    {
+        // Compare against the live level without writing a second file
+        UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+        if (!World)
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::OperationFailed,
+                TEXT("Failed to get editor world"));
+        }
+        FSpirrowBridgeLevelSnapshot::Capture(World, B);
+    }
+    else if (!B.LoadFromFile(PathB, ErrorMessage))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(ESpirrowErrorCode::FileReadFailed, ErrorMessage);
+    }
+
+    // Actor ids hash the actor path, so snapshots of different maps share almost no ids and
+    // would diff as "everything removed, everything added"
+    if (!bAllowMapMismatch && !A.MapName.Equals(B.MapName, ESearchCase::IgnoreCase))
+    {
+        TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
+        Details->SetStringField(TEXT("map_a"), A.MapName);
+        Details->SetStringField(TEXT("map_b"), B.MapName);
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            FString::Printf(TEXT("Snapshots are of different maps ('%s' vs '%s'); pass allow_map_mismatch to diff anyway"),
+                *A.MapName, *B.MapName),
+            Details);
+    }
+
+    const double DiffStart = FPlatformTime::Seconds();
+
+    TMap<uint64, int32> RowsA;
+    RowsA.Reserve(A.Num());
+    for (int32 Row = 0; Row < A.Num(); ++Row)
+    {
+        RowsA.Add(A.Ids[Row], Row);
+    }
+    TBitArray<> MatchedA(false, A.Num());
+
+    TArray<TSharedPtr<FJsonValue>> Added, Removed, Moved, Changed;
+    int32 AddedCount = 0, RemovedCount = 0, MovedCount = 0, ChangedCount = 0;
+
+    for (int32 RowB = 0; RowB < B.Num(); ++RowB)
+    {
+        const int32* RowAPtr = RowsA.Find(B.Ids[RowB]);
+        if (!RowAPtr)
+        {
+            if (AddedCount++ < MaxResults)
+            {
+                Added.Add(MakeShared<FJsonValueObject>(SnapshotActorToJson(B, RowB)));
+            }
+            continue;
+        }
+        const int32 RowA = *RowAPtr;
+        MatchedA[RowA] = true;
+
+        // Transform
+        const bool bLocationChanged = !A.Locations[RowA].Equals(B.Locations[RowB], Tolerance);
+        const bool bRotationChanged = !A.Rotations[RowA].Equals(B.Rotations[RowB], Tolerance);
+        const bool bScaleChanged = !A.Scales[RowA].Equals(B.Scales[RowB], Tolerance);
+        if (bLocationChanged || bRotationChanged || bScaleChanged)
+        {
+            if (MovedCount++ < MaxResults)
+            {
+                TSharedPtr<FJsonObject> MovedObj = SnapshotActorToJson(B, RowB);
+                if (bLocationChanged)
+                {
+                    MovedObj->SetArrayField(TEXT("location_a"), VectorToJsonArray(A.Locations[RowA]));
+                    MovedObj->SetArrayField(TEXT("location_b"), VectorToJsonArray(B.Locations[RowB]));
+                }
+                if (bRotationChanged)
+                {
+                    MovedObj->SetArrayField(TEXT("rotation_a"), VectorToJsonArray(A.Rotations[RowA].Euler()));
+                    MovedObj->SetArrayField(TEXT("rotation_b"), VectorToJsonArray(B.Rotations[RowB].Euler()));
+                }
+                if (bScaleChanged)
+                {
+                    MovedObj->SetArrayField(TEXT("scale_a"), VectorToJsonArray(A.Scales[RowA]));
+                    MovedObj->SetArrayField(TEXT("scale_b"), VectorToJsonArray(B.Scales[RowB]));
+                }
+                Moved.Add(MakeShared<FJsonValueObject>(MovedObj));
+            }
+        }
+
+        // Properties. String ids are per file, so compare the strings themselves
+        TSharedPtr<FJsonObject> FieldsObj = MakeShared<FJsonObject>();
+        auto CompareField = [&FieldsObj](const TCHAR* Field, const FString& ValueA, const FString& ValueB)
+        {
+            if (!ValueA.Equals(ValueB, ESearchCase::CaseSensitive))
+            {
+                TSharedPtr<FJsonObject> FieldObj = MakeShared<FJsonObject>();
+                FieldObj->SetStringField(TEXT("a"), ValueA);
+                FieldObj->SetStringField(TEXT("b"), ValueB);
+                FieldsObj->SetObjectField(Field, FieldObj);
+            }
+        };
+        CompareField(TEXT("label"), A.GetString(A.LabelIds[RowA]), B.GetString(B.LabelIds[RowB]));
+        CompareField(TEXT("class"), A.GetString(A.ClassIds[RowA]), B.GetString(B.ClassIds[RowB]));
+        CompareField(TEXT("folder"), A.GetString(A.FolderIds[RowA]), B.GetString(B.FolderIds[RowB]));
+        CompareField(TEXT("mesh"), A.GetString(A.MeshIds[RowA]), B.GetString(B.MeshIds[RowB]));
+        CompareField(TEXT("materials"),
+            JoinSnapshotList(A, A.MaterialStarts, A.MaterialIds, RowA),
+            JoinSnapshotList(B, B.MaterialStarts, B.MaterialIds, RowB));
+        CompareField(TEXT("tags"),
+            JoinSnapshotList(A, A.TagStarts, A.TagIds, RowA),
+            JoinSnapshotList(B, B.TagStarts, B.TagIds, RowB));
+
+        // Bounds change without a transform change when the mesh or components change
+        const FVector BoundsMinA(A.BoundsMin[RowA]), BoundsMaxA(A.BoundsMax[RowA]);
+        const FVector BoundsMinB(B.BoundsMin[RowB]), BoundsMaxB(B.BoundsMax[RowB]);
+        if (!BoundsMinA.Equals(BoundsMinB, Tolerance) || !BoundsMaxA.Equals(BoundsMaxB, Tolerance))
+        {
+            TSharedPtr<FJsonObject> BoundsObj = MakeShared<FJsonObject>();
+            BoundsObj->SetArrayField(TEXT("min_a"), VectorToJsonArray(BoundsMinA));
+            BoundsObj->SetArrayField(TEXT("max_a"), VectorToJsonArray(BoundsMaxA));
+            BoundsObj->SetArrayField(TEXT("min_b"), VectorToJsonArray(BoundsMinB));
+            BoundsObj->SetArrayField(TEXT("max_b"), VectorToJsonArray(BoundsMaxB));
+            FieldsObj->SetObjectField(TEXT("bounds"), BoundsObj);
+        }
+
+        if (FieldsObj->Values.Num() > 0)
+        {
+            if (ChangedCount++ < MaxResults)
+            {
+                TSharedPtr<FJsonObject> ChangedObj = SnapshotActorToJson(B, RowB);
+                ChangedObj->SetObjectField(TEXT("fields"), FieldsObj);
+                Changed.Add(MakeShared<FJsonValueObject>(ChangedObj));
+            }
+        }
+    }
+
+    for (int32 RowA = 0; RowA < A.Num(); ++RowA)
+    {
+        if (MatchedA[RowA])
+        {
+            continue;
+        }
+        if (RemovedCount++ < MaxResults)
+        {
+            Removed.Add(MakeShared<FJsonValueObject>(SnapshotActorToJson(A, RowA)));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("map_a"), A.MapName);
+    ResultObj->SetStringField(TEXT("map_b"), B.MapName);
+    ResultObj->SetNumberField(TEXT("actors_a"), A.Num());
+    ResultObj->SetNumberField(TEXT("actors_b"), B.Num());
+    ResultObj->SetNumberField(TEXT("added_count"), AddedCount);
+    ResultObj->SetNumberField(TEXT("removed_count"), RemovedCount);
+    ResultObj->SetNumberField(TEXT("moved_count"), MovedCount);
+    ResultObj->SetNumberField(TEXT("changed_count"), ChangedCount);
+    ResultObj->SetArrayField(TEXT("added"), Added);
+    ResultObj->SetArrayField(TEXT("removed"), Removed);
+    ResultObj->SetArrayField(TEXT("moved"), Moved);
+    ResultObj->SetArrayField(TEXT("changed"), Changed);
+    ResultObj->SetBoolField(TEXT("truncated"),
+        AddedCount > MaxResults || RemovedCount > MaxResults || MovedCount > MaxResults || ChangedCount > MaxResults);
+    ResultObj->SetNumberField(TEXT("diff_ms"), (FPlatformTime::Seconds() - DiffStart) * 1000.0);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeLevelCommands::HandleLoadWorldPartitionRegion(const TSharedPtr<FJsonObject>& Params)
+{
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::OperationFailed,
+            TEXT("Failed to get editor world"));
+    }
+
+    const TSharedPtr<FJsonObject>* BoundsObj = nullptr;
+    if (!Params->TryGetObjectField(TEXT("bounds"), BoundsObj) || !(*BoundsObj)->HasField(TEXT("min")) || !(*BoundsObj)->HasField(TEXT("max")))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("'bounds' requires both 'min' and 'max' as [x, y, z]"));
+    }
+
+    // Reuse the filter so the region semantics match filter.load_region
+    const FVector Min = FSpirrowBridgeCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("min"));
+    const FVector Max = FSpirrowBridgeCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("max"));
+    FSpirrowBridgeActorFilter Filter;
+    Filter.Bounds = FBox(Min.ComponentMin(Max), Min.ComponentMax(Max));
+    Filter.bHasBounds = true;
+    Filter.bLoadRegion = true;
+
+    int32 ActorsLoaded = 0;
+    if (auto Error = Filter.LoadRegion(World, ActorsLoaded))
+    {
+        return Error;
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetNumberField(TEXT("actors_loaded"), ActorsLoaded);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeLevelCommands::HandleUnloadWorldPartitionRegion(const TSharedPtr<FJsonObject>& Params)
+{
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::OperationFailed,
+            TEXT("Failed to get editor world"));
+    }
+    if (!World->GetWorldPartition())
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            TEXT("unload_world_partition_region requires a World Partition map"));
+    }
+
+    FBox Bounds(ForceInit);
+    const TSharedPtr<FJsonObject>* BoundsObj = nullptr;
+    const bool bHasBounds = Params->TryGetObjectField(TEXT("bounds"), BoundsObj);
+    if (bHasBounds)
+    {
+        if (!(*BoundsObj)->HasField(TEXT("min")) || !(*BoundsObj)->HasField(TEXT("max")))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::MissingRequiredParam,
+                TEXT("'bounds' requires both 'min' and 'max' as [x, y, z]"));
+        }
+        const FVector Min = FSpirrowBridgeCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("min"));
+        const FVector Max = FSpirrowBridgeCommonUtils::GetVectorFromJson(*BoundsObj, TEXT("max"));
+        Bounds = FBox(Min.ComponentMin(Max), Min.ComponentMax(Max));
+    }
+
+    int32 SkippedDirty = 0;
+    const int32 Unloaded = FSpirrowBridgeActorFilter::UnloadRegions(World, bHasBounds ? &Bounds : nullptr, SkippedDirty);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetNumberField(TEXT("regions_unloaded"), Unloaded);
+    ResultObj->SetNumberField(TEXT("regions_with_unsaved_changes"), SkippedDirty);
+    return ResultObj;
+}
@@ -0,0 +1,559 @@
+#include "Commands/SpirrowBridgeLevelSnapshot.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+
+static_assert(sizeof(FVector) == 3 * sizeof(double), "Snapshot columns assume double precision FVector");
+static_assert(sizeof(FRotator) == 3 * sizeof(double), "Snapshot columns assume double precision FRotator");
+static_assert(sizeof(FVector3f) == 3 * sizeof(float), "Snapshot columns assume packed FVector3f");
+
+namespace
+{
+    enum ESnapshotColumnType : uint32
+    {
+        ColumnU32 = 1,
+        ColumnU64 = 2,
+        ColumnF32 = 3,
+        ColumnF64 = 4
+    };
+
+    constexpr int64 HeaderSize = 64;
+    constexpr int64 DirectoryEntrySize = 40;
+    constexpr int32 ColumnNameSize = 16;
+
+    // Actors per parallel work item; chunks never span levels
+    constexpr int32 CaptureChunkSize = 512;
+
+    struct FColumnWriteDesc
+    {
+        const ANSICHAR* Name;
+        uint32 Type;
+        uint32 Components;
+        const void* Data;
+        uint64 Count;
+        int64 ByteSize;
+    };
+
+    struct FColumnDirectoryEntry
+    {
+        uint32 Type = 0;
+        uint32 Components = 0;
+        uint64 Count = 0;
+        uint64 Offset = 0;
+    };
+
+    /** Strings gathered off the game thread, interned serially afterwards */
+    struct FActorStrings
+    {
+        FString Name;
+        FString Label;
+        FString Class;
+        FString Folder;
+        FString Mesh;
+        TArray<FString> Materials;
+        TArray<FName> Tags;
+    };
+
+    /** Actor state read on the game thread; the parallel pass only converts it */
+    struct FActorSource
+    {
+        FTransform Transform;
+        FBox Bounds = FBox(ForceInit);
+        FName Folder;
+        const UStaticMesh* Mesh = nullptr;
+        TArray<const UMaterialInterface*> Materials;
+    };
+
+    uint32 ColumnTypeSize(uint32 Type)
+    {
+        return (Type == ColumnU64 || Type == ColumnF64) ? 8 : 4;
+    }
+
+    void AlignTo8(TArray<uint8>& Buffer)
+    {
+        Buffer.AddZeroed((8 - (Buffer.Num() % 8)) % 8);
+    }
+
+    template<typename T>
+    void WriteAt(TArray<uint8>& Buffer, int64 Offset, const T& Value)
+    {
+        FMemory::Memcpy(Buffer.GetData() + Offset, &Value, sizeof(T));
+    }
+
+    template<typename T>
+    bool ReadAt(const TArray<uint8>& Buffer, int64 Offset, T& OutValue)
+    {
+        if (Offset < 0 || Offset + (int64)sizeof(T) > Buffer.Num())
+        {
+            return false;
+        }
+        FMemory::Memcpy(&OutValue, Buffer.GetData() + Offset, sizeof(T));
+        return true;
+    }
+
+    template<typename T>
+    FColumnWriteDesc MakeColumn(const ANSICHAR* Name, uint32 Type, uint32 Components, const TArray<T>& Values)
+    {
+        return { Name, Type, Components, Values.GetData(), (uint64)Values.Num(), (int64)Values.Num() * (int64)sizeof(T) };
+    }
+
+    template<typename T>
+    bool ReadColumn(const TMap<FString, FColumnDirectoryEntry>& Directory, const TArray<uint8>& Buffer,
+                    const TCHAR* Name, uint32 Type, uint32 Components, TArray<T>& OutValues, FString& OutError)
+    {
+        const FColumnDirectoryEntry* Entry = Directory.Find(Name);
+        if (!Entry)
+        {
+            OutError = FString::Printf(TEXT("Snapshot is missing column '%s'"), Name);
+            return false;
+        }
+        if (Entry->Type != Type || Entry->Components != Components || sizeof(T) != ColumnTypeSize(Type) * Components)
+        {
+            OutError = FString::Printf(TEXT("Snapshot column '%s' has an unexpected type"), Name);
+            return false;
+        }
+
+        const int64 ByteSize = (int64)Entry->Count * (int64)sizeof(T);
+        if ((int64)Entry->Offset + ByteSize > Buffer.Num())
+        {
+            OutError = FString::Printf(TEXT("Snapshot column '%s' is truncated"), Name);
+            return false;
+        }
+
+        OutValues.SetNumUninitialized((int32)Entry->Count);
+        FMemory::Memcpy(OutValues.GetData(), Buffer.GetData() + Entry->Offset, ByteSize);
+        return true;
+    }
+}
+
+uint64 FSpirrowBridgeLevelSnapshot::HashActorPath(const FString& ActorPath)
+{
+    // Hash UTF-8 so the id does not depend on the platform TCHAR width
+    FTCHARToUTF8 Utf8Path(*ActorPath);
+    return CityHash64(Utf8Path.Get(), Utf8Path.Length());
+}
+
+void FSpirrowBridgeLevelSnapshot::Capture(UWorld* World, FSpirrowBridgeLevelSnapshot& OutSnapshot)
+{
+    OutSnapshot = FSpirrowBridgeLevelSnapshot();
+    OutSnapshot.Strings.Add(FString());
+    OutSnapshot.CaptureTime = FDateTime::UtcNow().ToUnixTimestamp();
+    if (!World)
+    {
+        OutSnapshot.MaterialStarts.Add(0);
+        OutSnapshot.TagStarts.Add(0);
+        return;
+    }
+    OutSnapshot.MapName = World->GetOutermost()->GetName();
+
+    // Collect actors per level on the game thread and cut them into chunks
+    struct FCaptureChunk
+    {
+        int32 Start;
+        int32 End;
+        FString LevelName;
+    };
+    TArray<AActor*> Actors;
+    TArray<FCaptureChunk> Chunks;
+    for (ULevel* Level : World->GetLevels())
+    {
+        if (!Level)
+        {
+            continue;
+        }
+
+        const int32 LevelStart = Actors.Num();
+        for (AActor* Actor : Level->Actors)
+        {
+            if (IsValid(Actor))
+            {
+                Actors.Add(Actor);
+            }
+        }
+
+        const FString LevelName = Level->GetOutermost()->GetName();
+        for (int32 Start = LevelStart; Start < Actors.Num(); Start += CaptureChunkSize)
+        {
+            Chunks.Add({ Start, FMath::Min(Start + CaptureChunkSize, Actors.Num()), LevelName });
+        }
+    }
+
+    const int32 ActorCount = Actors.Num();
+    OutSnapshot.Ids.SetNumUninitialized(ActorCount);
+    OutSnapshot.LevelIds.SetNumUninitialized(ActorCount);
+    OutSnapshot.Locations.SetNumUninitialized(ActorCount);
+    OutSnapshot.Rotations.SetNumUninitialized(ActorCount);
+    OutSnapshot.Scales.SetNumUninitialized(ActorCount);
+    OutSnapshot.BoundsMin.SetNumUninitialized(ActorCount);
+    OutSnapshot.BoundsMax.SetNumUninitialized(ActorCount);
+
+    TArray<FActorStrings> RowStrings;
+    RowStrings.SetNum(ActorCount);
+    TArray<FActorSource> Sources;
+    Sources.SetNum(ActorCount);
+
+    // Component lookups, bounds (walks the scene components), label and folder are game-thread APIs
+    for (int32 Row = 0; Row < ActorCount; ++Row)
+    {
+        const AActor* Actor = Actors[Row];
+        FActorSource& Source = Sources[Row];
+        Source.Transform = Actor->GetActorTransform();
+        Source.Bounds = Actor->GetComponentsBoundingBox(true);
+        Source.Folder = Actor->GetFolderPath();
+        RowStrings[Row].Label = Actor->GetActorLabel(false);
+        RowStrings[Row].Tags = Actor->Tags;
+
+        if (const UStaticMeshComponent* MeshComponent = Actor->FindComponentByClass<UStaticMeshComponent>())
+        {
+            Source.Mesh = MeshComponent->GetStaticMesh();
+            const int32 NumMaterials = MeshComponent->GetNumMaterials();
+            Source.Materials.Reserve(NumMaterials);
+            for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
+            {
+                Source.Materials.Add(MeshComponent->GetMaterial(MaterialIndex));
+            }
+        }
+    }
+
+    // Pure conversion: path names, hashes and transform decomposition. Every task writes disjoint
+    // rows, and the game thread is blocked inside ParallelFor so no object can be garbage collected.
+    ParallelFor(Chunks.Num(), [&](int32 ChunkIndex)
+    {
+        const FCaptureChunk& Chunk = Chunks[ChunkIndex];
+        for (int32 Row = Chunk.Start; Row < Chunk.End; ++Row)
+        {
+            const AActor* Actor = Actors[Row];
+            const FActorSource& Source = Sources[Row];
+            FActorStrings& Strings = RowStrings[Row];
+
+            OutSnapshot.Ids[Row] = HashActorPath(Actor->GetPathName());
+
+            const FVector Location = Source.Transform.GetLocation();
+            OutSnapshot.Locations[Row] = Location;
+            OutSnapshot.Rotations[Row] = Source.Transform.Rotator();
+            OutSnapshot.Scales[Row] = Source.Transform.GetScale3D();
+            OutSnapshot.BoundsMin[Row] = FVector3f(Source.Bounds.IsValid ? Source.Bounds.Min : Location);
+            OutSnapshot.BoundsMax[Row] = FVector3f(Source.Bounds.IsValid ? Source.Bounds.Max : Location);
+
+            Strings.Name = Actor->GetName();
+            Strings.Class = Actor->GetClass()->GetPathName();
+            Strings.Folder = Source.Folder.ToString();
+            if (Source.Mesh)
+            {
+                Strings.Mesh = Source.Mesh->GetPathName();
+            }
+            Strings.Materials.Reserve(Source.Materials.Num());
+            for (const UMaterialInterface* Material : Source.Materials)
+            {
+                Strings.Materials.Add(Material ? Material->GetPathName() : FString());
+            }
+        }
+    });
+
+    // Intern strings serially
+    TMap<FString, uint32> StringIndex;
+    auto Intern = [&OutSnapshot, &StringIndex](const FString& Value) -> uint32
+    {
+        if (Value.IsEmpty())
+        {
+            return 0;
+        }
+        if (const uint32* Found = StringIndex.Find(Value))
+        {
+            return *Found;
+        }
+        const uint32 Index = OutSnapshot.Strings.Add(Value);
+        StringIndex.Add(Value, Index);
+        return Index;
+    };
+
+    for (const FCaptureChunk& Chunk : Chunks)
+    {
+        const uint32 LevelId = Intern(Chunk.LevelName);
+        for (int32 Row = Chunk.Start; Row < Chunk.End; ++Row)
+        {
+            OutSnapshot.LevelIds[Row] = LevelId;
+        }
+    }
+
+    OutSnapshot.NameIds.Reserve(ActorCount);
+    OutSnapshot.LabelIds.Reserve(ActorCount);
+    OutSnapshot.ClassIds.Reserve(ActorCount);
+    OutSnapshot.FolderIds.Reserve(ActorCount);
+    OutSnapshot.MeshIds.Reserve(ActorCount);
+    OutSnapshot.MaterialStarts.Reserve(ActorCount + 1);
+    OutSnapshot.TagStarts.Reserve(ActorCount + 1);
+
+    for (const FActorStrings& Strings : RowStrings)
+    {
+        OutSnapshot.NameIds.Add(Intern(Strings.Name));
+        OutSnapshot.LabelIds.Add(Intern(Strings.Label));
+        OutSnapshot.ClassIds.Add(Intern(Strings.Class));
+        OutSnapshot.FolderIds.Add(Intern(Strings.Folder));
+        OutSnapshot.MeshIds.Add(Intern(Strings.Mesh));
+
+        OutSnapshot.MaterialStarts.Add(OutSnapshot.MaterialIds.Num());
+        for (const FString& Material : Strings.Materials)
+        {
+            OutSnapshot.MaterialIds.Add(Intern(Material));
+        }
+
+        OutSnapshot.TagStarts.Add(OutSnapshot.TagIds.Num());
+        for (const FName& Tag : Strings.Tags)
+        {
+            OutSnapshot.TagIds.Add(Intern(Tag.ToString()));
+        }
+    }
+    OutSnapshot.MaterialStarts.Add(OutSnapshot.MaterialIds.Num());
+    OutSnapshot.TagStarts.Add(OutSnapshot.TagIds.Num());
+
+    Intern(OutSnapshot.MapName);
+}
+
+bool FSpirrowBridgeLevelSnapshot::SaveToFile(const FString& FilePath, FString& OutError) const
+{
+    const TArray<FColumnWriteDesc> Columns = {
+        MakeColumn("id", ColumnU64, 1, Ids),
+        MakeColumn("name", ColumnU32, 1, NameIds),
+        MakeColumn("label", ColumnU32, 1, LabelIds),
+        MakeColumn("class", ColumnU32, 1, ClassIds),
+        MakeColumn("level", ColumnU32, 1, LevelIds),
+        MakeColumn("folder", ColumnU32, 1, FolderIds),
+        MakeColumn("mesh", ColumnU32, 1, MeshIds),
+        MakeColumn("location", ColumnF64, 3, Locations),
+        MakeColumn("rotation", ColumnF64, 3, Rotations),
+        MakeColumn("scale", ColumnF64, 3, Scales),
+        MakeColumn("bounds_min", ColumnF32, 3, BoundsMin),
+        MakeColumn("bounds_max", ColumnF32, 3, BoundsMax),
+        MakeColumn("material_start", ColumnU32, 1, MaterialStarts),
+        MakeColumn("material_ids", ColumnU32, 1, MaterialIds),
+        MakeColumn("tag_start", ColumnU32, 1, TagStarts),
+        MakeColumn("tag_ids", ColumnU32, 1, TagIds)
+    };
+
+    TArray<uint8> Buffer;
+    Buffer.AddZeroed(HeaderSize + Columns.Num() * DirectoryEntrySize);
+
+    for (int32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ++ColumnIndex)
+    {
+        const FColumnWriteDesc& Column = Columns[ColumnIndex];
+
+        AlignTo8(Buffer);
+        const uint64 ColumnOffset = Buffer.Num();
+        Buffer.Append(static_cast<const uint8*>(Column.Data), Column.ByteSize);
+
+        const int64 EntryOffset = HeaderSize + ColumnIndex * DirectoryEntrySize;
+        FMemory::Memcpy(Buffer.GetData() + EntryOffset, Column.Name, FMath::Min<int32>(FCStringAnsi::Strlen(Column.Name), ColumnNameSize - 1));
+        WriteAt(Buffer, EntryOffset + 16, Column.Type);
+        WriteAt(Buffer, EntryOffset + 20, Column.Components);
+        WriteAt(Buffer, EntryOffset + 24, Column.Count);
+        WriteAt(Buffer, EntryOffset + 32, ColumnOffset);
+    }
+
+    // String table: offsets followed by one UTF-8 blob
+    TArray<uint32> StringOffsets;
+    TArray<uint8> StringData;
+    StringOffsets.Reserve(Strings.Num() + 1);
+    for (const FString& Value : Strings)
+    {
+        StringOffsets.Add(StringData.Num());
+        FTCHARToUTF8 Utf8Value(*Value);
+        StringData.Append(reinterpret_cast<const uint8*>(Utf8Value.Get()), Utf8Value.Length());
+    }
+    StringOffsets.Add(StringData.Num());
+
+    AlignTo8(Buffer);
+    const uint64 StringOffsetsOffset = Buffer.Num();
+    Buffer.Append(reinterpret_cast<const uint8*>(StringOffsets.GetData()), StringOffsets.Num() * sizeof(uint32));
+
+    AlignTo8(Buffer);
+    const uint64 StringDataOffset = Buffer.Num();
+    Buffer.Append(StringData);
+
+    const int32 MapNameIndex = Strings.IndexOfByKey(MapName);
+
+    WriteAt(Buffer, 0, FileMagic);
+    WriteAt(Buffer, 4, FileVersion);
+    WriteAt(Buffer, 8, (uint32)Num());
+    WriteAt(Buffer, 12, (uint32)Columns.Num());
+    WriteAt(Buffer, 16, (uint32)Strings.Num());
+    WriteAt(Buffer, 20, (uint32)FMath::Max(MapNameIndex, 0));
+    WriteAt(Buffer, 24, StringOffsetsOffset);
+    WriteAt(Buffer, 32, StringDataOffset);
+    WriteAt(Buffer, 40, (uint64)StringData.Num());
+    WriteAt(Buffer, 48, (uint64)HeaderSize);
+    WriteAt(Buffer, 56, CaptureTime);
+
+    if (!FFileHelper::SaveArrayToFile(Buffer, *FilePath))
+    {
+        OutError = FString::Printf(TEXT("Failed to write snapshot: %s"), *FilePath);
+        return false;
+    }
+    return true;
+}
+
+bool FSpirrowBridgeLevelSnapshot::LoadFromFile(const FString& FilePath, FString& OutError)
+{
+    *this = FSpirrowBridgeLevelSnapshot();
+
+    TArray<uint8> Buffer;
+    if (!FFileHelper::LoadFileToArray(Buffer, *FilePath))
+    {
+        OutError = FString::Printf(TEXT("Failed to read snapshot: %s"), *FilePath);
+        return false;
+    }
+
+    uint32 Magic = 0, Version = 0, ActorCount = 0, ColumnCount = 0, StringCount = 0, MapNameIndex = 0;
+    uint64 StringOffsetsOffset = 0, StringDataOffset = 0, StringDataSize = 0, DirectoryOffset = 0;
+    if (!ReadAt(Buffer, 0, Magic) || Magic != FileMagic)
+    {
+        OutError = FString::Printf(TEXT("Not a level snapshot file: %s"), *FilePath);
+        return false;
+    }
+    ReadAt(Buffer, 4, Version);
+    if (Version != FileVersion)
+    {
+        OutError = FString::Printf(TEXT("Unsupported snapshot version %u (expected %u)"), Version, FileVersion);
+        return false;
+    }
+    ReadAt(Buffer, 8, ActorCount);
+    ReadAt(Buffer, 12, ColumnCount);
+    ReadAt(Buffer, 16, StringCount);
+    ReadAt(Buffer, 20, MapNameIndex);
+    ReadAt(Buffer, 24, StringOffsetsOffset);
+    ReadAt(Buffer, 32, StringDataOffset);
+    ReadAt(Buffer, 40, StringDataSize);
+    ReadAt(Buffer, 48, DirectoryOffset);
+    ReadAt(Buffer, 56, CaptureTime);
+
+    if ((int64)DirectoryOffset + (int64)ColumnCount * DirectoryEntrySize > Buffer.Num() ||
+        (int64)StringOffsetsOffset + ((int64)StringCount + 1) * (int64)sizeof(uint32) > Buffer.Num() ||
+        (int64)StringDataOffset + (int64)StringDataSize > Buffer.Num())
+    {
+        OutError = FString::Printf(TEXT("Snapshot file is truncated: %s"), *FilePath);
+        return false;
+    }
+
+    TMap<FString, FColumnDirectoryEntry> Directory;
+    for (uint32 ColumnIndex = 0; ColumnIndex < ColumnCount; ++ColumnIndex)
+    {
+        const int64 EntryOffset = DirectoryOffset + ColumnIndex * DirectoryEntrySize;
+        ANSICHAR Name[ColumnNameSize + 1] = {};
+        FMemory::Memcpy(Name, Buffer.GetData() + EntryOffset, ColumnNameSize);
+
+        FColumnDirectoryEntry Entry;
+        ReadAt(Buffer, EntryOffset + 16, Entry.Type);
+        ReadAt(Buffer, EntryOffset + 20, Entry.Components);
+        ReadAt(Buffer, EntryOffset + 24, Entry.Count);
+        ReadAt(Buffer, EntryOffset + 32, Entry.Offset);
+        Directory.Add(FString(ANSI_TO_TCHAR(Name)), Entry);
+    }
+
+    const bool bColumnsRead =
+        ReadColumn(Directory, Buffer, TEXT("id"), ColumnU64, 1, Ids, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("name"), ColumnU32, 1, NameIds, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("label"), ColumnU32, 1, LabelIds, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("class"), ColumnU32, 1, ClassIds, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("level"), ColumnU32, 1, LevelIds, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("folder"), ColumnU32, 1, FolderIds, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("mesh"), ColumnU32, 1, MeshIds, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("location"), ColumnF64, 3, Locations, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("rotation"), ColumnF64, 3, Rotations, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("scale"), ColumnF64, 3, Scales, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("bounds_min"), ColumnF32, 3, BoundsMin, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("bounds_max"), ColumnF32, 3, BoundsMax, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("material_start"), ColumnU32, 1, MaterialStarts, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("material_ids"), ColumnU32, 1, MaterialIds, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("tag_start"), ColumnU32, 1, TagStarts, OutError) &&
+        ReadColumn(Directory, Buffer, TEXT("tag_ids"), ColumnU32, 1, TagIds, OutError);
+    if (!bColumnsRead)
+    {
+        return false;
+    }
+
+    // Everything below indexes the columns by row without further checks
+    const int32 NumActors = (int32)ActorCount;
+    const bool bRowColumnsMatch =
+        Ids.Num() == NumActors && NameIds.Num() == NumActors && LabelIds.Num() == NumActors &&
+        ClassIds.Num() == NumActors && LevelIds.Num() == NumActors && FolderIds.Num() == NumActors &&
+        MeshIds.Num() == NumActors && Locations.Num() == NumActors && Rotations.Num() == NumActors &&
+        Scales.Num() == NumActors && BoundsMin.Num() == NumActors && BoundsMax.Num() == NumActors &&
+        MaterialStarts.Num() == NumActors + 1 && TagStarts.Num() == NumActors + 1;
+    if (ActorCount > (uint32)MAX_int32 - 1 || !bRowColumnsMatch)
+    {
+        OutError = TEXT("Snapshot column lengths do not match the actor count");
+        return false;
+    }
+
+    // CSR offsets start at 0, never decrease and end at the size of their id column
+    auto StartsAreValid = [](const TArray<uint32>& Starts, int32 PoolSize)
+    {
+        if (Starts[0] != 0 || Starts.Last() != (uint32)PoolSize)
+        {
+            return false;
+        }
+        for (int32 Index = 1; Index < Starts.Num(); ++Index)
+        {
+            if (Starts[Index] < Starts[Index - 1])
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (!StartsAreValid(MaterialStarts, MaterialIds.Num()) || !StartsAreValid(TagStarts, TagIds.Num()))
+    {
+        OutError = TEXT("Snapshot material or tag offsets are corrupt");
+        return false;
+    }
+
+    const uint32* StringOffsets = reinterpret_cast<const uint32*>(Buffer.GetData() + StringOffsetsOffset);
+    const ANSICHAR* StringData = reinterpret_cast<const ANSICHAR*>(Buffer.GetData() + StringDataOffset);
+    Strings.Reserve(StringCount);
+    for (uint32 StringIndex = 0; StringIndex < StringCount; ++StringIndex)
+    {
+        uint32 Begin = 0, End = 0;
+        FMemory::Memcpy(&Begin, StringOffsets + StringIndex, sizeof(uint32));
+        FMemory::Memcpy(&End, StringOffsets + StringIndex + 1, sizeof(uint32));
+        if (Begin > End || End > StringDataSize)
+        {
+            OutError = TEXT("Snapshot string table is corrupt");
+            return false;
+        }
+        FUTF8ToTCHAR Converted(StringData + Begin, End - Begin);
+        Strings.Add(FString(Converted.Length(), Converted.Get()));
+    }
+    if (Strings.Num() == 0)
+    {
+        Strings.Add(FString());
+    }
+
+    // Every string id must point into the string table
+    auto IdsAreValid = [this](const TArray<uint32>& StringIds)
+    {
+        for (const uint32 StringId : StringIds)
+        {
+            if (StringId >= (uint32)Strings.Num())
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (!IdsAreValid(NameIds) || !IdsAreValid(LabelIds) || !IdsAreValid(ClassIds) || !IdsAreValid(LevelIds) ||
+        !IdsAreValid(FolderIds) || !IdsAreValid(MeshIds) || !IdsAreValid(MaterialIds) || !IdsAreValid(TagIds) ||
+        MapNameIndex >= (uint32)Strings.Num())
+    {
+        OutError = TEXT("Snapshot string ids are out of range");
+        return false;
+    }
+
+    MapName = GetString(MapNameIndex);
+    return true;
+}
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeMaterialCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialExpressionConstant3Vector.h"
 #include "Materials/MaterialExpressionConstant.h"
@@ -193,10 +194,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeMaterialCommands::HandleCreateSimpleMateri
     FAssetRegistryModule::AssetCreated(Material);
 
     // Save the package
-    FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, Material, *PackageFileName, SaveArgs);
+    FSpirrowBridgeSaveManager::Get().RequestSave(Material);
 
     // Create success response
     TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
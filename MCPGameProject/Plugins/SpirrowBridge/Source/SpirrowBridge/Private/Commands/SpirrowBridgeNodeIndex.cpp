@@ -0,0 +1,189 @@
+#include "Commands/SpirrowBridgeNodeIndex.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "UObject/UObjectGlobals.h"
+
+FSpirrowBridgeNodeIndex& FSpirrowBridgeNodeIndex::Get()
+{
+    static FSpirrowBridgeNodeIndex Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeNodeIndex::Startup()
+{
+    if (PostGarbageCollectHandle.IsValid())
+    {
+        return;
+    }
+
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FSpirrowBridgeNodeIndex::OnPostGarbageCollect);
+}
+
+void FSpirrowBridgeNodeIndex::Shutdown()
+{
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+    PostGarbageCollectHandle.Reset();
+    Clear();
+}
+
+UEdGraphNode* FSpirrowBridgeNodeIndex::FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid)
+{
+    if (!Blueprint || !NodeGuid.IsValid())
+    {
+        return nullptr;
+    }
+
+    FBlueprintEntry* Entry = Entries.Find(TObjectKey<UBlueprint>(Blueprint));
+    bool bRebuilt = false;
+    if (!Entry)
+    {
+        Entry = &Build(Blueprint);
+        bRebuilt = true;
+    }
+
+    for (;;)
+    {
+        if (const TWeakObjectPtr<UEdGraphNode>* Found = Entry->Nodes.Find(NodeGuid))
+        {
+            UEdGraphNode* Node = Found->Get();
+            if (IsValid(Node) && Node->NodeGuid == NodeGuid)
+            {
+                return Node;
+            }
+        }
+        if (bRebuilt)
+        {
+            return nullptr;
+        }
+
+        // Missed or stale: the graph may have changed without a notification
+        Entry = &Build(Blueprint);
+        bRebuilt = true;
+    }
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeNodeIndex::ResolveNode(UBlueprint* Blueprint, const FString& NodeId, UEdGraphNode*& OutNode,
+    const FString& Label)
+{
+    OutNode = nullptr;
+
+    FGuid NodeGuid;
+    if (!FGuid::Parse(NodeId, NodeGuid))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            FString::Printf(TEXT("Invalid node id (expected a GUID): %s"), *NodeId));
+    }
+
+    OutNode = FindNode(Blueprint, NodeGuid);
+    if (!OutNode)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::NodeNotFound,
+            FString::Printf(TEXT("%s not found: %s"), *Label, *NodeId));
+    }
+    return nullptr;
+}
+
+void FSpirrowBridgeNodeIndex::Invalidate(UBlueprint* Blueprint)
+{
+    if (Blueprint)
+    {
+        Remove(TObjectKey<UBlueprint>(Blueprint));
+    }
+}
+
+void FSpirrowBridgeNodeIndex::Clear()
+{
+    for (TPair<TObjectKey<UBlueprint>, FBlueprintEntry>& Pair : Entries)
+    {
+        Unsubscribe(Pair.Value);
+    }
+    Entries.Reset();
+}
+
+FSpirrowBridgeNodeIndex::FBlueprintEntry& FSpirrowBridgeNodeIndex::Build(UBlueprint* Blueprint)
+{
+    const TObjectKey<UBlueprint> Key(Blueprint);
+    FBlueprintEntry& Entry = Entries.FindOrAdd(Key);
+    Unsubscribe(Entry);
+    Entry.Blueprint = Blueprint;
+    Entry.Nodes.Reset();
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node)
+            {
+                Entry.Nodes.Add(Node->NodeGuid, Node);
+            }
+        }
+        Entry.GraphHandles.Emplace(Graph, Graph->AddOnGraphChangedHandler(
+            FOnGraphChanged::FDelegate::CreateRaw(this, &FSpirrowBridgeNodeIndex::OnGraphChanged, Key)));
+    }
+    Entry.BlueprintChangedHandle = Blueprint->OnChanged().AddRaw(this, &FSpirrowBridgeNodeIndex::OnBlueprintChanged);
+    return Entry;
+}
+
+void FSpirrowBridgeNodeIndex::Unsubscribe(FBlueprintEntry& Entry)
+{
+    for (const TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>& GraphHandle : Entry.GraphHandles)
+    {
+        if (UEdGraph* Graph = GraphHandle.Key.Get())
+        {
+            Graph->RemoveOnGraphChangedHandler(GraphHandle.Value);
+        }
+    }
+    Entry.GraphHandles.Reset();
+
+    if (UBlueprint* Blueprint = Entry.Blueprint.Get())
+    {
+        Blueprint->OnChanged().Remove(Entry.BlueprintChangedHandle);
+    }
+    Entry.BlueprintChangedHandle.Reset();
+}
+
+void FSpirrowBridgeNodeIndex::Remove(TObjectKey<UBlueprint> Key)
+{
+    if (FBlueprintEntry* Entry = Entries.Find(Key))
+    {
+        Unsubscribe(*Entry);
+        Entries.Remove(Key);
+    }
+}
+
+void FSpirrowBridgeNodeIndex::OnGraphChanged(const FEdGraphEditAction& Action, TObjectKey<UBlueprint> Key)
+{
+    // Selection changes leave the node set alone
+    if (Action.Action == GRAPHACTION_SelectNode)
+    {
+        return;
+    }
+    Remove(Key);
+}
+
+void FSpirrowBridgeNodeIndex::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+    Invalidate(Blueprint);
+}
+
+void FSpirrowBridgeNodeIndex::OnPostGarbageCollect()
+{
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (!It->Value.Blueprint.IsValid())
+        {
+            Unsubscribe(It->Value);
+            It.RemoveCurrent();
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeProjectCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 #include "GameFramework/InputSettings.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
@@ -199,10 +200,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleCreateInputAction(c
     FAssetRegistryModule::AssetCreated(NewAction);
     NewAction->MarkPackageDirty();
 
-    FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, NewAction, *PackageFileName, SaveArgs);
+    FSpirrowBridgeSaveManager::Get().RequestSave(NewAction);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetBoolField(TEXT("success"), true);
@@ -250,10 +248,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleCreateInputMappingC
     FAssetRegistryModule::AssetCreated(NewContext);
     NewContext->MarkPackageDirty();
 
-    FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Package, NewContext, *PackageFileName, SaveArgs);
+    FSpirrowBridgeSaveManager::Get().RequestSave(NewContext);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetBoolField(TEXT("success"), true);
@@ -421,11 +416,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleAddActionToMappingC
     }
 
     Context->MarkPackageDirty();
-    FString PackagePath = FString::Printf(TEXT("%s/%s"), *ContextPath, *ContextName);
-    FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Context->GetOutermost(), Context, *PackageFileName, SaveArgs);
+    FSpirrowBridgeSaveManager::Get().RequestSave(Context);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetBoolField(TEXT("success"), true);
@@ -966,11 +957,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleRemoveActionFromMap
 
     // 保存
     Context->MarkPackageDirty();
-    FString PackagePath = FString::Printf(TEXT("%s/%s"), *ContextPath, *ContextName);
-    FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-    FSavePackageArgs SaveArgs;
-    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-    UPackage::SavePackage(Context->GetOutermost(), Context, *PackageFileName, SaveArgs);
+    FSpirrowBridgeSaveManager::Get().RequestSave(Context);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetBoolField(TEXT("success"), true);
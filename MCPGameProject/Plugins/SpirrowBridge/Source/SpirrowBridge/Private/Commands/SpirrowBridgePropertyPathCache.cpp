@@ -0,0 +1,145 @@
+#include "Commands/SpirrowBridgePropertyPathCache.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Editor.h"
+#include "UObject/UObjectGlobals.h"
+
+FSpirrowBridgePropertyPathCache& FSpirrowBridgePropertyPathCache::Get()
+{
+    static FSpirrowBridgePropertyPathCache Instance;
+    return Instance;
+}
+
+void FSpirrowBridgePropertyPathCache::Startup()
+{
+    if (ReloadCompleteHandle.IsValid())
+    {
+        return;
+    }
+
+    if (GEditor)
+    {
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FSpirrowBridgePropertyPathCache::Clear);
+    }
+    ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddRaw(this, &FSpirrowBridgePropertyPathCache::OnObjectsReinstanced);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FSpirrowBridgePropertyPathCache::OnReloadComplete);
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FSpirrowBridgePropertyPathCache::OnPostGarbageCollect);
+}
+
+void FSpirrowBridgePropertyPathCache::Shutdown()
+{
+    if (GEditor)
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+    FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+    BlueprintCompiledHandle.Reset();
+    ObjectsReinstancedHandle.Reset();
+    ReloadCompleteHandle.Reset();
+    PostGarbageCollectHandle.Reset();
+    Clear();
+}
+
+const FSpirrowPropertyPath* FSpirrowBridgePropertyPathCache::Find(const UStruct* Struct, const FString& PropertyPath, FString& OutErrorMessage)
+{
+    if (!Struct)
+    {
+        OutErrorMessage = TEXT("Invalid class or struct");
+        return nullptr;
+    }
+
+    const FKey Key{Struct, PropertyPath};
+    FEntry* Entry = Entries.Find(Key);
+    if (!Entry)
+    {
+        Entry = &Entries.Add(Key);
+        Compile(Struct, PropertyPath, *Entry);
+    }
+
+    if (!Entry->ErrorMessage.IsEmpty())
+    {
+        OutErrorMessage = Entry->ErrorMessage;
+        return nullptr;
+    }
+    return &Entry->Path;
+}
+
+void FSpirrowBridgePropertyPathCache::Clear()
+{
+    Entries.Reset();
+}
+
+bool FSpirrowBridgePropertyPathCache::Compile(const UStruct* Struct, const FString& PropertyPath, FEntry& OutEntry)
+{
+    TArray<FString> Segments;
+    PropertyPath.ParseIntoArray(Segments, TEXT("."));
+    if (Segments.Num() == 0)
+    {
+        OutEntry.ErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyPath);
+        return false;
+    }
+
+    const UStruct* Current = Struct;
+    OutEntry.Structs.Add(Current);
+    FProperty* Property = nullptr;
+    int32 Offset = 0;
+    for (int32 Index = 0; Index < Segments.Num(); ++Index)
+    {
+        Property = Current->FindPropertyByName(FName(*Segments[Index]));
+        if (!Property)
+        {
+            OutEntry.ErrorMessage = Segments.Num() == 1
+                ? FString::Printf(TEXT("Property not found: %s"), *PropertyPath)
+                : FString::Printf(TEXT("Property not found: %s ('%s' is not a member of %s)"),
+                    *PropertyPath, *Segments[Index], *Current->GetName());
+            return false;
+        }
+        Offset += Property->GetOffset_ForInternal();
+
+        if (Index < Segments.Num() - 1)
+        {
+            FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+            if (!StructProperty)
+            {
+                OutEntry.ErrorMessage = FString::Printf(TEXT("Cannot resolve %s: '%s' is a %s, not a struct"),
+                    *PropertyPath, *Segments[Index], *Property->GetClass()->GetName());
+                return false;
+            }
+            Current = StructProperty->Struct;
+            OutEntry.Structs.Add(Current);
+        }
+    }
+
+    OutEntry.Path.Property = Property;
+    OutEntry.Path.Offset = Offset;
+    OutEntry.Path.Setter = FSpirrowBridgeCommonUtils::GetPropertySetter(Property);
+    return true;
+}
+
+void FSpirrowBridgePropertyPathCache::OnObjectsReinstanced(const TMap<UObject*, UObject*>& OldToNewInstanceMap)
+{
+    Clear();
+}
+
+void FSpirrowBridgePropertyPathCache::OnReloadComplete(EReloadCompleteReason Reason)
+{
+    Clear();
+}
+
+void FSpirrowBridgePropertyPathCache::OnPostGarbageCollect()
+{
+    // Keys are raw pointers: a collected class's address can be reused by the next allocation
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        for (const TWeakObjectPtr<const UStruct>& StructPtr : It.Value().Structs)
+        {
+            if (!StructPtr.IsValid())
+            {
+                It.RemoveCurrent();
+                break;
+            }
+        }
+    }
+}
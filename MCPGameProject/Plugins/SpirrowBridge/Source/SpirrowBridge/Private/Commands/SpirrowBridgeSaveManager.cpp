@@ -0,0 +1,441 @@
+#include "Commands/SpirrowBridgeSaveManager.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "Misc/PackageName.h"
+
+FSpirrowBridgeSaveManager& FSpirrowBridgeSaveManager::Get()
+{
+    static FSpirrowBridgeSaveManager Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeSaveManager::Startup()
+{
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FSpirrowBridgeSaveManager::Tick), 0.5f);
+    }
+}
+
+void FSpirrowBridgeSaveManager::Shutdown()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    // Manual mode leaves the packages dirty so the editor prompts on exit
+    if (Policy == ESpirrowSavePolicy::Deferred)
+    {
+        Flush();
+    }
+}
+
+bool FSpirrowBridgeSaveManager::RequestSave(UObject* Asset)
+{
+    if (!Asset)
+    {
+        return false;
+    }
+
+    UPackage* Package = Asset->GetPackage();
+    ++TotalRequests;
+
+    if (Policy == ESpirrowSavePolicy::Immediate && DeferralDepth == 0)
+    {
+        ++TotalSaves;
+        return SavePackageNow(Package, Asset);
+    }
+
+    MarkPending(Package);
+    return true;
+}
+
+void FSpirrowBridgeSaveManager::MarkPending(UPackage* Package)
+{
+    if (!Package)
+    {
+        return;
+    }
+
+    Package->MarkPackageDirty();
+    PendingPackages.Add(Package);
+    LastRequestTime = FPlatformTime::Seconds();
+}
+
+int32 FSpirrowBridgeSaveManager::Flush(bool bConcurrent, TArray<FSpirrowPackageSaveResult>* OutResults)
+{
+    // Swap first: saving can trigger further RequestSave calls (e.g. PostSaveRoot)
+    TSet<TWeakObjectPtr<UPackage>> PendingSnapshot = MoveTemp(PendingPackages);
+    PendingPackages.Reset();
+
+    TArray<UPackage*> PackagesToSave;
+    for (const TWeakObjectPtr<UPackage>& PackagePtr : PendingSnapshot)
+    {
+        if (UPackage* Package = PackagePtr.Get())
+        {
+            PackagesToSave.Add(Package);
+        }
+    }
+
+    TArray<FSpirrowPackageSaveResult> Results;
+    SavePackages(PackagesToSave, bConcurrent, Results);
+    TotalSaves += Results.Num();
+
+    int32 SavedCount = 0;
+    for (const FSpirrowPackageSaveResult& Result : Results)
+    {
+        if (Result.bSuccess)
+        {
+            ++SavedCount;
+        }
+        else if (UPackage* Package = FindPackage(nullptr, *Result.PackageName))
+        {
+            // Keep the edit pending instead of silently dropping it
+            PendingPackages.Add(Package);
+            LastFailedFlushTime = FPlatformTime::Seconds();
+        }
+    }
+    if (OutResults)
+    {
+        OutResults->Append(MoveTemp(Results));
+    }
+    return SavedCount;
+}
+
+FString FSpirrowBridgeSaveManager::GetPackageFilename(const UPackage* Package)
+{
+    return FPackageName::LongPackageNameToFilename(Package->GetName(),
+        Package->ContainsMap() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension());
+}
+
+void FSpirrowBridgeSaveManager::SavePackageSequential(UPackage* Package, UObject* Asset, FSpirrowPackageSaveResult& OutResult)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+    SaveArgs.SaveFlags = SAVE_NoError;
+
+    const FSavePackageResultStruct SaveResult = UPackage::Save(Package, Asset, *GetPackageFilename(Package), SaveArgs);
+
+    OutResult.PackageName = Package->GetName();
+    OutResult.bSuccess = SaveResult.IsSuccessful();
+    OutResult.bConcurrent = false;
+    OutResult.BytesWritten = SaveResult.TotalFileSize;
+    OutResult.ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    if (!OutResult.bSuccess)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SpirrowBridge: Failed to save package %s"), *OutResult.PackageName);
+    }
+}
+
+bool FSpirrowBridgeSaveManager::SavePackageNow(UPackage* Package, UObject* Asset)
+{
+    if (!Package)
+    {
+        return false;
+    }
+
+    FSpirrowPackageSaveResult Result;
+    SavePackageSequential(Package, Asset ? Asset : Package->FindAssetInPackage(), Result);
+    return Result.bSuccess;
+}
+
+void FSpirrowBridgeSaveManager::SavePackages(const TArray<UPackage*>& Packages, bool bConcurrent, TArray<FSpirrowPackageSaveResult>& OutResults)
+{
+    TArray<FPackageSaveInfo> ConcurrentInfos;
+    TArray<TPair<UPackage*, UObject*>> SequentialPackages;
+
+    for (UPackage* Package : Packages)
+    {
+        if (!Package)
+        {
+            continue;
+        }
+
+        // Maps drag in external actors and world partition data, keep them on the regular path
+        UObject* Asset = Package->FindAssetInPackage();
+        if (bConcurrent && Asset && !Package->ContainsMap())
+        {
+            FPackageSaveInfo& Info = ConcurrentInfos.AddDefaulted_GetRef();
+            Info.Package = Package;
+            Info.Asset = Asset;
+            Info.Filename = GetPackageFilename(Package);
+        }
+        else
+        {
+            SequentialPackages.Emplace(Package, Asset);
+        }
+    }
+
+    // A single package gains nothing from the concurrent path
+    if (ConcurrentInfos.Num() == 1)
+    {
+        SequentialPackages.Emplace(ConcurrentInfos[0].Package, ConcurrentInfos[0].Asset);
+        ConcurrentInfos.Reset();
+    }
+
+    if (ConcurrentInfos.Num() > 0)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+        SaveArgs.SaveFlags = SAVE_NoError;
+
+        TArray<FSavePackageResultStruct> SaveResults;
+        UPackage::SaveConcurrent(ConcurrentInfos, SaveArgs, SaveResults);
+
+        const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+        for (int32 Index = 0; Index < ConcurrentInfos.Num(); ++Index)
+        {
+            const FPackageSaveInfo& Info = ConcurrentInfos[Index];
+            if (SaveResults.IsValidIndex(Index) && SaveResults[Index].IsSuccessful())
+            {
+                FSpirrowPackageSaveResult& Result = OutResults.AddDefaulted_GetRef();
+                Result.PackageName = Info.Package->GetName();
+                Result.bSuccess = true;
+                Result.bConcurrent = true;
+                Result.BytesWritten = SaveResults[Index].TotalFileSize;
+                Result.ElapsedMs = ElapsedMs;
+            }
+            else
+            {
+                UE_LOG(LogTemp, Display, TEXT("SpirrowBridge: Concurrent save failed for %s, retrying sequentially"),
+                    *Info.Package->GetName());
+                SequentialPackages.Emplace(Info.Package, Info.Asset);
+            }
+        }
+    }
+
+    for (const TPair<UPackage*, UObject*>& Entry : SequentialPackages)
+    {
+        SavePackageSequential(Entry.Key, Entry.Value, OutResults.AddDefaulted_GetRef());
+    }
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeSaveManager::SaveResultToJson(const FSpirrowPackageSaveResult& Result)
+{
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("package"), Result.PackageName);
+    ResultObj->SetBoolField(TEXT("success"), Result.bSuccess);
+    ResultObj->SetBoolField(TEXT("concurrent"), Result.bConcurrent);
+    ResultObj->SetNumberField(TEXT("bytes"), static_cast<double>(Result.BytesWritten));
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), Result.ElapsedMs);
+    return ResultObj;
+}
+
+bool FSpirrowBridgeSaveManager::ParsePolicy(const FString& PolicyName, ESpirrowSavePolicy& OutPolicy)
+{
+    if (PolicyName.Equals(TEXT("immediate"), ESearchCase::IgnoreCase))
+    {
+        OutPolicy = ESpirrowSavePolicy::Immediate;
+    }
+    else if (PolicyName.Equals(TEXT("deferred"), ESearchCase::IgnoreCase))
+    {
+        OutPolicy = ESpirrowSavePolicy::Deferred;
+    }
+    else if (PolicyName.Equals(TEXT("manual"), ESearchCase::IgnoreCase))
+    {
+        OutPolicy = ESpirrowSavePolicy::Manual;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+FString FSpirrowBridgeSaveManager::PolicyToString(ESpirrowSavePolicy InPolicy)
+{
+    switch (InPolicy)
+    {
+    case ESpirrowSavePolicy::Deferred:
+        return TEXT("deferred");
+    case ESpirrowSavePolicy::Manual:
+        return TEXT("manual");
+    default:
+        return TEXT("immediate");
+    }
+}
+
+FSpirrowBridgeSaveManager::FScopedDeferral::FScopedDeferral()
+{
+    ++FSpirrowBridgeSaveManager::Get().DeferralDepth;
+}
+
+FSpirrowBridgeSaveManager::FScopedDeferral::~FScopedDeferral()
+{
+    FSpirrowBridgeSaveManager& Manager = FSpirrowBridgeSaveManager::Get();
+    if (--Manager.DeferralDepth == 0 && Manager.Policy == ESpirrowSavePolicy::Immediate)
+    {
+        Manager.Flush();
+    }
+}
+
+bool FSpirrowBridgeSaveManager::Tick(float DeltaTime)
+{
+    if (Policy == ESpirrowSavePolicy::Deferred && DeferralDepth == 0 && PendingPackages.Num() > 0 &&
+        LastRequestTime > LastFailedFlushTime && FPlatformTime::Seconds() - LastRequestTime >= IdleFlushSeconds)
+    {
+        TArray<FSpirrowPackageSaveResult> Results;
+        const int32 SavedCount = Flush(true, &Results);
+        UE_LOG(LogTemp, Display, TEXT("SpirrowBridge: Idle flush saved %d package(s)"), SavedCount);
+        if (SavedCount < Results.Num())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("SpirrowBridge: %d package(s) failed to save and remain pending"),
+                Results.Num() - SavedCount);
+        }
+    }
+    return true;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeSaveManager::MakeStatusJson() const
+{
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("policy"), PolicyToString(Policy));
+    ResultObj->SetNumberField(TEXT("idle_seconds"), IdleFlushSeconds);
+    ResultObj->SetNumberField(TEXT("pending"), PendingPackages.Num());
+    ResultObj->SetNumberField(TEXT("total_requests"), TotalRequests);
+    ResultObj->SetNumberField(TEXT("total_saves"), TotalSaves);
+
+    TArray<TSharedPtr<FJsonValue>> PendingArray;
+    for (const TWeakObjectPtr<UPackage>& PackagePtr : PendingPackages)
+    {
+        if (const UPackage* Package = PackagePtr.Get())
+        {
+            PendingArray.Add(MakeShared<FJsonValueString>(Package->GetName()));
+        }
+    }
+    ResultObj->SetArrayField(TEXT("pending_packages"), PendingArray);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeSaveManager::MakeSaveReportJson(const TArray<FSpirrowPackageSaveResult>& Results, double StartTime) const
+{
+    TSharedPtr<FJsonObject> ResultObj = MakeStatusJson();
+
+    TArray<TSharedPtr<FJsonValue>> SavedArray, FailedArray, PackageArray;
+    int32 ConcurrentCount = 0;
+    int64 TotalBytes = 0;
+    for (const FSpirrowPackageSaveResult& Result : Results)
+    {
+        (Result.bSuccess ? SavedArray : FailedArray).Add(MakeShared<FJsonValueString>(Result.PackageName));
+        PackageArray.Add(MakeShared<FJsonValueObject>(SaveResultToJson(Result)));
+        ConcurrentCount += Result.bConcurrent ? 1 : 0;
+        TotalBytes += Result.BytesWritten;
+    }
+    ResultObj->SetArrayField(TEXT("saved"), SavedArray);
+    ResultObj->SetArrayField(TEXT("failed"), FailedArray);
+    ResultObj->SetArrayField(TEXT("packages"), PackageArray);
+    ResultObj->SetNumberField(TEXT("concurrent_count"), ConcurrentCount);
+    ResultObj->SetNumberField(TEXT("total_bytes"), static_cast<double>(TotalBytes));
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeSaveManager::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("set_save_policy"))
+    {
+        FString PolicyName;
+        if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("policy"), PolicyName))
+        {
+            return Error;
+        }
+
+        ESpirrowSavePolicy NewPolicy;
+        if (!ParsePolicy(PolicyName, NewPolicy))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::InvalidParamValue,
+                FString::Printf(TEXT("Invalid policy '%s' (expected immediate, deferred or manual)"), *PolicyName));
+        }
+
+        FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("idle_seconds"), IdleFlushSeconds, IdleFlushSeconds);
+        IdleFlushSeconds = FMath::Max(0.0, IdleFlushSeconds);
+        Policy = NewPolicy;
+
+        // Switching back to immediate must not strand pending edits
+        if (Policy == ESpirrowSavePolicy::Immediate && DeferralDepth == 0)
+        {
+            Flush();
+        }
+        return MakeStatusJson();
+    }
+    else if (CommandType == TEXT("flush_saves"))
+    {
+        bool bConcurrent;
+        FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("concurrent"), bConcurrent, true);
+
+        const double StartTime = FPlatformTime::Seconds();
+        TArray<FSpirrowPackageSaveResult> Results;
+        Flush(bConcurrent, &Results);
+        return MakeSaveReportJson(Results, StartTime);
+    }
+    else if (CommandType == TEXT("save_packages"))
+    {
+        const TArray<TSharedPtr<FJsonValue>>* PackageNames = nullptr;
+        if (!Params->TryGetArrayField(TEXT("packages"), PackageNames))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::MissingRequiredParam,
+                TEXT("Missing 'packages' array"));
+        }
+
+        bool bConcurrent, bOnlyDirty;
+        FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("concurrent"), bConcurrent, true);
+        FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("only_dirty"), bOnlyDirty, true);
+
+        const double StartTime = FPlatformTime::Seconds();
+        TArray<UPackage*> PackagesToSave;
+        TArray<TSharedPtr<FJsonValue>> NotFoundArray;
+        for (const TSharedPtr<FJsonValue>& NameValue : *PackageNames)
+        {
+            // Accept both "/Game/Foo/Bar" and object paths like "/Game/Foo/Bar.Bar"
+            const FString PackageName = FPackageName::ObjectPathToPackageName(NameValue->AsString());
+            UPackage* Package = FindPackage(nullptr, *PackageName);
+            if (!Package)
+            {
+                NotFoundArray.Add(MakeShared<FJsonValueString>(PackageName));
+                continue;
+            }
+            if (!bOnlyDirty || Package->IsDirty())
+            {
+                PackagesToSave.AddUnique(Package);
+            }
+        }
+
+        TArray<FSpirrowPackageSaveResult> Results;
+        SavePackages(PackagesToSave, bConcurrent, Results);
+        TotalSaves += Results.Num();
+
+        // Saved packages no longer need to wait in the dirty set
+        const TSet<UPackage*> SavedSet(PackagesToSave);
+        for (auto It = PendingPackages.CreateIterator(); It; ++It)
+        {
+            if (!It->IsValid() || (SavedSet.Contains(It->Get()) && !(*It)->IsDirty()))
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        TSharedPtr<FJsonObject> ResultObj = MakeSaveReportJson(Results, StartTime);
+        ResultObj->SetArrayField(TEXT("not_found"), NotFoundArray);
+        return ResultObj;
+    }
+    else if (CommandType == TEXT("get_save_status"))
+    {
+        return MakeStatusJson();
+    }
+
+    return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+        ESpirrowErrorCode::UnknownCommand,
+        FString::Printf(TEXT("Unknown save command: %s"), *CommandType));
+}
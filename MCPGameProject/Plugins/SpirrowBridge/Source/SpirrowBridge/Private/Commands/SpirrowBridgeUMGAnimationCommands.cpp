@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeUMGAnimationCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
@@ -136,7 +137,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGAnimationCommands::HandleCreateWidgetAn
 
 	// Mark Blueprint as modified and compile
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -347,7 +348,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGAnimationCommands::HandleAddAnimationTr
 
 	// Save
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Create response
 	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeUMGLayoutCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
 #include "Components/TextBlock.h"
@@ -434,7 +435,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleSetWidgetSlotProp
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -652,7 +653,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleSetWidgetElementP
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -784,7 +785,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleAddVerticalBoxToW
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -916,7 +917,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleAddHorizontalBoxT
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -1017,7 +1018,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleReparentWidgetEle
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -1105,7 +1106,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleRemoveWidgetEleme
 
 	// Mark package dirty and recompile
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Verify removal
 	UWidget* VerifyWidget = WidgetTree->FindWidget(FName(*ElementName));
@@ -1,5 +1,7 @@
 #include "Commands/SpirrowBridgeUMGVariableCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
@@ -239,7 +241,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleAddWidgetVariab
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -298,7 +300,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleSetWidgetVariab
 	Variable->DefaultValue = DefaultValue;
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -443,7 +445,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleAddWidgetFuncti
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -526,7 +528,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleAddWidgetEvent(
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -681,7 +683,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleBindWidgetToVar
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -786,8 +788,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleBindWidgetEvent
 			TEXT("Failed to create event node"));
 	}
 
-	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-	UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBlueprint);
+	FSpirrowBridgeSaveManager::Get().RequestSave(WidgetBlueprint);
 
 	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
 	Response->SetBoolField(TEXT("success"), true);
@@ -873,8 +875,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleSetTextBlockBin
 		}
 	}
 
-	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-	UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBlueprint);
+	FSpirrowBridgeSaveManager::Get().RequestSave(WidgetBlueprint);
 
 	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
 	Response->SetBoolField(TEXT("success"), true);
@@ -959,7 +961,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleAddWidgetArrayV
 	}
 
 	WidgetBP->NewVariables.Add(NewVar);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 	WidgetBP->MarkPackageDirty();
 
 	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
@@ -1096,6 +1098,9 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleBindWidgetCompo
 		}
 	}
 
+	// Bound widget variables and new functions only reach the generated classes through a compile
+	FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(WidgetBP);
+
 	// Ensure widget is bound as a variable
 	FObjectProperty* WidgetProperty = FindFProperty<FObjectProperty>(WidgetBP->SkeletonGeneratedClass, FName(*ComponentName));
 	if (!WidgetProperty)
@@ -1170,7 +1175,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleBindWidgetCompo
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
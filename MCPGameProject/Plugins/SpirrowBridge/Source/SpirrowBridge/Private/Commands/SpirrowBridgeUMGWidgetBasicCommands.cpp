@@ -1,6 +1,7 @@
 #include "Commands/SpirrowBridgeUMGWidgetBasicCommands.h"
 #include "Commands/SpirrowBridgeUMGWidgetCoreCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
@@ -137,7 +138,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddTextToWid
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -218,7 +219,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddTextBlock
 
 	// Mark the package dirty and compile
 	WidgetBlueprint->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBlueprint);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -337,7 +338,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddImageToWi
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -455,7 +456,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddProgressB
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -1,5 +1,7 @@
 #include "Commands/SpirrowBridgeUMGWidgetCoreCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -173,14 +175,9 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetCoreCommands::HandleCreateUMGWidg
 	// Mark and save
 	Package->MarkPackageDirty();
 	FAssetRegistryModule::AssetCreated(WidgetBlueprint);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBlueprint);
 
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(FullPath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	SaveArgs.Error = GError;
-	SaveArgs.SaveFlags = SAVE_NoError;
-	UPackage::SavePackage(Package, WidgetBlueprint, *PackageFileName, SaveArgs);
+	FSpirrowBridgeSaveManager::Get().RequestSave(WidgetBlueprint);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -219,6 +216,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetCoreCommands::HandleAddWidgetToVi
 	double ZOrder;
 	FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("z_order"), ZOrder, 0.0);
 
+	FSpirrowBridgeCompileScheduler::Get().EnsureCompiled(WidgetBlueprint);
 	UClass* WidgetClass = WidgetBlueprint->GeneratedClass;
 	if (!WidgetClass)
 	{
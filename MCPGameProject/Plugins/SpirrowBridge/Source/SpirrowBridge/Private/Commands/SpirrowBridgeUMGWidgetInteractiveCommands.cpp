@@ -1,6 +1,7 @@
 #include "Commands/SpirrowBridgeUMGWidgetInteractiveCommands.h"
 #include "Commands/SpirrowBridgeUMGWidgetCoreCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
@@ -173,7 +174,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddBut
 
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -285,7 +286,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddSli
 
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -393,7 +394,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddChe
 
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -504,7 +505,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddCom
 	}
 
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -618,7 +619,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddEdi
 	}
 
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -716,7 +717,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddSpi
 	}
 
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -819,7 +820,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddScr
 	}
 
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	FSpirrowBridgeCompileScheduler::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
@@ -11,6 +11,68 @@
 #include "Misc/ScopeLock.h"
 #include "HAL/PlatformTime.h"
 
+namespace
+{
+    // Upper bound for a single buffered request
+    constexpr int32 MaxMessageSize = 16 * 1024 * 1024;
+
+    /**
+     * Tracks {} / [] nesting outside of string literals across reads, so each received byte is
+     * scanned once and the message is only converted and parsed when no more bytes are expected
+     */
+    struct FJsonMessageScanner
+    {
+        int32 Depth = 0;
+        bool bInString = false;
+        bool bEscaped = false;
+
+        void Feed(const uint8* Data, int32 Num)
+        {
+            for (int32 Index = 0; Index < Num; ++Index)
+            {
+                const uint8 Byte = Data[Index];
+                if (bInString)
+                {
+                    if (bEscaped)
+                    {
+                        bEscaped = false;
+                    }
+                    else if (Byte == '\\')
+                    {
+                        bEscaped = true;
+                    }
+                    else if (Byte == '"')
+                    {
+                        bInString = false;
+                    }
+                }
+                else if (Byte == '"')
+                {
+                    bInString = true;
+                }
+                else if (Byte == '{' || Byte == '[')
+                {
+                    ++Depth;
+                }
+                else if (Byte == '}' || Byte == ']')
+                {
+                    --Depth;
+                }
+            }
+        }
+
+        bool IsClosed() const
+        {
+            return Depth <= 0 && !bInString;
+        }
+
+        void Reset()
+        {
+            *this = FJsonMessageScanner();
+        }
+    };
+}
+
 FMCPServerRunnable::FMCPServerRunnable(USpirrowBridge* InBridge, TSharedPtr<FSocket> InListenerSocket)
     : Bridge(InBridge)
     , ListenerSocket(InListenerSocket)
@@ -54,6 +116,10 @@ uint32 FMCPServerRunnable::Run()
                 ClientSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
                 
                 uint8 Buffer[8192];
+                // Large messages (e.g. execute_batch) arrive over several reads,
+                // so bytes are accumulated until they form a complete JSON object
+                TArray<uint8> PendingData;
+                FJsonMessageScanner Scanner;
                 while (bRunning)
                 {
                     int32 BytesRead = 0;
@@ -65,10 +131,32 @@ uint32 FMCPServerRunnable::Run()
                             break;
                         }
 
+                        PendingData.Append(Buffer, BytesRead);
+                        if (PendingData.Num() > MaxMessageSize)
+                        {
+                            // Messages are not length-prefixed, so the rest of this one cannot be told apart
+                            // from the next; resyncing mid-stream could run a fragment as a command. Drop the client.
+                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Message exceeds %d bytes, closing connection"), MaxMessageSize);
+                            const FString ErrorResponse = FString::Printf(
+                                TEXT("{\"status\":\"error\",\"error\":\"Message exceeds %d bytes; connection closed\"}"), MaxMessageSize);
+                            FTCHARToUTF8 ErrorUtf8(*ErrorResponse);
+                            int32 BytesSent = 0;
+                            ClientSocket->Send((const uint8*)ErrorUtf8.Get(), ErrorUtf8.Length(), BytesSent);
+                            ClientSocket->Close();
+                            break;
+                        }
+
+                        Scanner.Feed(Buffer, BytesRead);
+                        if (!Scanner.IsClosed())
+                        {
+                            // Incomplete message, wait for the rest
+                            UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Waiting for more data (%d bytes buffered)"), PendingData.Num());
+                            continue;
+                        }
+                        Scanner.Reset();
+
                         // Convert received data to string
-                        Buffer[BytesRead] = '\0';
-                        FString ReceivedText = UTF8_TO_TCHAR(Buffer);
-                        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *ReceivedText);
+                        FString ReceivedText(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(PendingData.GetData()), PendingData.Num()));
 
                         // Parse JSON
                         TSharedPtr<FJsonObject> JsonObject;
@@ -76,6 +164,9 @@ uint32 FMCPServerRunnable::Run()
                         
                         if (FJsonSerializer::Deserialize(Reader, JsonObject))
                         {
+                            PendingData.Reset();
+                            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *ReceivedText.Left(1024));
+
                             // Get command type
                             FString CommandType;
                             if (JsonObject->TryGetStringField(TEXT("type"), CommandType))
@@ -86,9 +177,10 @@ uint32 FMCPServerRunnable::Run()
                                 // Log response for debugging
                                 UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response: %s"), *Response);
                                 
-                                // Send response
+                                // Send response (byte length of the UTF-8 data, not the character count)
+                                FTCHARToUTF8 ResponseUtf8(*Response);
                                 int32 BytesSent = 0;
-                                if (!ClientSocket->Send((uint8*)TCHAR_TO_UTF8(*Response), Response.Len(), BytesSent))
+                                if (!ClientSocket->Send((const uint8*)ResponseUtf8.Get(), ResponseUtf8.Length(), BytesSent))
                                 {
                                     UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to send response"));
                                 }
@@ -103,7 +195,8 @@ uint32 FMCPServerRunnable::Run()
                         }
                         else
                         {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON from: %s"), *ReceivedText);
+                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON from: %s"), *ReceivedText.Left(1024));
+                            PendingData.Reset();
                         }
                     }
                     else
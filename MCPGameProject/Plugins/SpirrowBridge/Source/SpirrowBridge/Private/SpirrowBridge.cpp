@@ -17,12 +17,18 @@
 #include "Camera/CameraActor.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "UObject/ObjectSaveContext.h"
 #include "JsonObjectConverter.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Selection.h"
 #include "Kismet/GameplayStatics.h"
 #include "Async/Async.h"
 #include "Containers/Ticker.h"  // For FTSTicker (import operations that bypass TaskGraph)
+// Batch execution
+#include "Editor.h"
+#include "ScopedTransaction.h"
+#include "UObject/UObjectGlobals.h"
 // Add Blueprint related includes
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
@@ -62,11 +68,20 @@
 #include "Commands/SpirrowBridgeUMGAnimationCommands.h"
 #include "Commands/SpirrowBridgeUMGVariableCommands.h"
 #include "Commands/SpirrowBridgeConfigCommands.h"
+#include "Commands/SpirrowBridgeDataTableCommands.h"
 #include "Commands/SpirrowBridgeGASCommands.h"
 #include "Commands/SpirrowBridgeMaterialCommands.h"
 #include "Commands/SpirrowBridgeAICommands.h"
 #include "Commands/SpirrowBridgeAIPerceptionCommands.h"
 #include "Commands/SpirrowBridgeEQSCommands.h"
+#include "Commands/SpirrowBridgeLevelCommands.h"
+#include "Commands/SpirrowBridgeSaveManager.h"
+#include "Commands/SpirrowBridgeCompileScheduler.h"
+#include "Commands/SpirrowBridgeAssetResolver.h"
+#include "Commands/SpirrowBridgeClassIndex.h"
+#include "Commands/SpirrowBridgePropertyPathCache.h"
+#include "Commands/SpirrowBridgeNodeIndex.h"
+#include "Commands/SpirrowBridgeBlueprintSearchIndex.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
@@ -83,11 +98,13 @@ USpirrowBridge::USpirrowBridge()
     UMGAnimationCommands = MakeShared<FSpirrowBridgeUMGAnimationCommands>();
     UMGVariableCommands = MakeShared<FSpirrowBridgeUMGVariableCommands>();
     ConfigCommands = MakeShared<FSpirrowBridgeConfigCommands>();
+    DataTableCommands = MakeShared<FSpirrowBridgeDataTableCommands>();
     GASCommands = MakeShared<FSpirrowBridgeGASCommands>();
     MaterialCommands = MakeShared<FSpirrowBridgeMaterialCommands>();
     AICommands = MakeShared<FSpirrowBridgeAICommands>();
     AIPerceptionCommands = MakeShared<FSpirrowBridgeAIPerceptionCommands>();
     EQSCommands = MakeShared<FSpirrowBridgeEQSCommands>();
+    LevelCommands = MakeShared<FSpirrowBridgeLevelCommands>();
 }
 
 USpirrowBridge::~USpirrowBridge()
@@ -101,11 +118,13 @@ USpirrowBridge::~USpirrowBridge()
     UMGAnimationCommands.Reset();
     UMGVariableCommands.Reset();
     ConfigCommands.Reset();
+    DataTableCommands.Reset();
     GASCommands.Reset();
     MaterialCommands.Reset();
     AICommands.Reset();
     AIPerceptionCommands.Reset();
     EQSCommands.Reset();
+    LevelCommands.Reset();
 }
 
 // Initialize subsystem
@@ -120,6 +139,14 @@ void USpirrowBridge::Initialize(FSubsystemCollectionBase& Collection)
     Port = MCP_SERVER_PORT;
     FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
 
+    FSpirrowBridgeSaveManager::Get().Startup();
+    FSpirrowBridgeCompileScheduler::Get().Startup();
+    FSpirrowBridgeAssetResolver::Get().Startup();
+    FSpirrowBridgeClassIndex::Get().Startup();
+    FSpirrowBridgePropertyPathCache::Get().Startup();
+    FSpirrowBridgeNodeIndex::Get().Startup();
+    FSpirrowBridgeBlueprintSearchIndex::Get().Startup();
+
     // Start the server automatically
     StartServer();
 }
@@ -129,6 +156,13 @@ void USpirrowBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("SpirrowBridge: Shutting down"));
     StopServer();
+    FSpirrowBridgeCompileScheduler::Get().Shutdown();
+    FSpirrowBridgeSaveManager::Get().Shutdown();
+    FSpirrowBridgeAssetResolver::Get().Shutdown();
+    FSpirrowBridgeClassIndex::Get().Shutdown();
+    FSpirrowBridgePropertyPathCache::Get().Shutdown();
+    FSpirrowBridgeNodeIndex::Get().Shutdown();
+    FSpirrowBridgeBlueprintSearchIndex::Get().Shutdown();
 }
 
 // Start the MCP server
@@ -309,226 +343,18 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
         
         try
         {
-            TSharedPtr<FJsonObject> ResultJson;
-            
-            if (CommandType == TEXT("ping"))
-            {
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
-            }
-            // Editor Commands (including actor manipulation)
-            else if (CommandType == TEXT("get_actors_in_level") ||
-                     CommandType == TEXT("find_actors_by_name") ||
-                     CommandType == TEXT("spawn_actor") ||
-                     CommandType == TEXT("create_actor") ||
-                     CommandType == TEXT("delete_actor") ||
-                     CommandType == TEXT("set_actor_transform") ||
-                     CommandType == TEXT("get_actor_properties") ||
-                     CommandType == TEXT("set_actor_property") ||
-                     CommandType == TEXT("get_actor_components") ||
-                     CommandType == TEXT("rename_actor") ||
-                     CommandType == TEXT("rename_asset") ||
-                     CommandType == TEXT("spawn_blueprint_actor") ||
-                     CommandType == TEXT("focus_viewport") ||
-                     CommandType == TEXT("take_screenshot"))
-            {
-                ResultJson = EditorCommands->HandleCommand(CommandType, Params);
-            }
-            // Blueprint Commands
-            else if (CommandType == TEXT("create_blueprint") ||
-                     CommandType == TEXT("add_component_to_blueprint") ||
-                     CommandType == TEXT("set_component_property") ||
-                     CommandType == TEXT("set_physics_properties") ||
-                     CommandType == TEXT("compile_blueprint") ||
-                     CommandType == TEXT("set_blueprint_property") ||
-                     CommandType == TEXT("set_static_mesh_properties") ||
-                     CommandType == TEXT("set_pawn_properties") ||
-                     CommandType == TEXT("scan_project_classes") ||
-                     CommandType == TEXT("duplicate_blueprint") ||
-                     CommandType == TEXT("get_blueprint_graph") ||
-                     CommandType == TEXT("set_blueprint_class_array") ||
-                     CommandType == TEXT("set_struct_array_property") ||
-                     // New property commands (v0.8.8)
-                     CommandType == TEXT("create_data_asset") ||
-                     CommandType == TEXT("set_class_property") ||
-                     CommandType == TEXT("set_object_property") ||
-                     CommandType == TEXT("get_blueprint_properties") ||
-                     CommandType == TEXT("set_struct_property") ||
-                     CommandType == TEXT("set_data_asset_property") ||
-                     // Batch operations (v0.8.9)
-                     CommandType == TEXT("batch_set_properties"))
-            {
-                ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
-            }
-            // Blueprint Node Commands
-            else if (CommandType == TEXT("connect_blueprint_nodes") || 
-                     CommandType == TEXT("add_blueprint_get_self_component_reference") ||
-                     CommandType == TEXT("add_blueprint_self_reference") ||
-                     CommandType == TEXT("find_blueprint_nodes") ||
-                     CommandType == TEXT("add_blueprint_event_node") ||
-                     CommandType == TEXT("add_blueprint_input_action_node") ||
-                     CommandType == TEXT("add_blueprint_function_node") ||
-                     CommandType == TEXT("add_blueprint_get_component_node") ||
-                     CommandType == TEXT("add_blueprint_variable") ||
-                     // New node manipulation commands
-                     CommandType == TEXT("set_node_pin_value") ||
-                     CommandType == TEXT("add_variable_get_node") ||
-                     CommandType == TEXT("add_variable_set_node") ||
-                     CommandType == TEXT("add_branch_node") ||
-                     CommandType == TEXT("delete_node") ||
-                     CommandType == TEXT("move_node") ||
-                     // Control flow nodes
-                     CommandType == TEXT("add_sequence_node") ||
-                     CommandType == TEXT("add_delay_node") ||
-                     CommandType == TEXT("add_foreach_loop_node") ||
-                     CommandType == TEXT("add_forloop_with_break_node") ||
-                     // Debug & utility nodes
-                     CommandType == TEXT("add_print_string_node") ||
-                     // Math & comparison nodes
-                     CommandType == TEXT("add_math_node") ||
-                     CommandType == TEXT("add_comparison_node"))
-            {
-                ResultJson = BlueprintNodeCommands->HandleCommand(CommandType, Params);
-            }
-            // Project Commands
-            else if (CommandType == TEXT("create_input_mapping") ||
-                     CommandType == TEXT("create_input_action") ||
-                     CommandType == TEXT("create_input_mapping_context") ||
-                     CommandType == TEXT("add_action_to_mapping_context") ||
-                     CommandType == TEXT("get_input_mapping_context") ||
-                     CommandType == TEXT("get_input_action") ||
-                     CommandType == TEXT("remove_action_from_mapping_context") ||
-                     CommandType == TEXT("delete_asset") ||
-                     CommandType == TEXT("add_mapping_context_to_blueprint") ||
-                     CommandType == TEXT("set_default_mapping_context") ||
-                     // Asset utility commands
-                     CommandType == TEXT("asset_exists") ||
-                     CommandType == TEXT("create_content_folder") ||
-                     CommandType == TEXT("list_assets_in_folder") ||
-                     CommandType == TEXT("import_texture") ||
-                     CommandType == TEXT("get_project_info") ||
-                     CommandType == TEXT("find_asset_references"))
-            {
-                ResultJson = ProjectCommands->HandleCommand(CommandType, Params);
-            }
-            // UMG Widget Commands
-            else if (CommandType == TEXT("create_umg_widget_blueprint") ||
-                     CommandType == TEXT("add_text_to_widget") ||
-                     CommandType == TEXT("add_text_block_to_widget") ||
-                     CommandType == TEXT("add_image_to_widget") ||
-                     CommandType == TEXT("add_progressbar_to_widget") ||
-                     CommandType == TEXT("add_button_to_widget") ||
-                     CommandType == TEXT("add_slider_to_widget") ||
-                     CommandType == TEXT("add_checkbox_to_widget") ||
-                     CommandType == TEXT("add_combobox_to_widget") ||
-                     CommandType == TEXT("add_editabletext_to_widget") ||
-                     CommandType == TEXT("add_spinbox_to_widget") ||
-                     CommandType == TEXT("add_scrollbox_to_widget") ||
-                     CommandType == TEXT("add_widget_to_viewport"))
-            {
-                ResultJson = UMGWidgetCommands->HandleCommand(CommandType, Params);
-            }
-            // UMG Layout Commands
-            else if (CommandType == TEXT("add_vertical_box_to_widget") ||
-                     CommandType == TEXT("add_horizontal_box_to_widget") ||
-                     CommandType == TEXT("get_widget_elements") ||
-                     CommandType == TEXT("set_widget_slot_property") ||
-                     CommandType == TEXT("set_widget_element_property") ||
-                     CommandType == TEXT("reparent_widget_element") ||
-                     CommandType == TEXT("remove_widget_element"))
-            {
-                ResultJson = UMGLayoutCommands->HandleCommand(CommandType, Params);
-            }
-            // UMG Animation Commands
-            else if (CommandType == TEXT("create_widget_animation") ||
-                     CommandType == TEXT("add_animation_track") ||
-                     CommandType == TEXT("add_animation_keyframe") ||
-                     CommandType == TEXT("get_widget_animations"))
-            {
-                ResultJson = UMGAnimationCommands->HandleCommand(CommandType, Params);
-            }
-            // UMG Variable Commands
-            else if (CommandType == TEXT("add_widget_variable") ||
-                     CommandType == TEXT("add_widget_array_variable") ||
-                     CommandType == TEXT("set_widget_variable_default") ||
-                     CommandType == TEXT("add_widget_function") ||
-                     CommandType == TEXT("add_widget_event") ||
-                     CommandType == TEXT("bind_widget_to_variable") ||
-                     CommandType == TEXT("bind_widget_event") ||
-                     CommandType == TEXT("set_text_block_binding") ||
-                     CommandType == TEXT("bind_widget_component_event"))
-            {
-                ResultJson = UMGVariableCommands->HandleCommand(CommandType, Params);
-            }
-            // Config Commands
-            else if (CommandType == TEXT("get_config_value") ||
-                     CommandType == TEXT("set_config_value") ||
-                     CommandType == TEXT("list_config_sections"))
-            {
-                ResultJson = ConfigCommands->HandleCommand(CommandType, Params);
-            }
-            // GAS Commands
-            else if (CommandType == TEXT("add_gameplay_tags") ||
-                     CommandType == TEXT("list_gameplay_tags") ||
-                     CommandType == TEXT("remove_gameplay_tag") ||
-                     CommandType == TEXT("list_gas_assets") ||
-                     CommandType == TEXT("create_gameplay_effect") ||
-                     CommandType == TEXT("create_gas_character") ||
-                     CommandType == TEXT("set_ability_system_defaults") ||
-                     CommandType == TEXT("create_gameplay_ability"))
-            {
-                ResultJson = GASCommands->HandleCommand(CommandType, Params);
-            }
-            // Material Commands
-            else if (CommandType == TEXT("create_simple_material"))
-            {
-                ResultJson = MaterialCommands->HandleCommand(CommandType, Params);
-            }
-            // AI Commands
-            else if (CommandType == TEXT("create_blackboard") ||
-                     CommandType == TEXT("add_blackboard_key") ||
-                     CommandType == TEXT("remove_blackboard_key") ||
-                     CommandType == TEXT("list_blackboard_keys") ||
-                     CommandType == TEXT("create_behavior_tree") ||
-                     CommandType == TEXT("set_behavior_tree_blackboard") ||
-                     CommandType == TEXT("get_behavior_tree_structure") ||
-                     CommandType == TEXT("list_ai_assets") ||
-                     // Phase G: BT Node Operations
-                     CommandType == TEXT("add_bt_composite_node") ||
-                     CommandType == TEXT("add_bt_task_node") ||
-                     CommandType == TEXT("add_bt_decorator_node") ||
-                     CommandType == TEXT("add_bt_service_node") ||
-                     CommandType == TEXT("connect_bt_nodes") ||
-                     CommandType == TEXT("set_bt_node_property") ||
-                     CommandType == TEXT("delete_bt_node") ||
-                     CommandType == TEXT("list_bt_node_types") ||
-                     // BT Node Position Commands
-                     CommandType == TEXT("set_bt_node_position") ||
-                     CommandType == TEXT("auto_layout_bt") ||
-                     CommandType == TEXT("list_bt_nodes"))
-            {
-                ResultJson = AICommands->HandleCommand(CommandType, Params);
-            }
-            // AI Perception Commands (Phase H-1)
-            else if (CommandType == TEXT("add_ai_perception_component") ||
-                     CommandType == TEXT("configure_sight_sense") ||
-                     CommandType == TEXT("configure_hearing_sense") ||
-                     CommandType == TEXT("configure_damage_sense") ||
-                     CommandType == TEXT("set_perception_dominant_sense") ||
-                     CommandType == TEXT("add_perception_stimuli_source"))
-            {
-                ResultJson = AIPerceptionCommands->HandleCommand(CommandType, Params);
-            }
-            // EQS Commands (Phase H-2)
-            else if (CommandType == TEXT("create_eqs_query") ||
-                     CommandType == TEXT("add_eqs_generator") ||
-                     CommandType == TEXT("add_eqs_test") ||
-                     CommandType == TEXT("set_eqs_test_property") ||
-                     CommandType == TEXT("list_eqs_assets"))
+            TSharedPtr<FJsonObject> ResultJson = CommandType == TEXT("execute_batch")
+                ? HandleExecuteBatch(Params)
+                : RouteCommand(CommandType, Params);
+
+            // "compile_now": the caller needs up-to-date generated classes right after this command
+            bool bCompileNow = false;
+            if (Params.IsValid() && Params->TryGetBoolField(TEXT("compile_now"), bCompileNow) && bCompileNow)
             {
-                ResultJson = EQSCommands->HandleCommand(CommandType, Params);
+                FSpirrowBridgeCompileScheduler::Get().CompilePending();
             }
-            else
+            
+            if (!ResultJson.IsValid())
             {
                 ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
                 ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
@@ -579,4 +405,618 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
     });
     
     return Future.Get();
-}
\ No newline at end of file
+}
+
+// Route a command to its handler. Returns nullptr for unknown commands
+TSharedPtr<FJsonObject> USpirrowBridge::RouteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("ping"))
+    {
+        TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
+        ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+        return ResultJson;
+    }
+    // Editor Commands (including actor manipulation)
+    else if (CommandType == TEXT("get_actors_in_level") ||
+             CommandType == TEXT("find_actors_by_name") ||
+             CommandType == TEXT("spawn_actor") ||
+             CommandType == TEXT("create_actor") ||
+             CommandType == TEXT("delete_actor") ||
+             CommandType == TEXT("set_actor_transform") ||
+             CommandType == TEXT("get_actor_properties") ||
+             CommandType == TEXT("set_actor_property") ||
+             CommandType == TEXT("get_actor_components") ||
+             CommandType == TEXT("rename_actor") ||
+             CommandType == TEXT("rename_asset") ||
+             CommandType == TEXT("spawn_blueprint_actor") ||
+             CommandType == TEXT("focus_viewport") ||
+             CommandType == TEXT("take_screenshot"))
+    {
+        return EditorCommands->HandleCommand(CommandType, Params);
+    }
+    // Blueprint Commands
+    else if (CommandType == TEXT("create_blueprint") ||
+             CommandType == TEXT("add_component_to_blueprint") ||
+             CommandType == TEXT("set_component_property") ||
+             CommandType == TEXT("set_physics_properties") ||
+             CommandType == TEXT("compile_blueprint") ||
+             CommandType == TEXT("compile_blueprints_batch") ||
+             CommandType == TEXT("set_blueprint_property") ||
+             CommandType == TEXT("set_static_mesh_properties") ||
+             CommandType == TEXT("set_pawn_properties") ||
+             CommandType == TEXT("scan_project_classes") ||
+             CommandType == TEXT("search_blueprints") ||
+             CommandType == TEXT("duplicate_blueprint") ||
+             CommandType == TEXT("get_blueprint_graph") ||
+             CommandType == TEXT("set_blueprint_class_array") ||
+             CommandType == TEXT("set_struct_array_property") ||
+             // New property commands (v0.8.8)
+             CommandType == TEXT("create_data_asset") ||
+             CommandType == TEXT("set_class_property") ||
+             CommandType == TEXT("set_object_property") ||
+             CommandType == TEXT("get_blueprint_properties") ||
+             CommandType == TEXT("set_struct_property") ||
+             CommandType == TEXT("set_data_asset_property") ||
+             // Batch operations (v0.8.9)
+             CommandType == TEXT("batch_set_properties") ||
+             CommandType == TEXT("batch_set_properties_multi") ||
+             // Runtime performance
+             CommandType == TEXT("analyze_blueprint_performance") ||
+             CommandType == TEXT("set_tick_policy_batch"))
+    {
+        return BlueprintCommands->HandleCommand(CommandType, Params);
+    }
+    // Blueprint Node Commands
+    else if (CommandType == TEXT("connect_blueprint_nodes") || 
+             CommandType == TEXT("add_blueprint_get_self_component_reference") ||
+             CommandType == TEXT("add_blueprint_self_reference") ||
+             CommandType == TEXT("find_blueprint_nodes") ||
+             CommandType == TEXT("add_blueprint_event_node") ||
+             CommandType == TEXT("add_blueprint_input_action_node") ||
+             CommandType == TEXT("add_blueprint_function_node") ||
+             CommandType == TEXT("add_blueprint_get_component_node") ||
+             CommandType == TEXT("add_blueprint_variable") ||
+             // New node manipulation commands
+             CommandType == TEXT("set_node_pin_value") ||
+             CommandType == TEXT("add_variable_get_node") ||
+             CommandType == TEXT("add_variable_set_node") ||
+             CommandType == TEXT("add_branch_node") ||
+             CommandType == TEXT("delete_node") ||
+             CommandType == TEXT("move_node") ||
+             // Control flow nodes
+             CommandType == TEXT("add_sequence_node") ||
+             CommandType == TEXT("add_delay_node") ||
+             CommandType == TEXT("add_foreach_loop_node") ||
+             CommandType == TEXT("add_forloop_with_break_node") ||
+             // Debug & utility nodes
+             CommandType == TEXT("add_print_string_node") ||
+             // Math & comparison nodes
+             CommandType == TEXT("add_math_node") ||
+             CommandType == TEXT("add_comparison_node") ||
+             // Declarative graph patches and layout
+             CommandType == TEXT("apply_graph_patch") ||
+             CommandType == TEXT("auto_layout_blueprint_graph"))
+    {
+        return BlueprintNodeCommands->HandleCommand(CommandType, Params);
+    }
+    // Project Commands
+    else if (CommandType == TEXT("create_input_mapping") ||
+             CommandType == TEXT("create_input_action") ||
+             CommandType == TEXT("create_input_mapping_context") ||
+             CommandType == TEXT("add_action_to_mapping_context") ||
+             CommandType == TEXT("get_input_mapping_context") ||
+             CommandType == TEXT("get_input_action") ||
+             CommandType == TEXT("remove_action_from_mapping_context") ||
+             CommandType == TEXT("delete_asset") ||
+             CommandType == TEXT("add_mapping_context_to_blueprint") ||
+             CommandType == TEXT("set_default_mapping_context") ||
+             // Asset utility commands
+             CommandType == TEXT("asset_exists") ||
+             CommandType == TEXT("create_content_folder") ||
+             CommandType == TEXT("list_assets_in_folder") ||
+             CommandType == TEXT("import_texture") ||
+             CommandType == TEXT("get_project_info") ||
+             CommandType == TEXT("find_asset_references"))
+    {
+        return ProjectCommands->HandleCommand(CommandType, Params);
+    }
+    // UMG Widget Commands
+    else if (CommandType == TEXT("create_umg_widget_blueprint") ||
+             CommandType == TEXT("add_text_to_widget") ||
+             CommandType == TEXT("add_text_block_to_widget") ||
+             CommandType == TEXT("add_image_to_widget") ||
+             CommandType == TEXT("add_progressbar_to_widget") ||
+             CommandType == TEXT("add_button_to_widget") ||
+             CommandType == TEXT("add_slider_to_widget") ||
+             CommandType == TEXT("add_checkbox_to_widget") ||
+             CommandType == TEXT("add_combobox_to_widget") ||
+             CommandType == TEXT("add_editabletext_to_widget") ||
+             CommandType == TEXT("add_spinbox_to_widget") ||
+             CommandType == TEXT("add_scrollbox_to_widget") ||
+             CommandType == TEXT("add_widget_to_viewport"))
+    {
+        return UMGWidgetCommands->HandleCommand(CommandType, Params);
+    }
+    // UMG Layout Commands
+    else if (CommandType == TEXT("add_vertical_box_to_widget") ||
+             CommandType == TEXT("add_horizontal_box_to_widget") ||
+             CommandType == TEXT("get_widget_elements") ||
+             CommandType == TEXT("set_widget_slot_property") ||
+             CommandType == TEXT("set_widget_element_property") ||
+             CommandType == TEXT("reparent_widget_element") ||
+             CommandType == TEXT("remove_widget_element"))
+    {
+        return UMGLayoutCommands->HandleCommand(CommandType, Params);
+    }
+    // UMG Animation Commands
+    else if (CommandType == TEXT("create_widget_animation") ||
+             CommandType == TEXT("add_animation_track") ||
+             CommandType == TEXT("add_animation_keyframe") ||
+             CommandType == TEXT("get_widget_animations"))
+    {
+        return UMGAnimationCommands->HandleCommand(CommandType, Params);
+    }
+    // UMG Variable Commands
+    else if (CommandType == TEXT("add_widget_variable") ||
+             CommandType == TEXT("add_widget_array_variable") ||
+             CommandType == TEXT("set_widget_variable_default") ||
+             CommandType == TEXT("add_widget_function") ||
+             CommandType == TEXT("add_widget_event") ||
+             CommandType == TEXT("bind_widget_to_variable") ||
+             CommandType == TEXT("bind_widget_event") ||
+             CommandType == TEXT("set_text_block_binding") ||
+             CommandType == TEXT("bind_widget_component_event"))
+    {
+        return UMGVariableCommands->HandleCommand(CommandType, Params);
+    }
+    // Config Commands
+    else if (CommandType == TEXT("get_config_value") ||
+             CommandType == TEXT("set_config_value") ||
+             CommandType == TEXT("list_config_sections"))
+    {
+        return ConfigCommands->HandleCommand(CommandType, Params);
+    }
+    // DataTable Commands
+    else if (CommandType == TEXT("upsert_datatable_rows"))
+    {
+        return DataTableCommands->HandleCommand(CommandType, Params);
+    }
+    // GAS Commands
+    else if (CommandType == TEXT("add_gameplay_tags") ||
+             CommandType == TEXT("list_gameplay_tags") ||
+             CommandType == TEXT("remove_gameplay_tag") ||
+             CommandType == TEXT("list_gas_assets") ||
+             CommandType == TEXT("create_gameplay_effect") ||
+             CommandType == TEXT("create_gas_character") ||
+             CommandType == TEXT("set_ability_system_defaults") ||
+             CommandType == TEXT("create_gameplay_ability"))
+    {
+        return GASCommands->HandleCommand(CommandType, Params);
+    }
+    // Material Commands
+    else if (CommandType == TEXT("create_simple_material"))
+    {
+        return MaterialCommands->HandleCommand(CommandType, Params);
+    }
+    // AI Commands
+    else if (CommandType == TEXT("create_blackboard") ||
+             CommandType == TEXT("add_blackboard_key") ||
+             CommandType == TEXT("remove_blackboard_key") ||
+             CommandType == TEXT("list_blackboard_keys") ||
+             CommandType == TEXT("create_behavior_tree") ||
+             CommandType == TEXT("set_behavior_tree_blackboard") ||
+             CommandType == TEXT("get_behavior_tree_structure") ||
+             CommandType == TEXT("list_ai_assets") ||
+             // Phase G: BT Node Operations
+             CommandType == TEXT("add_bt_composite_node") ||
+             CommandType == TEXT("add_bt_task_node") ||
+             CommandType == TEXT("add_bt_decorator_node") ||
+             CommandType == TEXT("add_bt_service_node") ||
+             CommandType == TEXT("connect_bt_nodes") ||
+             CommandType == TEXT("set_bt_node_property") ||
+             CommandType == TEXT("delete_bt_node") ||
+             CommandType == TEXT("list_bt_node_types") ||
+             // BT Node Position Commands
+             CommandType == TEXT("set_bt_node_position") ||
+             CommandType == TEXT("auto_layout_bt") ||
+             CommandType == TEXT("list_bt_nodes"))
+    {
+        return AICommands->HandleCommand(CommandType, Params);
+    }
+    // AI Perception Commands (Phase H-1)
+    else if (CommandType == TEXT("add_ai_perception_component") ||
+             CommandType == TEXT("configure_sight_sense") ||
+             CommandType == TEXT("configure_hearing_sense") ||
+             CommandType == TEXT("configure_damage_sense") ||
+             CommandType == TEXT("set_perception_dominant_sense") ||
+             CommandType == TEXT("add_perception_stimuli_source"))
+    {
+        return AIPerceptionCommands->HandleCommand(CommandType, Params);
+    }
+    // EQS Commands (Phase H-2)
+    else if (CommandType == TEXT("create_eqs_query") ||
+             CommandType == TEXT("add_eqs_generator") ||
+             CommandType == TEXT("add_eqs_test") ||
+             CommandType == TEXT("set_eqs_test_property") ||
+             CommandType == TEXT("list_eqs_assets"))
+    {
+        return EQSCommands->HandleCommand(CommandType, Params);
+    }
+    // Level Commands (bulk actor operations)
+    else if (CommandType == TEXT("consolidate_to_instances") ||
+             CommandType == TEXT("update_actors_where") ||
+             CommandType == TEXT("get_properties_batch") ||
+             CommandType == TEXT("export_level_snapshot") ||
+             CommandType == TEXT("diff_level_snapshots") ||
+             CommandType == TEXT("load_world_partition_region") ||
+             CommandType == TEXT("unload_world_partition_region"))
+    {
+        return LevelCommands->HandleCommand(CommandType, Params);
+    }
+    // Save policy commands
+    else if (CommandType == TEXT("set_save_policy") ||
+             CommandType == TEXT("flush_saves") ||
+             CommandType == TEXT("save_packages") ||
+             CommandType == TEXT("get_save_status"))
+    {
+        return FSpirrowBridgeSaveManager::Get().HandleCommand(CommandType, Params);
+    }
+    // Compile queue commands
+    else if (CommandType == TEXT("set_compile_policy") ||
+             CommandType == TEXT("compile_pending") ||
+             CommandType == TEXT("get_compile_status"))
+    {
+        return FSpirrowBridgeCompileScheduler::Get().HandleCommand(CommandType, Params);
+    }
+    // Asset resolver cache and name index
+    else if (CommandType == TEXT("get_asset_cache_status") ||
+             CommandType == TEXT("find_assets_by_name"))
+    {
+        return FSpirrowBridgeAssetResolver::Get().HandleCommand(CommandType, Params);
+    }
+
+    return nullptr;
+}
+
+// ============================================
+// Batch execution
+// ============================================
+
+namespace
+{
+    bool IsBatchReference(const FString& Value)
+    {
+        return Value.Len() > 1 && Value[0] == TEXT('$') && FChar::IsDigit(Value[1]);
+    }
+
+    /** Resolve "$N.field.sub" (N = 0-based command index) against earlier batch results */
+    TSharedPtr<FJsonValue> LookupBatchReference(const FString& Reference, const TArray<TSharedPtr<FJsonObject>>& Results, FString& OutError)
+    {
+        TArray<FString> Segments;
+        Reference.RightChop(1).ParseIntoArray(Segments, TEXT("."));
+
+        const int32 Index = Segments.Num() > 0 && Segments[0].IsNumeric() ? FCString::Atoi(*Segments[0]) : INDEX_NONE;
+        if (!Results.IsValidIndex(Index))
+        {
+            OutError = FString::Printf(TEXT("Reference %s points to a command that has not run yet"), *Reference);
+            return nullptr;
+        }
+        if (!Results[Index].IsValid())
+        {
+            OutError = FString::Printf(TEXT("Reference %s points to failed command %d"), *Reference, Index);
+            return nullptr;
+        }
+
+        TSharedPtr<FJsonValue> Current = MakeShared<FJsonValueObject>(Results[Index]);
+        for (int32 SegmentIndex = 1; SegmentIndex < Segments.Num() && Current.IsValid(); ++SegmentIndex)
+        {
+            const FString& Segment = Segments[SegmentIndex];
+            if (Current->Type == EJson::Object)
+            {
+                Current = Current->AsObject()->TryGetField(Segment);
+            }
+            else if (Current->Type == EJson::Array && Segment.IsNumeric())
+            {
+                const TArray<TSharedPtr<FJsonValue>>& Array = Current->AsArray();
+                const int32 ArrayIndex = FCString::Atoi(*Segment);
+                Current = Array.IsValidIndex(ArrayIndex) ? Array[ArrayIndex] : nullptr;
+            }
+            else
+            {
+                Current = nullptr;
+            }
+
+            if (!Current.IsValid())
+            {
+                OutError = FString::Printf(TEXT("Reference %s: field '%s' not found"), *Reference, *Segment);
+            }
+        }
+        return Current;
+    }
+
+    /** Copy Value, replacing every string that is exactly a "$N..." reference with the referenced JSON value */
+    TSharedPtr<FJsonValue> ResolveBatchReferences(const TSharedPtr<FJsonValue>& Value, const TArray<TSharedPtr<FJsonObject>>& Results, FString& OutError)
+    {
+        switch (Value->Type)
+        {
+        case EJson::String:
+            return IsBatchReference(Value->AsString()) ? LookupBatchReference(Value->AsString(), Results, OutError) : Value;
+
+        case EJson::Object:
+        {
+            TSharedPtr<FJsonObject> Resolved = MakeShared<FJsonObject>();
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Value->AsObject()->Values)
+            {
+                TSharedPtr<FJsonValue> Field = ResolveBatchReferences(Pair.Value, Results, OutError);
+                if (!Field.IsValid())
+                {
+                    return nullptr;
+                }
+                Resolved->SetField(Pair.Key, Field);
+            }
+            return MakeShared<FJsonValueObject>(Resolved);
+        }
+
+        case EJson::Array:
+        {
+            TArray<TSharedPtr<FJsonValue>> Resolved;
+            for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+            {
+                TSharedPtr<FJsonValue> ResolvedElement = ResolveBatchReferences(Element, Results, OutError);
+                if (!ResolvedElement.IsValid())
+                {
+                    return nullptr;
+                }
+                Resolved.Add(ResolvedElement);
+            }
+            return MakeShared<FJsonValueArray>(Resolved);
+        }
+
+        default:
+            return Value;
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> USpirrowBridge::HandleExecuteBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    const TArray<TSharedPtr<FJsonValue>>* Commands = nullptr;
+    if (!Params.IsValid() || !Params->TryGetArrayField(TEXT("commands"), Commands))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("Missing 'commands' array"));
+    }
+
+    bool bStopOnError, bRollbackOnError, bCompile, bSave, bIncludeResults;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("stop_on_error"), bStopOnError, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("rollback_on_error"), bRollbackOnError, false);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("compile"), bCompile, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("save"), bSave, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_results"), bIncludeResults, true);
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Commands only queue compiles and mark their packages dirty; the batch compiles and writes each asset once at the end
+    FSpirrowBridgeSaveManager& SaveManager = FSpirrowBridgeSaveManager::Get();
+    FSpirrowBridgeCompileScheduler& CompileScheduler = FSpirrowBridgeCompileScheduler::Get();
+    const FSpirrowBridgeSaveManager::FScopedDeferral SaveDeferral;
+    const FSpirrowBridgeCompileScheduler::FScopedDeferral CompileDeferral;
+
+    // Every Modify() inside the batch reports its package so compile and save run once at the end
+    TSet<TWeakObjectPtr<UPackage>> TouchedPackages;
+    const FDelegateHandle ModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddLambda(
+        [&TouchedPackages](UObject* Object)
+        {
+            if (Object)
+            {
+                TouchedPackages.Add(Object->GetPackage());
+            }
+        });
+
+    // Undo cannot bring back asset files that were created, deleted, renamed or written during the batch.
+    // Those steps are recorded so a rollback can name what it did not revert.
+    int32 CurrentIndex = INDEX_NONE;
+    FString CurrentCommand;
+    TArray<TSharedPtr<FJsonValue>> IrreversibleArray;
+    auto RecordIrreversible = [&CurrentIndex, &CurrentCommand, &IrreversibleArray](const TCHAR* Reason, const FString& AssetPath)
+    {
+        TSharedPtr<FJsonObject> StepObj = MakeShared<FJsonObject>();
+        StepObj->SetNumberField(TEXT("index"), CurrentIndex);
+        StepObj->SetStringField(TEXT("command"), CurrentCommand);
+        StepObj->SetStringField(TEXT("reason"), Reason);
+        StepObj->SetStringField(TEXT("asset"), AssetPath);
+        IrreversibleArray.Add(MakeShared<FJsonValueObject>(StepObj));
+    };
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    const FDelegateHandle AssetAddedHandle = AssetRegistry.OnAssetAdded().AddLambda(
+        [&RecordIrreversible](const FAssetData& AssetData) { RecordIrreversible(TEXT("asset created"), AssetData.GetObjectPathString()); });
+    const FDelegateHandle AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddLambda(
+        [&RecordIrreversible](const FAssetData& AssetData) { RecordIrreversible(TEXT("asset deleted"), AssetData.GetObjectPathString()); });
+    const FDelegateHandle AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddLambda(
+        [&RecordIrreversible](const FAssetData& AssetData, const FString& OldObjectPath) { RecordIrreversible(TEXT("asset renamed"), OldObjectPath); });
+    const FDelegateHandle PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddLambda(
+        [&RecordIrreversible](const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+        {
+            RecordIrreversible(TEXT("package saved"), Package ? Package->GetName() : PackageFileName);
+        });
+
+    TArray<TSharedPtr<FJsonObject>> Results;
+    TArray<TSharedPtr<FJsonValue>> ResultArray;
+    int32 SucceededCount = 0;
+    int32 FailedCount = 0;
+    bool bAborted = false;
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("SpirrowBridge", "ExecuteBatch", "SpirrowBridge Batch"));
+
+        for (int32 Index = 0; Index < Commands->Num(); ++Index)
+        {
+            TSharedPtr<FJsonObject> CommandResult;
+            FString CommandType;
+            FString ErrorMessage;
+            int32 ErrorCode = ESpirrowErrorCode::InvalidParamValue;
+
+            const TSharedPtr<FJsonObject>* CommandObj = nullptr;
+            const bool bHasCommand = (*Commands)[Index]->TryGetObject(CommandObj) && (*CommandObj)->TryGetStringField(TEXT("command"), CommandType);
+            CurrentIndex = Index;
+            CurrentCommand = CommandType;
+            if (!bHasCommand)
+            {
+                ErrorMessage = TEXT("Batch entry needs a 'command' field");
+            }
+            else if (CommandType == TEXT("execute_batch") || CommandType == TEXT("import_texture"))
+            {
+                // import_texture must run from the ticker, see ExecuteCommand
+                ErrorMessage = FString::Printf(TEXT("'%s' cannot run inside execute_batch"), *CommandType);
+            }
+            else
+            {
+                TSharedPtr<FJsonObject> CommandParams = MakeShared<FJsonObject>();
+                const TSharedPtr<FJsonObject>* ParamsObj = nullptr;
+                if ((*CommandObj)->TryGetObjectField(TEXT("params"), ParamsObj))
+                {
+                    TSharedPtr<FJsonValue> Resolved = ResolveBatchReferences(MakeShared<FJsonValueObject>(*ParamsObj), Results, ErrorMessage);
+                    CommandParams = Resolved.IsValid() ? Resolved->AsObject() : nullptr;
+                }
+
+                if (CommandParams.IsValid())
+                {
+                    CommandResult = RouteCommand(CommandType, CommandParams);
+
+                    bool bCompileNow = false;
+                    if (CommandParams->TryGetBoolField(TEXT("compile_now"), bCompileNow) && bCompileNow)
+                    {
+                        CompileScheduler.CompilePending();
+                    }
+
+                    if (!CommandResult.IsValid())
+                    {
+                        ErrorCode = ESpirrowErrorCode::UnknownCommand;
+                        ErrorMessage = FString::Printf(TEXT("Unknown command: %s"), *CommandType);
+                    }
+                    else if (CommandResult->HasField(TEXT("success")) && !CommandResult->GetBoolField(TEXT("success")))
+                    {
+                        CommandResult->TryGetStringField(TEXT("error"), ErrorMessage);
+                        CommandResult->TryGetNumberField(TEXT("error_code"), ErrorCode);
+                        CommandResult.Reset();
+                    }
+                }
+            }
+
+            const bool bSucceeded = CommandResult.IsValid();
+            Results.Add(CommandResult);
+
+            TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+            EntryObj->SetNumberField(TEXT("index"), Index);
+            EntryObj->SetStringField(TEXT("command"), CommandType);
+            EntryObj->SetBoolField(TEXT("success"), bSucceeded);
+            if (bSucceeded)
+            {
+                ++SucceededCount;
+                if (bIncludeResults)
+                {
+                    EntryObj->SetObjectField(TEXT("result"), CommandResult);
+                }
+            }
+            else
+            {
+                ++FailedCount;
+                EntryObj->SetStringField(TEXT("error"), ErrorMessage.IsEmpty() ? TEXT("Unknown error") : ErrorMessage);
+                EntryObj->SetNumberField(TEXT("error_code"), ErrorCode);
+            }
+            ResultArray.Add(MakeShared<FJsonValueObject>(EntryObj));
+
+            if (!bSucceeded && bStopOnError)
+            {
+                bAborted = Index + 1 < Commands->Num();
+                break;
+            }
+        }
+    }
+
+    FCoreUObjectDelegates::OnObjectModified.Remove(ModifiedHandle);
+    AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+    AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+    AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+    // Undo the whole batch transaction. Deferred saves have not run yet, so they store the reverted state;
+    // the irreversible steps recorded above stay as they are
+    const bool bRolledBack = bRollbackOnError && FailedCount > 0 && GEditor && GEditor->UndoTransaction(false);
+
+    TArray<TSharedPtr<FJsonValue>> CompiledArray;
+    TArray<TSharedPtr<FJsonValue>> SavedArray;
+    TArray<TSharedPtr<FJsonValue>> SaveFailedArray;
+    if (!bRolledBack)
+    {
+        for (const TWeakObjectPtr<UPackage>& PackagePtr : TouchedPackages)
+        {
+            UPackage* Package = PackagePtr.Get();
+            if (!Package || Package == GetTransientPackage())
+            {
+                continue;
+            }
+
+            if (bCompile)
+            {
+                UBlueprint* Blueprint = Cast<UBlueprint>(Package->FindAssetInPackage());
+                if (Blueprint && Blueprint->Status != BS_UpToDate)
+                {
+                    CompileScheduler.RequestCompile(Blueprint);
+                }
+            }
+
+            // Maps are left to the user, only assets are saved
+            if (bSave && Package->IsDirty() && !Package->ContainsMap())
+            {
+                SaveManager.MarkPending(Package);
+            }
+        }
+    }
+
+    // Compile before saving so the written assets carry the new generated classes
+    TArray<TSharedPtr<FJsonValue>> CompileFailedArray;
+    if (bCompile && !bRolledBack)
+    {
+        TArray<FSpirrowBlueprintCompileResult> CompileResults;
+        CompileScheduler.CompilePending(&CompileResults);
+        for (const FSpirrowBlueprintCompileResult& CompileResult : CompileResults)
+        {
+            (CompileResult.bSuccess ? CompiledArray : CompileFailedArray).Add(MakeShared<FJsonValueString>(CompileResult.BlueprintPath));
+        }
+    }
+
+    // Deferred and manual policies keep the packages in the dirty set for the next flush
+    if (SaveManager.GetPolicy() == ESpirrowSavePolicy::Immediate)
+    {
+        TArray<FSpirrowPackageSaveResult> SaveResults;
+        SaveManager.Flush(true, &SaveResults);
+        for (const FSpirrowPackageSaveResult& SaveResult : SaveResults)
+        {
+            (SaveResult.bSuccess ? SavedArray : SaveFailedArray).Add(MakeShared<FJsonValueString>(SaveResult.PackageName));
+        }
+    }
+
+    // Always report success at the top level so the per-command results reach the client
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetNumberField(TEXT("total"), Commands->Num());
+    ResultObj->SetNumberField(TEXT("succeeded"), SucceededCount);
+    ResultObj->SetNumberField(TEXT("failed"), FailedCount);
+    ResultObj->SetNumberField(TEXT("skipped"), Commands->Num() - Results.Num());
+    ResultObj->SetBoolField(TEXT("aborted"), bAborted);
+    ResultObj->SetBoolField(TEXT("rolled_back"), bRolledBack);
+    if (bRolledBack)
+    {
+        // Non-empty: the rollback was partial, these steps were not reverted
+        ResultObj->SetArrayField(TEXT("irreversible"), IrreversibleArray);
+    }
+    ResultObj->SetArrayField(TEXT("results"), ResultArray);
+    ResultObj->SetArrayField(TEXT("compiled"), CompiledArray);
+    ResultObj->SetArrayField(TEXT("compile_failed"), CompileFailedArray);
+    ResultObj->SetArrayField(TEXT("saved"), SavedArray);
+    ResultObj->SetArrayField(TEXT("save_failed"), SaveFailedArray);
+    ResultObj->SetNumberField(TEXT("pending_saves"), SaveManager.GetPendingCount());
+    ResultObj->SetNumberField(TEXT("elapsed_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return ResultObj;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+struct FAssetData;
+
+/** Result of looking an asset up by short name in the name index */
+enum class ESpirrowAssetLookup : uint8
+{
+    Found,
+    NotFound,
+    /** Several assets of the requested class share the name; see the candidates */
+    Ambiguous
+};
+
+/**
+ * Bridge-wide cache of assets resolved by (name, path, class).
+ * A hit costs a hash lookup and a weak pointer check instead of building the object path and
+ * going through the loader. Entries are dropped when the asset registry reports the asset
+ * renamed or removed, and a garbage collected asset simply misses. Misses are not cached,
+ * so assets created later are found; adding an asset also drops the entries looked up by its
+ * name, since the new asset may be the better match. Game thread only.
+ *
+ * Behind the cache sits a name index over the asset registry (short name -> object paths and
+ * classes under /Game), built on first use and kept current from registry add/remove/rename
+ * events. When an asset is not at the given path, a unique match by name and class is used.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeAssetResolver
+{
+public:
+    static FSpirrowBridgeAssetResolver& Get();
+
+    /** Subscribe to asset registry add/remove/rename events. Called when the bridge subsystem starts */
+    void Startup();
+
+    /** Unsubscribe and drop every entry */
+    void Shutdown();
+
+    /**
+     * Find or load the asset <Path>/<Name>.<Name> of the given class. When it is not there
+     * (or Path is empty) the name index is consulted and a single match of the class is loaded.
+     * Such a match is cached until another asset of that name is added, which may take the
+     * requested path or make the name ambiguous.
+     * @return nullptr when the asset does not exist, is not a Class, or the name is ambiguous
+     */
+    UObject* Resolve(const FString& Name, const FString& Path, UClass* Class);
+
+    template<typename T>
+    T* Resolve(const FString& Name, const FString& Path)
+    {
+        return static_cast<T*>(Resolve(Name, Path, T::StaticClass()));
+    }
+
+    /** Look a short asset name up in the name index. Class filters with IsChildOf; nullptr matches any class */
+    ESpirrowAssetLookup FindByName(const FString& Name, UClass* Class, TArray<FSoftObjectPath>& OutObjectPaths);
+
+    /**
+     * Not-found error for a failed Resolve: AssetAmbiguous with the candidate paths when the
+     * name index has several matches, otherwise NotFoundCode with Message
+     */
+    TSharedPtr<FJsonObject> MakeResolveError(const FString& Name, const FString& Path, UClass* Class,
+        int32 NotFoundCode, const FString& Message);
+
+    /** Drop every entry that resolved to this object path */
+    void Invalidate(const FString& ObjectPath);
+
+    /** Drop every entry looked up by this short name, whatever it resolved to */
+    void InvalidateName(const FString& Name);
+
+    void Clear();
+
+    // Handle asset lookup commands: get_asset_cache_status, find_assets_by_name
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+private:
+    FSpirrowBridgeAssetResolver() = default;
+
+    struct FKey
+    {
+        FString Name;
+        FString Path;
+        const UClass* Class = nullptr;
+
+        bool operator==(const FKey& Other) const
+        {
+            return Class == Other.Class && Name == Other.Name && Path == Other.Path;
+        }
+
+        friend uint32 GetTypeHash(const FKey& Key)
+        {
+            return HashCombine(HashCombine(GetTypeHash(Key.Name), GetTypeHash(Key.Path)), PointerHash(Key.Class));
+        }
+    };
+
+    struct FEntry
+    {
+        TWeakObjectPtr<UObject> Object;
+        FString ObjectPath;
+    };
+
+    struct FIndexedAsset
+    {
+        FSoftObjectPath ObjectPath;
+        FTopLevelAssetPath ClassPath;
+    };
+
+    void EnsureNameIndex();
+    void AddToNameIndex(const FAssetData& AssetData);
+    void RemoveFromNameIndex(FName AssetName, const FSoftObjectPath& ObjectPath);
+    static bool ClassMatches(const FTopLevelAssetPath& ClassPath, UClass* Class);
+
+    void OnAssetAdded(const FAssetData& AssetData);
+    void OnAssetRemoved(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TMap<FKey, FEntry> Entries;
+    int32 Hits = 0;
+    int32 Misses = 0;
+    int32 Invalidations = 0;
+
+    /** Short asset name -> assets with that name. Most names map to a single entry */
+    TMap<FName, TArray<FIndexedAsset, TInlineAllocator<1>>> NameIndex;
+    bool bNameIndexBuilt = false;
+    int32 IndexLookups = 0;
+
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
@@ -7,6 +7,7 @@
 class FSpirrowBridgeBlueprintCoreCommands;
 class FSpirrowBridgeBlueprintComponentCommands;
 class FSpirrowBridgeBlueprintPropertyCommands;
+class FSpirrowBridgeBlueprintPerformanceCommands;
 
 /**
  * Handler class for Blueprint-related MCP commands
@@ -26,4 +27,5 @@ private:
     TSharedPtr<FSpirrowBridgeBlueprintCoreCommands> CoreCommands;
     TSharedPtr<FSpirrowBridgeBlueprintComponentCommands> ComponentCommands;
     TSharedPtr<FSpirrowBridgeBlueprintPropertyCommands> PropertyCommands;
+    TSharedPtr<FSpirrowBridgeBlueprintPerformanceCommands> PerformanceCommands;
 };
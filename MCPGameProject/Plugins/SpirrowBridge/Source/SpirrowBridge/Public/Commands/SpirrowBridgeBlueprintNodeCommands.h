@@ -7,6 +7,7 @@
 class FSpirrowBridgeBlueprintNodeCoreCommands;
 class FSpirrowBridgeBlueprintNodeVariableCommands;
 class FSpirrowBridgeBlueprintNodeControlFlowCommands;
+class FSpirrowBridgeBlueprintNodeGraphCommands;
 
 /**
  * Handler class for Blueprint Node-related MCP commands
@@ -26,4 +27,5 @@ private:
     TSharedPtr<FSpirrowBridgeBlueprintNodeCoreCommands> CoreCommands;
     TSharedPtr<FSpirrowBridgeBlueprintNodeVariableCommands> VariableCommands;
     TSharedPtr<FSpirrowBridgeBlueprintNodeControlFlowCommands> ControlFlowCommands;
+    TSharedPtr<FSpirrowBridgeBlueprintNodeGraphCommands> GraphCommands;
 };
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UBlueprint;
+class UEdGraph;
+
+/**
+ * Handler class for whole-graph Blueprint node commands (declarative graph patches, auto layout)
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeBlueprintNodeGraphCommands
+{
+public:
+    FSpirrowBridgeBlueprintNodeGraphCommands();
+
+    // Handle blueprint node graph commands
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+private:
+    // Graph patch
+    TSharedPtr<FJsonObject> HandleApplyGraphPatch(const TSharedPtr<FJsonObject>& Params);
+
+    // Layered layout by exec flow; "node_ids" limits it to those nodes and leaves the rest in place
+    TSharedPtr<FJsonObject> HandleAutoLayoutBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
+
+    // Find a graph by name among ubergraph pages, functions and macros; empty name is the event graph
+    static UEdGraph* FindGraph(UBlueprint* Blueprint, const FString& GraphName);
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UBlueprint;
+
+/**
+ * Handler class for Blueprint runtime performance commands (tick usage analysis and tick policy)
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeBlueprintPerformanceCommands
+{
+public:
+    FSpirrowBridgeBlueprintPerformanceCommands();
+
+    // Handle blueprint performance commands
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+private:
+    /**
+     * Flag expensive runtime patterns (Event Tick, GetAllActorsOfClass / casts in tick or loops,
+     * ticking components that never tick) and estimate per-tick node counts
+     * @param Params - Blueprint selection (see CollectBlueprints), "min_severity" (info/warning/error),
+     *                 "include_clean" (default false), "parallel" (default true)
+     */
+    TSharedPtr<FJsonObject> HandleAnalyzeBlueprintPerformance(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Apply tick settings to the actor CDOs and SCS component templates of many Blueprints in one pass
+     * @param Params - Blueprint selection (see CollectBlueprints), "actor" / "components" settings objects
+     *                 ("enabled", "start_enabled", "interval", "tick_group"; components also take
+     *                 "component_class" and "only_unused"), "dry_run", "compile" (default true)
+     * @return Per-Blueprint changes and before/after counts of ticking actors and components
+     */
+    TSharedPtr<FJsonObject> HandleSetTickPolicyBatch(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Load the Blueprints selected by "blueprint_name" (+ "path"), "blueprints" (names or object paths)
+     * and/or "folder" (+ "recursive"); "parent_class" narrows the folder query using registry tags
+     * @return Error response when nothing is selected or a single named Blueprint is missing
+     */
+    static TSharedPtr<FJsonObject> CollectBlueprints(const TSharedPtr<FJsonObject>& Params, TArray<UBlueprint*>& OutBlueprints,
+        TArray<TSharedPtr<FJsonValue>>& OutNotFound);
+};
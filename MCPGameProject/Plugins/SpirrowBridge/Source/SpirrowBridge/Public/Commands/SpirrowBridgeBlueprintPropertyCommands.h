@@ -17,6 +17,14 @@ public:
 private:
     // Property and scanning
     TSharedPtr<FJsonObject> HandleScanProjectClasses(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Token search over Find-in-Blueprints metadata without loading Blueprints
+     * @param Params - "query" (terms ANDed, "name*" for prefixes), "path", "offset", "limit" (default 50),
+     *                 "wait" (default true: finish a running index build first), "rebuild"
+     */
+    TSharedPtr<FJsonObject> HandleSearchBlueprints(const TSharedPtr<FJsonObject>& Params);
+
     TSharedPtr<FJsonObject> HandleSetBlueprintClassArray(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetStructArrayProperty(const TSharedPtr<FJsonObject>& Params);
 
@@ -31,6 +39,35 @@ private:
     // Batch operations (v0.8.9)
     TSharedPtr<FJsonObject> HandleBatchSetProperties(const TSharedPtr<FJsonObject>& Params);
 
+    /**
+     * Apply one property map to many Blueprint CDOs / data assets, compiling and saving once
+     * @param Params - "properties", "assets" (object paths or unique names) and/or a query:
+     *                 "folder", "recursive", "class_name" (asset class), "parent_class";
+     *                 "compile" (default true), "dry_run" (default false)
+     */
+    TSharedPtr<FJsonObject> HandleBatchSetPropertiesMulti(const TSharedPtr<FJsonObject>& Params);
+
     // Helper function for property type names
     static FString GetPropertyTypeName(FProperty* Property);
+
+    /** Filtered scan_project_classes result, valid while the class index generation is unchanged */
+    struct FScanResult
+    {
+        uint32 Generation = 0;
+        /** Bumped on every hit, used to evict the least recently used filter */
+        uint64 LastUse = 0;
+        TArray<TSharedPtr<FJsonValue>> CppClasses;
+        TArray<TSharedPtr<FJsonValue>> Blueprints;
+    };
+
+    /** Distinct filter combinations kept at once; each holds a full JSON result */
+    static constexpr int32 MaxScanResults = 16;
+
+    /**
+     * Keyed by the filter parameters; pagination slices the cached arrays. Emptied when the class
+     * index generation changes, and least recently used filters are evicted past MaxScanResults.
+     */
+    TMap<FString, FScanResult> ScanResultCache;
+    uint32 ScanResultGeneration = 0;
+    uint64 ScanResultUseCounter = 0;
 };
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+
+struct FAssetData;
+
+/** One search_blueprints hit */
+struct FSpirrowBlueprintSearchHit
+{
+    FString AssetName;
+    FString ObjectPath;
+    FString ParentName;
+    /** Indexed tokens that satisfied the query terms */
+    TArray<FString> MatchedTokens;
+};
+
+struct FSpirrowBlueprintSearchResult
+{
+    /** The requested page, ordered by object path */
+    TArray<FSpirrowBlueprintSearchHit> Hits;
+    int32 Total = 0;
+    /** A build is still running; results come from the previous index (or none) */
+    bool bIndexing = false;
+    int32 IndexedCount = 0;
+    /** Blueprints without Find-in-Blueprints data (never saved by this engine version); only names are indexed */
+    int32 WithoutSearchDataCount = 0;
+};
+
+/**
+ * Token index over the Find-in-Blueprints metadata the editor stores in each Blueprint's asset
+ * registry tags (FiBData), so "which Blueprints call X / use variable Y / contain node Z" is
+ * answered without loading a single Blueprint. Every token of the decoded metadata (function,
+ * variable, pin and node names, node titles split into words) plus the asset name is lowercased
+ * into an inverted index; queries are ANDed terms, each exact or a "prefix*".
+ * The full build reads tags on a worker thread once the asset registry has finished scanning;
+ * saved, added, removed and renamed Blueprints are re-indexed in place from registry events.
+ * Queries and updates run on the game thread.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeBlueprintSearchIndex
+{
+public:
+    static FSpirrowBridgeBlueprintSearchIndex& Get();
+
+    /** Subscribe to asset registry events and start the background build. Called when the bridge subsystem starts */
+    void Startup();
+
+    /** Unsubscribe, wait for a running build and drop the index */
+    void Shutdown();
+
+    /**
+     * Run a query. Terms are whitespace separated and all must match; "name*" matches by prefix.
+     * @param PathFilter Only Blueprints under this content path; empty for all
+     * @param bWait Block until a running build finishes instead of answering from the previous index
+     * @return false when the query has no searchable terms
+     */
+    bool Search(const FString& Query, const FString& PathFilter, int32 Offset, int32 Limit, bool bWait,
+        FSpirrowBlueprintSearchResult& OutResult);
+
+    /** Discard the index and rebuild it in the background */
+    void Rebuild();
+
+private:
+    FSpirrowBridgeBlueprintSearchIndex() = default;
+
+    struct FDocument
+    {
+        FString ObjectPath;
+        FString AssetName;
+        FString PackagePath;
+        FString ParentName;
+        /** Sorted, unique, lowercase */
+        TArray<FString> Tokens;
+        bool bHasSearchData = false;
+        bool bLive = false;
+    };
+
+    struct FIndexData
+    {
+        TArray<FDocument> Documents;
+        TMap<FString, int32> DocumentByPath;
+        TMap<FString, TArray<int32>> Postings;
+        /** Postings keys in order, for prefix ranges; rebuilt when tokens come or go */
+        TArray<FString> SortedTokens;
+        bool bSortedTokensDirty = true;
+        TArray<int32> FreeSlots;
+    };
+
+    /** Worker thread: build a complete index from a registry snapshot */
+    static TSharedPtr<FIndexData> BuildIndex(const TArray<FAssetData>& Assets);
+    static void MakeDocument(const FAssetData& AssetData, FDocument& OutDocument);
+    static void AddDocument(FIndexData& Data, FDocument&& Document);
+    static void RemoveDocument(FIndexData& Data, const FString& ObjectPath);
+    static bool IsBlueprintAsset(const FAssetData& AssetData);
+
+    void StartBuild();
+    /** Take a finished build (or wait for it) and replay updates that arrived meanwhile */
+    void AdoptBuild(bool bWait);
+    void QueueUpdate(const FString& ObjectPath);
+    void ApplyUpdate(const FString& ObjectPath);
+
+    void OnFilesLoaded();
+    void OnAssetAddedOrUpdated(const FAssetData& AssetData);
+    void OnAssetRemoved(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TSharedPtr<FIndexData> Index;
+    TFuture<TSharedPtr<FIndexData>> PendingBuild;
+    /** Object paths changed while a build was running */
+    TSet<FString> PendingUpdates;
+
+    FDelegateHandle FilesLoadedHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle AssetUpdatedHandle;
+};
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+struct FAssetData;
+
+/** Actor class as listed by scan_project_classes, computed once per index generation */
+struct FSpirrowActorClassRecord
+{
+    TWeakObjectPtr<UClass> Class;
+    FString Name;
+    FString Path;
+    FString ParentName;
+    /** Script module ("Engine" for /Script/Engine.Actor), None outside /Script */
+    FName Module;
+    /** Superclass names, nearest first */
+    TArray<FName> AncestorNames;
+    bool bEngineModule = false;
+    bool bReinstanced = false;
+    bool bGeneratedClass = false;
+};
+
+/** Blueprint asset as listed by scan_project_classes, read from asset registry tags without loading */
+struct FSpirrowBlueprintClassRecord
+{
+    FName AssetName;
+    FString ObjectPath;
+    FString PackagePath;
+    FString ParentName;
+    FTopLevelAssetPath GeneratedClassPath;
+    FTopLevelAssetPath ParentClassPath;
+    FTopLevelAssetPath NativeParentClassPath;
+    /** Parent class names through Blueprint parents and then the native chain, nearest first */
+    TArray<FName> AncestorNames;
+    /** The same chain as class paths, for exact ancestry checks (names collide across modules) */
+    TArray<FTopLevelAssetPath> AncestorPaths;
+};
+
+/**
+ * Bridge-wide class lookup by name, replacing TObjectIterator<UClass> scans in command handlers.
+ * Native classes are indexed under their name with and without the C++ prefix ("Actor" and
+ * "AActor"); Blueprint classes are indexed from asset registry tags under the asset name and
+ * the generated class name ("BP_Enemy" and "BP_Enemy_C") and loaded only when returned.
+ * Both halves are built lazily and rebuilt after module loads, hot reload or Blueprint asset
+ * removal/rename; added Blueprints are appended in place. The same events bump a generation
+ * counter that scan_project_classes uses to key its actor/Blueprint records and results.
+ * Game thread only.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeClassIndex
+{
+public:
+    static FSpirrowBridgeClassIndex& Get();
+
+    /** Subscribe to module, reload and asset registry events. Called when the bridge subsystem starts */
+    void Startup();
+
+    /** Unsubscribe and drop the index */
+    void Shutdown();
+
+    /**
+     * Find a class by short name, with or without prefix, or by Blueprint asset / _C name.
+     * @param BaseClass Only classes derived from it match; nullptr matches any class
+     * @param bIncludeBlueprints Also match (and load) Blueprint generated classes
+     */
+    UClass* FindClass(const FString& ClassName, UClass* BaseClass = nullptr, bool bIncludeBlueprints = true);
+
+    /** Drop both halves; they are rebuilt on the next lookup */
+    void Invalidate();
+
+    /** Changes whenever native classes or Blueprint assets may have changed; keys derived caches */
+    uint32 GetGeneration() const { return Generation; }
+
+    /** AActor and every loaded class derived from it */
+    const TArray<FSpirrowActorClassRecord>& GetActorClassRecords();
+
+    /** Every Blueprint asset known to the asset registry */
+    const TArray<FSpirrowBlueprintClassRecord>& GetBlueprintClassRecords();
+
+private:
+    FSpirrowBridgeClassIndex() = default;
+
+    struct FBlueprintClassEntry
+    {
+        FSoftClassPath GeneratedClassPath;
+        FTopLevelAssetPath NativeParentClassPath;
+    };
+
+    void MarkNativeDirty();
+    void MarkBlueprintsDirty();
+    void EnsureNativeIndex();
+    void EnsureBlueprintIndex();
+    void AddBlueprintEntry(const FAssetData& AssetData);
+    static UClass* LoadBlueprintClass(const FBlueprintClassEntry& Entry, UClass* BaseClass);
+
+    void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void OnReloadComplete(EReloadCompleteReason Reason);
+    void OnBlueprintAssetAdded(const FAssetData& AssetData);
+    void OnBlueprintAssetChanged(const FAssetData& AssetData);
+    void OnBlueprintAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    void OnBlueprintAssetUpdated(const FAssetData& AssetData);
+
+    TMap<FName, TArray<TWeakObjectPtr<UClass>, TInlineAllocator<1>>> NativeClasses;
+    TMap<FName, TArray<FBlueprintClassEntry, TInlineAllocator<1>>> BlueprintClasses;
+    bool bNativeIndexDirty = true;
+    bool bBlueprintIndexDirty = true;
+
+    TArray<FSpirrowActorClassRecord> ActorClassRecords;
+    TArray<FSpirrowBlueprintClassRecord> BlueprintClassRecords;
+    bool bActorRecordsDirty = true;
+    bool bBlueprintRecordsDirty = true;
+    uint32 Generation = 1;
+
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle AssetUpdatedHandle;
+};
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Json.h"
+#include "Commands/SpirrowBridgePropertyPathCache.h"
 
 // Forward declarations
 class AActor;
@@ -17,6 +18,7 @@ class UK2Node_InputAction;
 class UK2Node_Self;
 class UFunction;
 class UWidgetBlueprint;
+class FWorldPartitionActorDescInstance;
 
 /**
  * Error codes for SpirrowBridge operations
@@ -42,6 +44,7 @@ namespace ESpirrowErrorCode
     constexpr int32 AssetCreationFailed = 1103;
     constexpr int32 AssetDeleteFailed = 1104;
     constexpr int32 InvalidAssetPath = 1105;
+    constexpr int32 AssetAmbiguous = 1106;
 
     // Blueprint errors (1200-1299)
     constexpr int32 BlueprintNotFound = 1200;
@@ -191,6 +194,9 @@ public:
     // ============================================
     static TSharedPtr<FJsonValue> ActorToJson(AActor* Actor);
     static TSharedPtr<FJsonObject> ActorToJsonObject(AActor* Actor, bool bDetailed = false);
+
+    /** Serialize a World Partition actor descriptor (works for unloaded actors) */
+    static TSharedPtr<FJsonValue> ActorDescToJson(const FWorldPartitionActorDescInstance* ActorDesc);
     
     // ============================================
     // Blueprint utilities
@@ -216,8 +222,12 @@ public:
     // ============================================
     // Property utilities
     // ============================================
+    /** Set a property by name or nested struct path ("Brush.TintColor"); paths are resolved once per class */
     static bool SetObjectProperty(UObject* Object, const FString& PropertyName, 
                                  const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
+
+    /** Typed setter for a property; types without one fall back to ImportText */
+    static FSpirrowPropertySetter GetPropertySetter(FProperty* Property);
     
     /** Set a struct property value from JSON (internal helper) */
     static bool SetStructPropertyValue(void* StructAddr, FStructProperty* StructProp,
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Containers/Ticker.h"
+
+class UBlueprint;
+
+/** When Blueprints edited by bridge commands are recompiled */
+enum class ESpirrowCompilePolicy : uint8
+{
+    /** Compile inside the command (previous behavior) */
+    Immediate,
+    /** Queue; compile_pending, flushes, batch ends and an idle tick budget drain the queue */
+    Deferred
+};
+
+/** Outcome of compiling one Blueprint */
+struct FSpirrowBlueprintCompileResult
+{
+    FString BlueprintPath;
+    bool bSuccess = false;
+    int32 NumWarnings = 0;
+    int32 NumErrors = 0;
+    TArray<FString> Warnings;
+    TArray<FString> Errors;
+    /** Per-Blueprint time when compiled alone, time of the whole pass when compiled as a batch */
+    double ElapsedMs = 0.0;
+    bool bBatched = false;
+};
+
+/**
+ * Bridge-wide compile queue. Command handlers call RequestCompile instead of
+ * FKismetEditorUtilities::CompileBlueprint so that forty edits of one widget cost one compile.
+ * Code that reads GeneratedClass calls EnsureCompiled first. Game thread only.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeCompileScheduler
+{
+public:
+    static FSpirrowBridgeCompileScheduler& Get();
+
+    /** Register the idle ticker. Called when the bridge subsystem starts */
+    void Startup();
+
+    /** Unregister the ticker and compile anything still queued */
+    void Shutdown();
+
+    /** Compile now (Immediate, or bForceImmediate) or queue the Blueprint */
+    void RequestCompile(UBlueprint* Blueprint, bool bForceImmediate = false);
+
+    /** Compile the Blueprint now if it is queued. Call before reading GeneratedClass */
+    void EnsureCompiled(UBlueprint* Blueprint);
+
+    /** Compile every queued Blueprint as one batch. Returns the number compiled without errors */
+    int32 CompilePending(TArray<FSpirrowBlueprintCompileResult>* OutResults = nullptr);
+
+    /**
+     * Queue all Blueprints into FBlueprintCompilationManager and flush once, so skeleton
+     * regeneration and reinstancing of shared dependencies happen once for the whole set.
+     * The Blueprints are removed from the pending queue.
+     */
+    void CompileBlueprints(const TArray<UBlueprint*>& Blueprints, TArray<FSpirrowBlueprintCompileResult>& OutResults);
+
+    ESpirrowCompilePolicy GetPolicy() const { return Policy; }
+    int32 GetPendingCount() const { return PendingBlueprints.Num(); }
+    bool IsPending(const UBlueprint* Blueprint) const;
+
+    /** Compile one Blueprint and collect its status, messages and time */
+    static void CompileBlueprint(UBlueprint* Blueprint, FSpirrowBlueprintCompileResult& OutResult);
+
+    static TSharedPtr<FJsonObject> CompileResultToJson(const FSpirrowBlueprintCompileResult& Result, bool bIncludeMessages);
+
+    /**
+     * Queues compiles for its lifetime regardless of policy (execute_batch).
+     * Immediate policy compiles the queue when the outermost scope ends.
+     */
+    struct SPIRROWBRIDGE_API FScopedDeferral
+    {
+        FScopedDeferral();
+        ~FScopedDeferral();
+    };
+
+    // Handle compile queue commands: set_compile_policy, compile_pending, get_compile_status
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+private:
+    FSpirrowBridgeCompileScheduler() = default;
+
+    bool Tick(float DeltaTime);
+    TSharedPtr<FJsonObject> MakeStatusJson() const;
+
+    ESpirrowCompilePolicy Policy = ESpirrowCompilePolicy::Immediate;
+    double IdleSeconds = 0.5;
+    double TickBudgetMs = 50.0;
+    double LastRequestTime = 0.0;
+    int32 DeferralDepth = 0;
+    int32 TotalRequests = 0;
+    int32 TotalCompiles = 0;
+
+    /** Set: hundreds of Blueprints can be queued, and every request and EnsureCompiled looks one up */
+    TSet<TWeakObjectPtr<UBlueprint>> PendingBlueprints;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
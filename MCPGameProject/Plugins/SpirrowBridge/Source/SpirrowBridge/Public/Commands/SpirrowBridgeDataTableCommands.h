@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/**
+ * Handler class for DataTable related MCP commands
+ * Handles bulk row import from CSV/JSON files or inline rows
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeDataTableCommands
+{
+public:
+    FSpirrowBridgeDataTableCommands();
+
+    // Handle DataTable commands
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+private:
+    // Row import commands
+    TSharedPtr<FJsonObject> HandleUpsertDataTableRows(const TSharedPtr<FJsonObject>& Params);
+
+    // Helper to find a row struct by name ("ItemRow", "FItemRow") or object path
+    UScriptStruct* FindRowStruct(const FString& StructName);
+};
@@ -17,6 +17,7 @@ public:
 
 private:
     // Actor manipulation commands
+    // Listing and search accept "source" ("loaded" | "descriptors") and an optional "bounds" { min, max }
     TSharedPtr<FJsonObject> HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSpawnActor(const TSharedPtr<FJsonObject>& Params);
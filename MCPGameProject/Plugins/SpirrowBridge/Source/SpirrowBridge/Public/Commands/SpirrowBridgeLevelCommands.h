@@ -0,0 +1,123 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * Actor selection filter shared by the bulk level commands.
+ * Parsed from a "filter" object: { names, selected, class, label, tag, folder, bounds, load_region, all }.
+ * All specified criteria must match (AND semantics). Unknown keys are rejected.
+ */
+struct SPIRROWBRIDGE_API FSpirrowBridgeActorFilter
+{
+    TSet<FString> Names;
+    bool bSelectedOnly = false;
+    UClass* ActorClass = nullptr;
+    FString LabelPattern;
+    FName Tag;
+    FString FolderPath;
+    bool bHasBounds = false;
+    FBox Bounds = FBox(ForceInit);
+    /** World Partition only: load the cells intersecting Bounds before collecting */
+    bool bLoadRegion = false;
+    /** Explicit opt-in to match every actor; commands that edit actors refuse a filter without criteria otherwise */
+    bool bAll = false;
+
+    /** Parse the filter from Params[FieldName]. Returns an error response on invalid input, nullptr on success */
+    static TSharedPtr<FJsonObject> Parse(const TSharedPtr<FJsonObject>& Params, const FString& FieldName, FSpirrowBridgeActorFilter& OutFilter);
+
+    /** Resolve an actor class from a short name ("StaticMeshActor"), native path or Blueprint path */
+    static UClass* ResolveActorClass(const FString& ClassName);
+
+    /** True when any criterion narrows the selection (load_region and all do not) */
+    bool HasCriteria() const;
+
+    bool Matches(AActor* Actor) const;
+
+    /** Collect every matching actor in the world in a single pass */
+    void Collect(UWorld* World, TArray<AActor*>& OutActors) const;
+
+    /**
+     * Load the World Partition region covered by Bounds when bLoadRegion is set.
+     * One loader is kept per bounds and reused by later calls. With bKeepLoaded the region stays
+     * loaded (so edits can be saved) until unload_world_partition_region; otherwise ReleaseRegion unloads it.
+     * Returns an error response on failure, nullptr otherwise.
+     */
+    TSharedPtr<FJsonObject> LoadRegion(UWorld* World, int32& OutActorsLoaded, bool bKeepLoaded = true) const;
+
+    /** Unload the region loaded by LoadRegion unless a caller asked to keep it */
+    void ReleaseRegion(UWorld* World) const;
+
+    /**
+     * Unload regions loaded by the bridge: the one matching InBounds, or all of them when InBounds is null.
+     * Regions that still contain unsaved actors are kept and counted in OutSkippedDirty.
+     */
+    static int32 UnloadRegions(UWorld* World, const FBox* InBounds, int32& OutSkippedDirty);
+};
+
+/**
+ * Handler class for bulk level operations (instancing, bulk edits, snapshots)
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeLevelCommands
+{
+public:
+    FSpirrowBridgeLevelCommands();
+
+    // Handle level commands
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+private:
+    /**
+     * Replace groups of identical StaticMeshActors with one HISM actor per group
+     * @param Params - "filter" (optional actor filter, class defaults to StaticMeshActor),
+     *                 "min_instances" (default 2), "delete_originals" (default true),
+     *                 "name_prefix" (default "HISM_"), "target_folder" (optional),
+     *                 "dry_run" (default false: report the groups and counts without changing the level)
+     */
+    TSharedPtr<FJsonObject> HandleConsolidateToInstances(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Apply property assignments to every actor matching a filter in one pass
+     * @param Params - "filter" (actor filter with at least one criterion, or { "all": true }), "properties" (actor property map),
+     *                 "component_properties" (array of { component | component_class, properties }),
+     *                 "dry_run" (default false)
+     */
+    TSharedPtr<FJsonObject> HandleUpdateActorsWhere(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Read the same property paths from many objects as one table (rows = objects, columns = properties)
+     * @param Params - "properties" (array of property paths, nested struct paths allowed),
+     *                 "objects" (asset object paths; Blueprints are read from their class defaults) and/or
+     *                 "filter" (actor filter), "diff_from_defaults" (default false: null where equal to the CDO)
+     */
+    TSharedPtr<FJsonObject> HandleGetPropertiesBatch(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Write a columnar binary snapshot of every actor in the editor world
+     * @param Params - "file_path" (optional, defaults to Saved/LevelSnapshots/<Map>_<timestamp>.sbls)
+     */
+    TSharedPtr<FJsonObject> HandleExportLevelSnapshot(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Compare two level snapshots by stable actor id
+     * @param Params - "snapshot_a" (file path), "snapshot_b" (file path, omitted = capture the current level),
+     *                 "tolerance" (transform and bounds tolerance, default 0.01), "max_results" (per list, default 1000),
+     *                 "allow_map_mismatch" (diff snapshots of different maps instead of failing, default false)
+     */
+    TSharedPtr<FJsonObject> HandleDiffLevelSnapshots(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Load a World Partition region so that following commands can edit the actors in it
+     * @param Params - "bounds" ({ min, max })
+     */
+    TSharedPtr<FJsonObject> HandleLoadWorldPartitionRegion(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Unload World Partition regions loaded by the bridge (load_world_partition_region or filter.load_region)
+     * @param Params - "bounds" (optional { min, max }; all bridge regions when omitted)
+     */
+    TSharedPtr<FJsonObject> HandleUnloadWorldPartitionRegion(const TSharedPtr<FJsonObject>& Params);
+};
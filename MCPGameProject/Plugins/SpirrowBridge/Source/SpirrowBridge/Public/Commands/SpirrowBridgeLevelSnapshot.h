@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/**
+ * Columnar (structure-of-arrays) capture of every actor in a world.
+ *
+ * File layout (.sbls, little-endian, every block 8-byte aligned so it can be memory-mapped):
+ *   Header (64 bytes)
+ *     u32 magic "SBLS", u32 version, u32 actor_count, u32 column_count,
+ *     u32 string_count, u32 map_name (string index),
+ *     u64 string_offsets_offset, u64 string_data_offset, u64 string_data_size,
+ *     u64 column_directory_offset, i64 capture_time (unix seconds)
+ *   Column directory (column_count x 40 bytes)
+ *     char name[16], u32 type (1=u32 2=u64 3=f32 4=f64), u32 components, u64 count, u64 offset
+ *   Columns (count x components values each)
+ *   String table: u32 offsets[string_count + 1] into a UTF-8 blob. String 0 is always "".
+ *
+ * Variable-length lists (materials, tags) are stored CSR-style: "*_start" holds actor_count + 1
+ * offsets into the matching "*_ids" column of string indices.
+ */
+struct SPIRROWBRIDGE_API FSpirrowBridgeLevelSnapshot
+{
+    static constexpr uint32 FileMagic = 0x534C4253; // "SBLS"
+    static constexpr uint32 FileVersion = 1;
+
+    FString MapName;
+    int64 CaptureTime = 0;
+
+    /** Interned strings, index 0 is the empty string */
+    TArray<FString> Strings;
+
+    /** Stable actor id: CityHash64 of the UTF-8 actor path name */
+    TArray<uint64> Ids;
+    TArray<uint32> NameIds;
+    TArray<uint32> LabelIds;
+    TArray<uint32> ClassIds;
+    TArray<uint32> LevelIds;
+    TArray<uint32> FolderIds;
+    TArray<uint32> MeshIds;
+    TArray<FVector> Locations;
+    TArray<FRotator> Rotations;
+    TArray<FVector> Scales;
+    TArray<FVector3f> BoundsMin;
+    TArray<FVector3f> BoundsMax;
+    TArray<uint32> MaterialStarts;
+    TArray<uint32> MaterialIds;
+    TArray<uint32> TagStarts;
+    TArray<uint32> TagIds;
+
+    int32 Num() const { return Ids.Num(); }
+
+    const FString& GetString(uint32 Index) const
+    {
+        return Strings.IsValidIndex(Index) ? Strings[Index] : Strings[0];
+    }
+
+    /** Capture every actor of every loaded level. Actor state is read on the game thread, then converted in parallel chunks */
+    static void Capture(UWorld* World, FSpirrowBridgeLevelSnapshot& OutSnapshot);
+
+    bool SaveToFile(const FString& FilePath, FString& OutError) const;
+    bool LoadFromFile(const FString& FilePath, FString& OutError);
+
+    /** Hash used for Ids, exposed so other commands can look actors up by id */
+    static uint64 HashActorPath(const FString& ActorPath);
+};
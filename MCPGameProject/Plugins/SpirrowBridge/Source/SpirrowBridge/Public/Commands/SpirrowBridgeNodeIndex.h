@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+struct FEdGraphEditAction;
+
+/**
+ * GUID -> node index per Blueprint, covering every graph (ubergraph pages, functions, macros
+ * and nested graphs). Built on the first lookup for a Blueprint; dropped when one of its graphs
+ * reports a change, when the Blueprint reports a change, and after garbage collection. A lookup
+ * that misses or hits a stale node rebuilds the Blueprint's index once before giving up, so
+ * edits that bypass the notifications are still found. Game thread only.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeNodeIndex
+{
+public:
+    static FSpirrowBridgeNodeIndex& Get();
+
+    /** Subscribe to garbage collection. Called when the bridge subsystem starts */
+    void Startup();
+
+    /** Unsubscribe from every graph and Blueprint and drop the index */
+    void Shutdown();
+
+    /** Node with this GUID in any graph of the Blueprint, or nullptr */
+    UEdGraphNode* FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid);
+
+    /**
+     * Parse a node id parameter and look it up.
+     * @param Label Used in the not-found message ("Node", "Source node", ...)
+     * @return Error response for a malformed id or a missing node, nullptr on success
+     */
+    TSharedPtr<FJsonObject> ResolveNode(UBlueprint* Blueprint, const FString& NodeId, UEdGraphNode*& OutNode,
+        const FString& Label = TEXT("Node"));
+
+    /** Drop the index of one Blueprint; rebuilt on its next lookup */
+    void Invalidate(UBlueprint* Blueprint);
+
+    void Clear();
+
+private:
+    FSpirrowBridgeNodeIndex() = default;
+
+    struct FBlueprintEntry
+    {
+        TWeakObjectPtr<UBlueprint> Blueprint;
+        TMap<FGuid, TWeakObjectPtr<UEdGraphNode>> Nodes;
+        TArray<TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>> GraphHandles;
+        FDelegateHandle BlueprintChangedHandle;
+    };
+
+    FBlueprintEntry& Build(UBlueprint* Blueprint);
+    void Unsubscribe(FBlueprintEntry& Entry);
+    void Remove(TObjectKey<UBlueprint> Key);
+
+    void OnGraphChanged(const FEdGraphEditAction& Action, TObjectKey<UBlueprint> Key);
+    void OnBlueprintChanged(UBlueprint* Blueprint);
+    void OnPostGarbageCollect();
+
+    TMap<TObjectKey<UBlueprint>, FBlueprintEntry> Entries;
+
+    FDelegateHandle PostGarbageCollectHandle;
+};
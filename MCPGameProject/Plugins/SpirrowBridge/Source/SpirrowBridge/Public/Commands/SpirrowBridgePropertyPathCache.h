@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/** Writes a JSON value into one property value at ValueAddr. PropertyPath is only used in messages */
+using FSpirrowPropertySetter = bool (*)(FProperty* Property, void* ValueAddr, const TSharedPtr<FJsonValue>& Value,
+    const FString& PropertyPath, FString& OutErrorMessage);
+
+/** A property path compiled against one class or struct */
+struct FSpirrowPropertyPath
+{
+    /** Leaf property the path ends at */
+    FProperty* Property = nullptr;
+    /** Byte offset of the leaf value from the start of the outermost container */
+    int32 Offset = 0;
+    /** Setter picked for the leaf property type once, at compile time */
+    FSpirrowPropertySetter Setter = nullptr;
+
+    void* GetValuePtr(void* Container) const
+    {
+        return static_cast<uint8*>(Container) + Offset;
+    }
+};
+
+/**
+ * Cache of property paths ("Health", "Brush.TintColor") resolved per (class or struct, path).
+ * Each path is split, looked up segment by segment through nested struct properties and reduced
+ * to the leaf property, its byte offset and its typed setter, so repeated writes cost one hash
+ * lookup. Failed lookups are cached with their error. Everything is dropped when Blueprints
+ * compile, objects are reinstanced and after hot reload, since each of these can replace FProperty
+ * objects; after garbage collection only the entries whose class or structs were collected go.
+ * Game thread only.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgePropertyPathCache
+{
+public:
+    static FSpirrowBridgePropertyPathCache& Get();
+
+    /** Subscribe to compile, reinstance, reload and GC events. Called when the bridge subsystem starts */
+    void Startup();
+
+    /** Unsubscribe and drop every entry */
+    void Shutdown();
+
+    /**
+     * Resolve a dot separated property path on a class or struct. Every segment but the last must
+     * be a struct property.
+     * @return nullptr when the path does not resolve; OutErrorMessage says which segment failed.
+     *         The pointer refers into the cache and is only valid until the next Find or Clear
+     *         (a new entry can reallocate the map); copy the fields before looking up another path.
+     */
+    const FSpirrowPropertyPath* Find(const UStruct* Struct, const FString& PropertyPath, FString& OutErrorMessage);
+
+    void Clear();
+
+private:
+    FSpirrowBridgePropertyPathCache() = default;
+
+    struct FKey
+    {
+        const UStruct* Struct = nullptr;
+        FString Path;
+
+        bool operator==(const FKey& Other) const
+        {
+            return Struct == Other.Struct && Path == Other.Path;
+        }
+
+        friend uint32 GetTypeHash(const FKey& Key)
+        {
+            return HashCombine(PointerHash(Key.Struct), GetTypeHash(Key.Path));
+        }
+    };
+
+    struct FEntry
+    {
+        FSpirrowPropertyPath Path;
+        /** Set when the path did not resolve */
+        FString ErrorMessage;
+        /** The class or struct and every struct the path passes through; pruned after GC once one is gone */
+        TArray<TWeakObjectPtr<const UStruct>, TInlineAllocator<2>> Structs;
+    };
+
+    static bool Compile(const UStruct* Struct, const FString& PropertyPath, FEntry& OutEntry);
+
+    void OnObjectsReinstanced(const TMap<UObject*, UObject*>& OldToNewInstanceMap);
+    void OnReloadComplete(EReloadCompleteReason Reason);
+    void OnPostGarbageCollect();
+
+    TMap<FKey, FEntry> Entries;
+
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle ObjectsReinstancedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle PostGarbageCollectHandle;
+};
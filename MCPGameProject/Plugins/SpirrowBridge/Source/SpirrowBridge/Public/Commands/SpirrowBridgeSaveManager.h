@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Containers/Ticker.h"
+
+class UObject;
+class UPackage;
+
+/** When asset edits made by bridge commands are written to disk */
+enum class ESpirrowSavePolicy : uint8
+{
+    /** Save inside the command (previous behavior) */
+    Immediate,
+    /** Mark dirty; the dirty set is written by flush_saves or after the bridge has been idle */
+    Deferred,
+    /** Mark dirty; only flush_saves writes */
+    Manual
+};
+
+/** Outcome of saving one package */
+struct FSpirrowPackageSaveResult
+{
+    FString PackageName;
+    bool bSuccess = false;
+    /** Serialized together with other packages by UPackage::SaveConcurrent */
+    bool bConcurrent = false;
+    int64 BytesWritten = 0;
+    /** Per-package time for sequential saves, time of the whole concurrent pass otherwise */
+    double ElapsedMs = 0.0;
+};
+
+/**
+ * Bridge-wide save policy and dirty package set.
+ * Command handlers call RequestSave instead of UPackage::SavePackage so that repeated
+ * edits of the same asset cost one save. Game thread only.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeSaveManager
+{
+public:
+    static FSpirrowBridgeSaveManager& Get();
+
+    /** Register the idle ticker. Called when the bridge subsystem starts */
+    void Startup();
+
+    /** Unregister the ticker and flush pending saves in Deferred mode */
+    void Shutdown();
+
+    /**
+     * Save the asset's package now (Immediate) or add it to the dirty set.
+     * @return false only when an immediate save failed
+     */
+    bool RequestSave(UObject* Asset);
+
+    /** Add a package to the dirty set without saving, regardless of policy */
+    void MarkPending(UPackage* Package);
+
+    /**
+     * Write every pending package. Returns the number of packages saved.
+     * Packages that fail stay pending and are listed as failed in OutResults; idle flushes retry
+     * them only once new saves are requested, so a read-only file does not fail every tick.
+     */
+    int32 Flush(bool bConcurrent = true, TArray<FSpirrowPackageSaveResult>* OutResults = nullptr);
+
+    ESpirrowSavePolicy GetPolicy() const { return Policy; }
+    int32 GetPendingCount() const { return PendingPackages.Num(); }
+
+    /** Save one package synchronously with the bridge's standard save args */
+    static bool SavePackageNow(UPackage* Package, UObject* Asset = nullptr);
+
+    /**
+     * Save a set of packages. With bConcurrent, independent asset packages are serialized in
+     * parallel through UPackage::SaveConcurrent; maps, packages without a main asset and packages
+     * the concurrent pass fails on are saved sequentially afterwards.
+     */
+    static void SavePackages(const TArray<UPackage*>& Packages, bool bConcurrent, TArray<FSpirrowPackageSaveResult>& OutResults);
+
+    static TSharedPtr<FJsonObject> SaveResultToJson(const FSpirrowPackageSaveResult& Result);
+
+    static bool ParsePolicy(const FString& PolicyName, ESpirrowSavePolicy& OutPolicy);
+    static FString PolicyToString(ESpirrowSavePolicy InPolicy);
+
+    /**
+     * Holds saves in the dirty set for its lifetime regardless of policy (execute_batch).
+     * Immediate policy flushes when the outermost scope ends.
+     */
+    struct SPIRROWBRIDGE_API FScopedDeferral
+    {
+        FScopedDeferral();
+        ~FScopedDeferral();
+    };
+
+    // Handle save commands: set_save_policy, flush_saves, save_packages, get_save_status
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+private:
+    FSpirrowBridgeSaveManager() = default;
+
+    bool Tick(float DeltaTime);
+    TSharedPtr<FJsonObject> MakeStatusJson() const;
+    TSharedPtr<FJsonObject> MakeSaveReportJson(const TArray<FSpirrowPackageSaveResult>& Results, double StartTime) const;
+
+    static FString GetPackageFilename(const UPackage* Package);
+    static void SavePackageSequential(UPackage* Package, UObject* Asset, FSpirrowPackageSaveResult& OutResult);
+
+    ESpirrowSavePolicy Policy = ESpirrowSavePolicy::Immediate;
+    double IdleFlushSeconds = 2.0;
+    double LastRequestTime = 0.0;
+    int32 DeferralDepth = 0;
+    int32 TotalRequests = 0;
+    int32 TotalSaves = 0;
+    /** Time of the last flush that left failed packages pending */
+    double LastFailedFlushTime = -1.0;
+
+    TSet<TWeakObjectPtr<UPackage>> PendingPackages;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
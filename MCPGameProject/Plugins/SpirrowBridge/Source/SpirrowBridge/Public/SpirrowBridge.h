@@ -17,11 +17,13 @@
 #include "Commands/SpirrowBridgeUMGAnimationCommands.h"
 #include "Commands/SpirrowBridgeUMGVariableCommands.h"
 #include "Commands/SpirrowBridgeConfigCommands.h"
+#include "Commands/SpirrowBridgeDataTableCommands.h"
 #include "Commands/SpirrowBridgeGASCommands.h"
 #include "Commands/SpirrowBridgeMaterialCommands.h"
 #include "Commands/SpirrowBridgeAICommands.h"
 #include "Commands/SpirrowBridgeAIPerceptionCommands.h"
 #include "Commands/SpirrowBridgeEQSCommands.h"
+#include "Commands/SpirrowBridgeLevelCommands.h"
 #include "SpirrowBridge.generated.h"
 
 class FMCPServerRunnable;
@@ -54,6 +56,16 @@ public:
 	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
 private:
+	// Route a command to its handler. Must run on the game thread; returns nullptr for unknown commands
+	TSharedPtr<FJsonObject> RouteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+	/**
+	 * Run an ordered list of commands in one game thread visit under one transaction.
+	 * Params may reference earlier results as "$N.field" (N = 0-based index).
+	 * Touched Blueprints are compiled and touched assets saved once at the end.
+	 */
+	TSharedPtr<FJsonObject> HandleExecuteBatch(const TSharedPtr<FJsonObject>& Params);
+
 	// Server state
 	bool bIsRunning;
 	TSharedPtr<FSocket> ListenerSocket;
@@ -74,9 +86,11 @@ private:
 	TSharedPtr<FSpirrowBridgeUMGAnimationCommands> UMGAnimationCommands;
 	TSharedPtr<FSpirrowBridgeUMGVariableCommands> UMGVariableCommands;
 	TSharedPtr<FSpirrowBridgeConfigCommands> ConfigCommands;
+	TSharedPtr<FSpirrowBridgeDataTableCommands> DataTableCommands;
 	TSharedPtr<FSpirrowBridgeGASCommands> GASCommands;
 	TSharedPtr<FSpirrowBridgeMaterialCommands> MaterialCommands;
 	TSharedPtr<FSpirrowBridgeAICommands> AICommands;
 	TSharedPtr<FSpirrowBridgeAIPerceptionCommands> AIPerceptionCommands;
 	TSharedPtr<FSpirrowBridgeEQSCommands> EQSCommands;
+	TSharedPtr<FSpirrowBridgeLevelCommands> LevelCommands;
 }; 
\ No newline at end of file
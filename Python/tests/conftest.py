@@ -46,5 +46,8 @@ def pytest_configure(config):
     config.addinivalue_line("markers", "umg: UMG Widget操作テスト")
     config.addinivalue_line("markers", "node: Blueprintノード操作テスト")
     config.addinivalue_line("markers", "gas: GAS操作テスト")
+    config.addinivalue_line("markers", "level: レベル一括操作テスト")
+    config.addinivalue_line("markers", "bridge: バッチ実行・ブリッジ制御テスト")
+    config.addinivalue_line("markers", "datatable: DataTable操作テスト")
     config.addinivalue_line("markers", "slow: 遅いテスト")
     config.addinivalue_line("markers", "integration: 統合テスト")
@@ -5,7 +5,7 @@ Blueprint作成、コンポーネント追加、ノード操作のテスト
 """
 
 import pytest
-from test_framework import assert_success, assert_response_has
+from test_framework import assert_success, assert_response_has, assert_error_code
 
 
 @pytest.mark.blueprint
@@ -52,6 +52,190 @@ class TestBlueprintCore:
             "asset_path": f"/Game/Test/{bp_name}"
         })
     
+    def test_compile_blueprints_batch(self, test_suite, unique_name):
+        """複数Blueprint一括コンパイルテスト"""
+        bp_names = [unique_name("BP_BatchCompile") for _ in range(2)]
+
+        for bp_name in bp_names:
+            test_suite.run_command("create_blueprint", {
+                "name": bp_name,
+                "parent_class": "Actor",
+                "path": "/Game/Test"
+            })
+            test_suite.add_cleanup("delete_asset", {
+                "asset_path": f"/Game/Test/{bp_name}"
+            })
+
+        result = test_suite.run_command("compile_blueprints_batch", {
+            "blueprints": bp_names + ["BP_DoesNotExist"],
+            "path": "/Game/Test"
+        })
+
+        assert_success(result, "Blueprint一括コンパイル")
+        assert_response_has(result, "compiled", 2)
+        assert_response_has(result, "failed", 0)
+        data = result.response["result"]
+        assert data["not_found"] == ["BP_DoesNotExist"]
+        assert all(bp["batched"] for bp in data["blueprints"])
+
+    def test_create_blueprint_parent_class_lookup(self, test_suite, unique_name):
+        """親クラスを接頭辞付き名・Blueprint名で解決できる"""
+        base_name = unique_name("BP_ParentBase")
+        child_name = unique_name("BP_ParentChild")
+
+        result = test_suite.run_command("create_blueprint", {
+            "name": base_name,
+            "parent_class": "APlayerController",
+            "path": "/Game/Test"
+        })
+        assert_success(result, "接頭辞付き親クラス")
+        assert_response_has(result, "parent_class", "PlayerController")
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{base_name}"})
+
+        result = test_suite.run_command("create_blueprint", {
+            "name": child_name,
+            "parent_class": base_name,
+            "path": "/Game/Test"
+        })
+        assert_success(result, "Blueprint親クラス")
+        assert_response_has(result, "parent_class", f"{base_name}_C")
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{child_name}"})
+
+    def test_set_blueprint_property_paths(self, test_suite, unique_name):
+        """ネストした構造体パスとImportTextフォールバック"""
+        bp_name = unique_name("BP_PropertyPath")
+        test_suite.run_command("create_blueprint", {
+            "name": bp_name,
+            "parent_class": "Actor",
+            "path": "/Game/Test"
+        })
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{bp_name}"})
+
+        result = test_suite.run_command("set_blueprint_property", {
+            "blueprint_name": bp_name,
+            "property_name": "PrimaryActorTick.TickInterval",
+            "property_value": 0.5,
+            "path": "/Game/Test"
+        })
+        assert_success(result, "ネストパス設定")
+
+        # TArray<FName> は専用セッターが無くImportTextで設定される
+        result = test_suite.run_command("set_blueprint_property", {
+            "blueprint_name": bp_name,
+            "property_name": "Tags",
+            "property_value": ["Enemy", "Spawned"],
+            "path": "/Game/Test"
+        })
+        assert_success(result, "配列プロパティ設定")
+
+        result = test_suite.run_command("set_blueprint_property", {
+            "blueprint_name": bp_name,
+            "property_name": "PrimaryActorTick.NoSuchField",
+            "property_value": 1,
+            "path": "/Game/Test"
+        }, expected_success=False)
+        assert not result.success
+
+    def test_scan_project_classes_cache(self, test_suite, unique_name):
+        """スキャン結果のキャッシュ・無効化・ページング"""
+        bp_name = unique_name("BP_ScanTarget")
+        scan_params = {"class_type": "blueprint", "path_filter": "/Game/Test"}
+
+        test_suite.run_command("scan_project_classes", scan_params)
+        result = test_suite.run_command("scan_project_classes", scan_params)
+        assert_success(result, "再スキャン")
+        assert_response_has(result, "cached", True)
+
+        # Blueprint追加でキャッシュが無効化される
+        test_suite.run_command("create_blueprint", {
+            "name": bp_name,
+            "parent_class": "Actor",
+            "path": "/Game/Test"
+        })
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{bp_name}"})
+
+        result = test_suite.run_command("scan_project_classes", scan_params)
+        assert_response_has(result, "cached", False)
+        data = result.response["result"]
+        assert bp_name in [bp["name"] for bp in data["blueprints"]]
+
+        result = test_suite.run_command("scan_project_classes", {**scan_params, "limit": 1})
+        data = result.response["result"]
+        assert len(data["blueprints"]) == 1
+        assert data["has_more"] == (data["total_blueprints"] > 1)
+
+    def test_search_blueprints(self, test_suite, unique_name):
+        """FiBインデックス検索（追加の反映・前方一致・ページング）"""
+        bp_name = unique_name("BP_SearchTarget")
+        test_suite.run_command("create_blueprint", {
+            "name": bp_name,
+            "parent_class": "Actor",
+            "path": "/Game/Test"
+        })
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{bp_name}"})
+
+        result = test_suite.run_command("search_blueprints", {"query": bp_name, "path": "/Game/Test"})
+        assert_success(result, "Blueprint検索")
+        data = result.response["result"]
+        assert bp_name in [hit["name"] for hit in data["results"]]
+
+        result = test_suite.run_command("search_blueprints", {"query": "BP_Search*", "path": "/Game/Test", "limit": 1})
+        assert_success(result, "前方一致検索")
+        data = result.response["result"]
+        assert len(data["results"]) == 1
+        assert data["has_more"] == (data["total"] > 1)
+
+        result = test_suite.run_command("search_blueprints", {"query": "*"}, expected_success=False)
+        assert not result.success, "検索語のないクエリは失敗すべき"
+
+    def test_batch_set_properties_multi(self, test_suite, unique_name):
+        """親クラス指定で派生Blueprint全てのCDOを一括変更"""
+        base_name = unique_name("BP_MultiBase")
+        child_names = [unique_name("BP_MultiChild") for _ in range(2)]
+
+        test_suite.run_command("create_blueprint", {
+            "name": base_name,
+            "parent_class": "Actor",
+            "path": "/Game/Test"
+        })
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{base_name}"})
+        for child_name in child_names:
+            test_suite.run_command("create_blueprint", {
+                "name": child_name,
+                "parent_class": base_name,
+                "path": "/Game/Test"
+            })
+            test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{child_name}"})
+
+        result = test_suite.run_command("batch_set_properties_multi", {
+            "parent_class": base_name,
+            "folder": "/Game/Test",
+            "properties": {"InitialLifeSpan": 30.0}
+        })
+
+        assert_success(result, "派生Blueprint一括プロパティ設定")
+        assert_response_has(result, "matched", 2)
+        assert_response_has(result, "succeeded", 2)
+        assert_response_has(result, "compiled", 2)
+
+    def test_batch_set_properties_multi_ambiguous_name(self, test_suite, unique_name):
+        """assetsの名前が複数アセットに一致する場合はnot_foundではなくAssetAmbiguous"""
+        bp_name = unique_name("BP_MultiDup")
+        for path in ("/Game/Test", "/Game/Test/Dup"):
+            test_suite.run_command("create_blueprint", {
+                "name": bp_name,
+                "parent_class": "Actor",
+                "path": path
+            })
+            test_suite.add_cleanup("delete_asset", {"asset_path": f"{path}/{bp_name}"})
+
+        result = test_suite.run_command("batch_set_properties_multi", {
+            "assets": [bp_name],
+            "properties": {"InitialLifeSpan": 30.0}
+        }, expected_success=False)
+
+        assert_error_code(result, 1106)
+
     def test_duplicate_blueprint(self, test_suite, unique_name):
         """Blueprint複製テスト"""
         bp_name = unique_name("BP_Original")
@@ -176,6 +360,253 @@ class TestBlueprintNode:
             "asset_path": f"/Game/Test/{self.bp_name}"
         })
     
+    def test_apply_graph_patch(self, test_suite):
+        """グラフパッチ一括適用テスト（ローカルID→GUID対応）"""
+        result = test_suite.run_command("apply_graph_patch", {
+            "blueprint_name": self.bp_name,
+            "path": "/Game/Test",
+            "nodes": [
+                {"id": "begin", "type": "event", "name": "ReceiveBeginPlay"},
+                {"id": "print", "type": "function", "name": "PrintString", "pins": {"InString": "Patched"}},
+                {"id": "delay", "type": "function", "name": "Delay", "pins": {"Duration": 0.5}}
+            ],
+            "links": [
+                {"from": "begin", "to": "print"},
+                {"from": "print", "to": "delay"}
+            ]
+        })
+
+        assert_success(result, "グラフパッチ適用")
+        assert_response_has(result, "links_created", 2)
+        node_ids = result.response["result"]["node_ids"]
+        assert set(node_ids.keys()) == {"begin", "print", "delay"}
+
+        graph_params = {"blueprint_name": self.bp_name, "path": "/Game/Test", "graphs": ["EventGraph"]}
+        result = test_suite.run_command("get_blueprint_graph", graph_params)
+        hash_before = result.response["result"]["graphs"][0]["hash"]
+
+        # 不正なリンクはロールバックされる（作成ノード削除・既存ピンのデフォルト値復元）
+        result = test_suite.run_command("apply_graph_patch", {
+            "blueprint_name": self.bp_name,
+            "path": "/Game/Test",
+            "nodes": [
+                {"id": "branch", "type": "branch"},
+                {"id": "print", "node_id": node_ids["print"], "pins": {"InString": "Changed"}}
+            ],
+            "links": [{"from": "branch", "from_pin": "NoSuchPin", "to": "print"}]
+        }, expected_success=False)
+
+        assert not result.success, "存在しないピンへのリンクは失敗すべき"
+        result = test_suite.run_command("get_blueprint_graph", graph_params)
+        assert result.response["result"]["graphs"][0]["hash"] == hash_before, "失敗したパッチはグラフを変更しないべき"
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/{self.bp_name}"
+        })
+
+    def test_auto_layout_blueprint_graph(self, test_suite):
+        """グラフ自動レイアウトテスト（実行順の列配置・選択ノードのみ配置）"""
+        result = test_suite.run_command("apply_graph_patch", {
+            "blueprint_name": self.bp_name,
+            "path": "/Game/Test",
+            "nodes": [
+                {"id": "begin", "type": "event", "name": "ReceiveBeginPlay", "position": [0, 0]},
+                {"id": "print", "type": "function", "name": "PrintString", "position": [0, 0]},
+                {"id": "delay", "type": "function", "name": "Delay", "position": [0, 0]}
+            ],
+            "links": [
+                {"from": "begin", "to": "print"},
+                {"from": "print", "to": "delay"}
+            ]
+        })
+        assert_success(result, "グラフパッチ適用")
+        node_ids = result.response["result"]["node_ids"]
+
+        params = {"blueprint_name": self.bp_name, "path": "/Game/Test"}
+        result = test_suite.run_command("auto_layout_blueprint_graph", params)
+        assert_success(result, "自動レイアウト")
+        data = result.response["result"]
+        assert data["layers"] >= 3
+        assert data["nodes_moved"] >= 2
+
+        result = test_suite.run_command("get_blueprint_graph", dict(params, graphs=["EventGraph"]))
+        positions = {n["id"]: n["pos_x"] for n in result.response["result"]["graphs"][0]["nodes"]}
+        begin, print_node, delay = (positions[node_ids[k]] for k in ("begin", "print", "delay"))
+        assert begin < print_node < delay, "実行順に左から右へ並ぶべき"
+
+        # 再実行しても位置は変わらない
+        result = test_suite.run_command("auto_layout_blueprint_graph", params)
+        assert_success(result, "自動レイアウト再実行")
+        assert_response_has(result, "nodes_moved", 0)
+
+        result = test_suite.run_command("auto_layout_blueprint_graph", dict(params, node_ids=[node_ids["delay"]]))
+        assert_success(result, "選択ノードのみレイアウト")
+        assert_response_has(result, "nodes_laid_out", 1)
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/{self.bp_name}"
+        })
+
+    def test_get_blueprint_graph_if_none_match(self, test_suite):
+        """グラフ取得のハッシュ比較テスト（未変更グラフは省略）"""
+        params = {"blueprint_name": self.bp_name, "path": "/Game/Test"}
+        result = test_suite.run_command("get_blueprint_graph", params)
+        assert_success(result, "グラフ取得")
+        graphs = result.response["result"]["graphs"]
+        hashes = {g["name"]: g["hash"] for g in graphs}
+        assert "EventGraph" in hashes
+
+        result = test_suite.run_command("get_blueprint_graph", dict(params, if_none_match=hashes))
+        assert_success(result, "未変更グラフ取得")
+        for graph in result.response["result"]["graphs"]:
+            assert graph["status"] == "unchanged"
+            assert "nodes" not in graph
+
+        test_suite.run_command("add_print_string_node", {
+            "blueprint_name": self.bp_name,
+            "message": "Changed",
+            "path": "/Game/Test"
+        })
+        result = test_suite.run_command("get_blueprint_graph", dict(params, graphs=["EventGraph"], if_none_match=hashes))
+        assert_success(result, "変更後グラフ取得")
+        event_graph = result.response["result"]["graphs"][0]
+        assert event_graph["status"] == "full"
+        assert event_graph["hash"] != hashes["EventGraph"]
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/{self.bp_name}"
+        })
+
+    def test_node_lookup_by_guid(self, test_suite):
+        """GUIDインデックスによるノード検索テスト（移動・削除・不正ID）"""
+        result = test_suite.run_command("add_print_string_node", {
+            "blueprint_name": self.bp_name,
+            "message": "Index",
+            "path": "/Game/Test"
+        })
+        assert_success(result, "PrintStringノード追加")
+        node_id = result.response["result"]["node_id"]
+
+        result = test_suite.run_command("move_node", {
+            "blueprint_name": self.bp_name,
+            "node_id": node_id,
+            "position": [640, 320],
+            "path": "/Game/Test"
+        })
+        assert_success(result, "GUIDでノード移動")
+
+        result = test_suite.run_command("delete_node", {
+            "blueprint_name": self.bp_name,
+            "node_id": node_id,
+            "path": "/Game/Test"
+        })
+        assert_success(result, "GUIDでノード削除")
+
+        # 削除後のインデックスは無効化されている
+        result = test_suite.run_command("move_node", {
+            "blueprint_name": self.bp_name,
+            "node_id": node_id,
+            "position": [0, 0],
+            "path": "/Game/Test"
+        }, expected_success=False)
+        assert not result.success, "削除済みノードは見つからないべき"
+
+        result = test_suite.run_command("move_node", {
+            "blueprint_name": self.bp_name,
+            "node_id": "not-a-guid",
+            "position": [0, 0],
+            "path": "/Game/Test"
+        }, expected_success=False)
+        assert not result.success, "不正なノードIDは失敗すべき"
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/{self.bp_name}"
+        })
+
+    def test_analyze_blueprint_performance(self, test_suite):
+        """パフォーマンス解析テスト（Tick内のGetAllActorsOfClass検出）"""
+        result = test_suite.run_command("apply_graph_patch", {
+            "blueprint_name": self.bp_name,
+            "path": "/Game/Test",
+            "nodes": [
+                {"id": "tick", "type": "event", "name": "ReceiveTick"},
+                {"id": "find", "type": "function", "name": "GetAllActorsOfClass"}
+            ],
+            "links": [{"from": "tick", "to": "find"}]
+        })
+        assert_success(result, "Tickグラフ作成")
+        find_id = result.response["result"]["node_ids"]["find"]
+
+        result = test_suite.run_command("analyze_blueprint_performance", {
+            "blueprint_name": self.bp_name,
+            "path": "/Game/Test"
+        })
+        assert_success(result, "パフォーマンス解析")
+        data = result.response["result"]
+        assert data["analyzed"] == 1
+        report = data["blueprints"][0]
+        rules = {(f["rule"], f["severity"]) for f in report["findings"]}
+        assert ("event_tick", "warning") in rules
+        assert ("expensive_call", "error") in rules
+        assert find_id in [f.get("node_id") for f in report["findings"]]
+        assert report["tick_events"][0]["per_tick_nodes"] >= 2
+
+        result = test_suite.run_command("analyze_blueprint_performance", {
+            "blueprint_name": self.bp_name,
+            "path": "/Game/Test",
+            "min_severity": "error"
+        })
+        assert_success(result, "重大度フィルタ")
+        for finding in result.response["result"]["blueprints"][0]["findings"]:
+            assert finding["severity"] == "error"
+
+        result = test_suite.run_command("analyze_blueprint_performance", {
+            "blueprint_name": self.bp_name,
+            "path": "/Game/Test",
+            "min_severity": "fatal"
+        }, expected_success=False)
+        assert not result.success, "不正な重大度は失敗すべき"
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/{self.bp_name}"
+        })
+
+    def test_set_tick_policy_batch(self, test_suite):
+        """Tick設定一括変更テスト（dry_run・前後カウント・不正なTickGroup）"""
+        params = {
+            "blueprint_name": self.bp_name,
+            "path": "/Game/Test",
+            "actor": {"enabled": True, "interval": 0.25, "tick_group": "PostPhysics"}
+        }
+        result = test_suite.run_command("set_tick_policy_batch", dict(params, dry_run=True))
+        assert_success(result, "Tick設定dry_run")
+        data = result.response["result"]
+        assert data["matched"] == 1
+        assert data["after"]["actors_can_ever_tick"] == 1
+
+        result = test_suite.run_command("set_tick_policy_batch", params)
+        assert_success(result, "Tick設定適用")
+        data = result.response["result"]
+        assert data["modified"] == 1
+        changed = data["blueprints"][0]["changes"][0]["changed"]
+        assert "interval" in changed and "tick_group" in changed
+
+        # 同じ設定の再適用は変更なし
+        result = test_suite.run_command("set_tick_policy_batch", params)
+        assert_success(result, "Tick設定再適用")
+        assert result.response["result"]["modified"] == 0
+
+        result = test_suite.run_command("set_tick_policy_batch", {
+            "blueprint_name": self.bp_name,
+            "path": "/Game/Test",
+            "actor": {"tick_group": "NoSuchGroup"}
+        }, expected_success=False)
+        assert not result.success, "不正なTickGroupは失敗すべき"
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/{self.bp_name}"
+        })
+
     def test_add_delay_node(self, test_suite):
         """Delayノード追加テスト"""
         result = test_suite.run_command("add_delay_node", {
@@ -0,0 +1,302 @@
+"""
+ブリッジ制御のテストスイート
+
+execute_batch や保存ポリシーなどブリッジ全体の実行制御のテスト
+"""
+
+import pytest
+from test_framework import assert_success, assert_response_has, assert_error_code
+
+
+@pytest.mark.bridge
+class TestExecuteBatch:
+    """execute_batch テスト"""
+
+    def test_batch_with_result_reference(self, test_suite, unique_name):
+        """後続コマンドが $N.field で前の結果を参照できる"""
+        bp_name = unique_name("BP_Batch")
+
+        result = test_suite.run_command("execute_batch", {
+            "commands": [
+                {"command": "create_blueprint",
+                 "params": {"name": bp_name, "parent_class": "Actor", "path": "/Game/Test"}},
+                {"command": "add_branch_node",
+                 "params": {"blueprint_name": bp_name, "path": "/Game/Test", "node_position": [400, 0]}},
+                {"command": "add_print_string_node",
+                 "params": {"blueprint_name": bp_name, "path": "/Game/Test", "node_position": [700, 0]}},
+                {"command": "connect_blueprint_nodes",
+                 "params": {"blueprint_name": bp_name, "path": "/Game/Test",
+                            "source_node_id": "$1.node_id", "source_pin": "then",
+                            "target_node_id": "$2.node_id", "target_pin": "execute"}}
+            ]
+        })
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{bp_name}"})
+
+        assert_success(result, "execute_batch")
+        assert_response_has(result, "succeeded", 4)
+        assert_response_has(result, "failed", 0)
+
+    def test_batch_stop_on_error(self, test_suite):
+        """エラーで停止し、残りのコマンドはスキップされる"""
+        result = test_suite.run_command("execute_batch", {
+            "commands": [
+                {"command": "ping"},
+                {"command": "no_such_command"},
+                {"command": "ping"}
+            ],
+            "stop_on_error": True
+        })
+
+        assert_success(result, "execute_batch (stop_on_error)")
+        assert_response_has(result, "succeeded", 1)
+        assert_response_has(result, "failed", 1)
+        assert_response_has(result, "skipped", 1)
+        assert_response_has(result, "aborted", True)
+
+    def test_batch_reference_to_failed_command(self, test_suite):
+        """失敗したコマンドへの参照はエラーになる"""
+        result = test_suite.run_command("execute_batch", {
+            "commands": [
+                {"command": "no_such_command"},
+                {"command": "find_actors_by_name", "params": {"pattern": "$0.name"}}
+            ],
+            "stop_on_error": False
+        })
+
+        assert_success(result, "execute_batch (continue)")
+        assert_response_has(result, "failed", 2)
+
+
+@pytest.mark.bridge
+class TestSavePolicy:
+    """set_save_policy / flush_saves テスト"""
+
+    def test_manual_policy_defers_until_flush(self, test_suite, unique_name):
+        """manual ポリシーでは同じアセットへの複数編集が 1 回の保存にまとまる"""
+        bb_name = unique_name("BB_SavePolicy")
+
+        result = test_suite.run_command("set_save_policy", {"policy": "manual"})
+        assert_success(result, "set_save_policy (manual)")
+        test_suite.add_cleanup("set_save_policy", {"policy": "immediate"})
+
+        result = test_suite.run_command("create_blackboard", {"name": bb_name, "path": "/Game/Test"})
+        assert_success(result, "create_blackboard")
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{bb_name}"})
+
+        for key in ("KeyA", "KeyB", "KeyC"):
+            result = test_suite.run_command("add_blackboard_key", {
+                "blackboard_name": bb_name, "key_name": key, "key_type": "Bool", "path": "/Game/Test"
+            })
+            assert_success(result, f"add_blackboard_key ({key})")
+
+        result = test_suite.run_command("get_save_status", {})
+        assert_success(result, "get_save_status")
+        assert_response_has(result, "pending", 1)
+
+        result = test_suite.run_command("flush_saves", {})
+        assert_success(result, "flush_saves")
+        assert_response_has(result, "pending", 0)
+        assert len(result.response["result"]["saved"]) == 1
+
+    def test_invalid_policy(self, test_suite):
+        """不正なポリシー名はエラーになる"""
+        result = test_suite.run_command("set_save_policy", {"policy": "sometimes"}, expected_success=False)
+        assert_error_code(result, 1005, "set_save_policy (invalid)")
+
+    def test_save_packages_reports_per_package(self, test_suite, unique_name):
+        """save_packages はパッケージごとのサイズと時間を返す"""
+        names = [unique_name("BB_SaveConcurrent") for _ in range(3)]
+
+        result = test_suite.run_command("set_save_policy", {"policy": "manual"})
+        assert_success(result, "set_save_policy (manual)")
+        test_suite.add_cleanup("set_save_policy", {"policy": "immediate"})
+
+        for name in names:
+            result = test_suite.run_command("create_blackboard", {"name": name, "path": "/Game/Test"})
+            assert_success(result, "create_blackboard")
+            test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{name}"})
+
+        result = test_suite.run_command("save_packages", {
+            "packages": [f"/Game/Test/{name}" for name in names]
+        })
+        assert_success(result, "save_packages")
+
+        packages = result.response["result"]["packages"]
+        assert len(packages) == 3
+        for entry in packages:
+            assert entry["success"]
+            assert entry["bytes"] > 0
+        assert_response_has(result, "pending", 0)
+
+
+@pytest.mark.bridge
+class TestCompilePolicy:
+    """set_compile_policy / compile_pending テスト"""
+
+    def test_deferred_compile_coalesces(self, test_suite, unique_name):
+        """deferred ポリシーでは同じ Widget への複数編集が 1 回のコンパイルにまとまる"""
+        widget_name = unique_name("WBP_CompileQueue")
+
+        result = test_suite.run_command("create_umg_widget_blueprint", {
+            "widget_name": widget_name,
+            "path": "/Game/Test"
+        })
+        assert_success(result, "create_umg_widget_blueprint")
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{widget_name}"})
+
+        result = test_suite.run_command("set_compile_policy", {"policy": "deferred", "idle_seconds": 60})
+        assert_success(result, "set_compile_policy (deferred)")
+        test_suite.add_cleanup("set_compile_policy", {"policy": "immediate"})
+
+        for index in range(3):
+            result = test_suite.run_command("add_text_to_widget", {
+                "widget_name": widget_name,
+                "text_name": f"Text{index}",
+                "text": f"Line {index}",
+                "path": "/Game/Test"
+            })
+            assert_success(result, f"add_text_to_widget ({index})")
+
+        result = test_suite.run_command("get_compile_status", {})
+        assert_success(result, "get_compile_status")
+        assert_response_has(result, "pending", 1)
+
+        result = test_suite.run_command("compile_pending", {})
+        assert_success(result, "compile_pending")
+        assert_response_has(result, "pending", 0)
+        assert len(result.response["result"]["compiled"]) == 1
+
+
+@pytest.mark.bridge
+class TestAssetResolverCache:
+    """解決済みアセットキャッシュ テスト"""
+
+    def test_repeated_lookup_hits_cache(self, test_suite, unique_name):
+        """同じ Blueprint への連続コマンドは 2 回目以降キャッシュヒットになる"""
+        bp_name = unique_name("BP_ResolverCache")
+
+        result = test_suite.run_command("create_blueprint", {
+            "name": bp_name,
+            "parent_class": "Actor",
+            "path": "/Game/Test"
+        })
+        assert_success(result, "create_blueprint")
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{bp_name}"})
+
+        result = test_suite.run_command("get_asset_cache_status", {"clear": True})
+        assert_success(result, "get_asset_cache_status (clear)")
+
+        for _ in range(3):
+            result = test_suite.run_command("compile_blueprint", {
+                "blueprint_name": bp_name,
+                "path": "/Game/Test"
+            })
+            assert_success(result, "compile_blueprint")
+
+        result = test_suite.run_command("get_asset_cache_status", {})
+        assert_success(result, "get_asset_cache_status")
+        assert_response_has(result, "misses", 1)
+        assert_response_has(result, "hits", 2)
+
+    def test_rename_invalidates_entry(self, test_suite, unique_name):
+        """リネームでキャッシュ済みエントリが破棄され、新名で解決できる"""
+        bp_name = unique_name("BP_ResolverRename")
+        new_name = unique_name("BP_ResolverRenamed")
+
+        test_suite.run_command("create_blueprint", {
+            "name": bp_name,
+            "parent_class": "Actor",
+            "path": "/Game/Test"
+        })
+        result = test_suite.run_command("compile_blueprint", {
+            "blueprint_name": bp_name,
+            "path": "/Game/Test"
+        })
+        assert_success(result, "compile_blueprint (旧名)")
+
+        result = test_suite.run_command("rename_asset", {
+            "old_path": f"/Game/Test/{bp_name}",
+            "new_name": new_name
+        })
+        assert_success(result, "rename_asset")
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{new_name}"})
+
+        result = test_suite.run_command("compile_blueprint", {
+            "blueprint_name": new_name,
+            "path": "/Game/Test"
+        })
+        assert_success(result, "compile_blueprint (新名)")
+
+    def test_added_asset_invalidates_entry(self, test_suite, unique_name):
+        """キャッシュ済みの名前で後からアセットを作るとエントリが破棄され、新しいアセットで解決される"""
+        bp_name = unique_name("BP_ResolverAdded")
+
+        result = test_suite.run_command("create_blueprint", {
+            "name": bp_name,
+            "parent_class": "Actor",
+            "path": "/Game/Test"
+        })
+        assert_success(result, "create_blueprint (/Game/Test)")
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{bp_name}"})
+
+        # /Game/Test/Added には無いので名前インデックス経由で /Game/Test の方がキャッシュされる
+        result = test_suite.run_command("compile_blueprint", {
+            "blueprint_name": bp_name,
+            "path": "/Game/Test/Added"
+        })
+        assert_success(result, "compile_blueprint (フォールバック)")
+
+        result = test_suite.run_command("get_asset_cache_status", {})
+        assert_success(result, "get_asset_cache_status")
+        invalidations_before = result.response["result"]["invalidations"]
+
+        result = test_suite.run_command("create_blueprint", {
+            "name": bp_name,
+            "parent_class": "Actor",
+            "path": "/Game/Test/Added"
+        })
+        assert_success(result, "create_blueprint (/Game/Test/Added)")
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/Added/{bp_name}"})
+
+        result = test_suite.run_command("get_asset_cache_status", {})
+        assert_success(result, "get_asset_cache_status")
+        assert result.response["result"]["invalidations"] > invalidations_before
+
+        result = test_suite.run_command("compile_blueprint", {
+            "blueprint_name": bp_name,
+            "path": "/Game/Test/Added"
+        })
+        assert_success(result, "compile_blueprint (作成後)")
+
+    def test_name_index_resolves_without_path(self, test_suite, unique_name):
+        """パスが違っても名前インデックスで一意に解決でき、重複名は 1106 エラーになる"""
+        bp_name = unique_name("BP_NameIndex")
+
+        for folder in ("/Game/Test", "/Game/Test/NameIndex"):
+            result = test_suite.run_command("create_blueprint", {
+                "name": bp_name,
+                "parent_class": "Actor",
+                "path": folder
+            })
+            assert_success(result, f"create_blueprint ({folder})")
+            test_suite.add_cleanup("delete_asset", {"asset_path": f"{folder}/{bp_name}"})
+
+            if folder == "/Game/Test":
+                # 既定パス /Game/Blueprints には無いが一意なので解決できる
+                result = test_suite.run_command("compile_blueprint", {"blueprint_name": bp_name})
+                assert_success(result, "compile_blueprint (パス省略)")
+
+        result = test_suite.run_command("find_assets_by_name", {"name": bp_name, "class_name": "Blueprint"})
+        assert_success(result, "find_assets_by_name")
+        assert_response_has(result, "ambiguous", True)
+        assert len(result.response["result"]["assets"]) == 2
+
+        result = test_suite.run_command("compile_blueprint", {
+            "blueprint_name": bp_name,
+            "path": "/Game/Blueprints/Missing"
+        }, expected_success=False)
+        assert_error_code(result, 1106)
+
+        # パス省略の解決結果はキャッシュ済みだが、2 つ目の追加で破棄されて曖昧エラーになる
+        result = test_suite.run_command("compile_blueprint", {"blueprint_name": bp_name}, expected_success=False)
+        assert_error_code(result, 1106)
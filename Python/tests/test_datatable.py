@@ -0,0 +1,91 @@
+"""
+DataTable操作のテストスイート
+
+DataTable行の一括Upsertのテスト
+"""
+
+import pytest
+from test_framework import assert_success, assert_response_has, assert_error_code
+
+
+@pytest.mark.datatable
+class TestDataTableUpsert:
+    """upsert_datatable_rows テスト"""
+
+    def test_upsert_datatable_rows(self, test_suite, unique_name):
+        """DataTable行の一括Upsert（新規作成→更新・追加・行単位エラー）"""
+        table_name = unique_name("DT_Upsert")
+
+        result = test_suite.run_command("upsert_datatable_rows", {
+            "datatable_name": table_name,
+            "path": "/Game/Test",
+            "row_struct": "GameplayTagTableRow",
+            "rows": [
+                {"Name": "Row1", "DevComment": "first"},
+                {"Name": "Row2", "DevComment": "second"}
+            ]
+        })
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{table_name}"})
+
+        assert_success(result, "DataTable作成と行追加")
+        assert_response_has(result, "created", True)
+        assert_response_has(result, "inserted", 2)
+
+        result = test_suite.run_command("upsert_datatable_rows", {
+            "datatable_name": table_name,
+            "path": "/Game/Test",
+            "csv": "Name,DevComment\nRow1,updated\nRow3,third\n,no name\n"
+        })
+
+        assert_success(result, "CSVによる行Upsert")
+        assert_response_has(result, "updated", 1)
+        assert_response_has(result, "inserted", 1)
+        assert_response_has(result, "failed", 1)
+        assert_response_has(result, "row_count", 3)
+
+        # 失敗した行もremove_missingでは削除されない
+        result = test_suite.run_command("upsert_datatable_rows", {
+            "datatable_name": table_name,
+            "path": "/Game/Test",
+            "rows": [{"Name": "Row2", "Tag": 123}],
+            "remove_missing": True
+        })
+
+        assert_success(result, "失敗行を含むremove_missing")
+        assert_response_has(result, "failed", 1)
+        assert_response_has(result, "removed", 2)
+        assert_response_has(result, "row_count", 1)
+
+    def test_malformed_json_file_leaves_table_untouched(self, test_suite, unique_name, tmp_path):
+        """途中で壊れたJSONファイルは行を一切適用せずエラー"""
+        table_name = unique_name("DT_Malformed")
+
+        result = test_suite.run_command("upsert_datatable_rows", {
+            "datatable_name": table_name,
+            "path": "/Game/Test",
+            "row_struct": "GameplayTagTableRow",
+            "rows": [{"Name": "Row1", "DevComment": "original"}]
+        })
+        test_suite.add_cleanup("delete_asset", {"asset_path": f"/Game/Test/{table_name}"})
+        assert_success(result, "DataTable作成")
+
+        file_path = tmp_path / "rows.json"
+        file_path.write_text('[{"Name": "Row1", "DevComment": "changed"}, {"Name": "Row2"}, 5]', encoding="utf-8")
+
+        result = test_suite.run_command("upsert_datatable_rows", {
+            "datatable_name": table_name,
+            "path": "/Game/Test",
+            "file_path": str(file_path)
+        }, expected_success=False)
+        assert_error_code(result, 1005)
+
+        # 構造エラーより前の行(Row2)も追加されていない
+        result = test_suite.run_command("upsert_datatable_rows", {
+            "datatable_name": table_name,
+            "path": "/Game/Test",
+            "rows": [{"Name": "Row1", "DevComment": "original"}],
+            "dry_run": True
+        })
+        assert_success(result, "dry_run")
+        assert_response_has(result, "row_count", 1)
+
@@ -0,0 +1,239 @@
+"""
+レベル一括操作のテストスイート
+
+HISMインスタンス化などのレベル一括操作のテスト
+"""
+
+import shutil
+import struct
+
+import pytest
+from test_framework import assert_success, assert_response_has, assert_error_code
+from level_snapshot import LevelSnapshot
+
+
+CUBE_MESH = "/Engine/BasicShapes/Cube.Cube"
+
+
+def spawn_mesh_actors(test_suite, prefix: str, count: int):
+    """Cubeメッシュ付きStaticMeshActorを並べて生成"""
+    names = []
+    for i in range(count):
+        name = f"{prefix}_{i}"
+        test_suite.run_command("spawn_actor", {
+            "name": name,
+            "type": "StaticMeshActor",
+            "location": [i * 200.0, 0.0, 0.0]
+        })
+        test_suite.run_command("set_actor_property", {
+            "name": name,
+            "component_name": "StaticMeshComponent0",
+            "property_name": "StaticMesh",
+            "property_value": CUBE_MESH
+        })
+        names.append(name)
+    return names
+
+
+@pytest.mark.level
+class TestConsolidateToInstances:
+    """consolidate_to_instances テスト"""
+
+    def test_consolidate_dry_run(self, test_suite, unique_name):
+        """dry_runではレベルを変更しない"""
+        names = spawn_mesh_actors(test_suite, unique_name("SM_Dry"), 3)
+        for name in names:
+            test_suite.add_cleanup("delete_actor", {"name": name})
+
+        result = test_suite.run_command("consolidate_to_instances", {
+            "filter": {"names": names},
+            "dry_run": True
+        })
+
+        assert_success(result, "consolidate_to_instances (dry_run)")
+        assert_response_has(result, "actors_consolidated", 3)
+        assert_response_has(result, "instances_created", 0)
+
+    def test_consolidate_creates_hism_actor(self, test_suite, unique_name):
+        """同一メッシュのアクターが1つのHISMアクターにまとめられる"""
+        names = spawn_mesh_actors(test_suite, unique_name("SM_Inst"), 3)
+
+        result = test_suite.run_command("consolidate_to_instances", {
+            "filter": {"names": names},
+            "name_prefix": unique_name("HISM")
+        })
+
+        assert_success(result, "consolidate_to_instances")
+        assert_response_has(result, "instances_created", 3)
+
+        groups = result.response["result"]["groups"]
+        assert len(groups) == 1
+        test_suite.add_cleanup("delete_actor", {"name": groups[0]["actor_name"]})
+
+    def test_consolidate_keep_originals_counts(self, test_suite, unique_name):
+        """delete_originals=Falseでは残した元アクターのコンポーネントもcomponents_afterに数える"""
+        names = spawn_mesh_actors(test_suite, unique_name("SM_Keep"), 3)
+        for name in names:
+            test_suite.add_cleanup("delete_actor", {"name": name})
+
+        result = test_suite.run_command("consolidate_to_instances", {
+            "filter": {"names": names},
+            "name_prefix": unique_name("HISM"),
+            "delete_originals": False
+        })
+
+        assert_success(result, "consolidate_to_instances (delete_originals=False)")
+        groups = result.response["result"]["groups"]
+        assert len(groups) == 1
+        test_suite.add_cleanup("delete_actor", {"name": groups[0]["actor_name"]})
+
+        data = result.response["result"]
+        # 元アクターはそのまま残り、HISMアクターのコンポーネントが1つ増える
+        assert data["components_after"] == data["components_before"] + 1
+        assert data["level_actors_after"] == data["level_actors_before"] + 1
+
+
+@pytest.mark.level
+class TestUpdateActorsWhere:
+    """update_actors_where テスト"""
+
+    def test_update_component_property(self, test_suite, unique_name):
+        """フィルタに一致する全アクターのコンポーネントプロパティを一括変更"""
+        names = spawn_mesh_actors(test_suite, unique_name("SM_Upd"), 3)
+        for name in names:
+            test_suite.add_cleanup("delete_actor", {"name": name})
+
+        result = test_suite.run_command("update_actors_where", {
+            "filter": {"names": names},
+            "component_properties": [
+                {"component_class": "StaticMeshComponent", "properties": {"CastShadow": False}}
+            ]
+        })
+
+        assert_success(result, "update_actors_where")
+        assert_response_has(result, "matched", 3)
+        assert_response_has(result, "succeeded", 3)
+        assert_response_has(result, "failed", 0)
+
+    def test_update_reports_missing_property(self, test_suite, unique_name):
+        """存在しないプロパティはアクターごとの失敗として報告される"""
+        names = spawn_mesh_actors(test_suite, unique_name("SM_Miss"), 2)
+        for name in names:
+            test_suite.add_cleanup("delete_actor", {"name": name})
+
+        result = test_suite.run_command("update_actors_where", {
+            "filter": {"names": names},
+            "properties": {"NoSuchProperty": 1}
+        })
+
+        assert_success(result, "update_actors_where (missing property)")
+        assert_response_has(result, "failed", 2)
+
+    def test_update_requires_filter_criterion(self, test_suite):
+        """条件のないフィルタや未知のキーではレベル全体を変更しない"""
+        for filter_value in ({}, {"nmaes": ["Nothing"]}):
+            result = test_suite.run_command("update_actors_where", {
+                "filter": filter_value,
+                "properties": {"bHidden": True}
+            }, expected_success=False)
+            assert_error_code(result, 1003 if not filter_value else 1005)
+
+
+@pytest.mark.level
+class TestGetPropertiesBatch:
+    """get_properties_batch テスト"""
+
+    def test_read_properties_table(self, test_suite, unique_name):
+        """フィルタに一致するアクターのプロパティを表形式で取得"""
+        names = spawn_mesh_actors(test_suite, unique_name("SM_Read"), 2)
+        for name in names:
+            test_suite.add_cleanup("delete_actor", {"name": name})
+
+        result = test_suite.run_command("get_properties_batch", {
+            "filter": {"names": names},
+            "properties": ["bHidden", "PrimaryActorTick.TickInterval", "NoSuchProperty"]
+        })
+
+        assert_success(result, "get_properties_batch")
+        assert_response_has(result, "count", 2)
+        data = result.response["result"]
+        assert data["columns"] == ["object", "bHidden", "PrimaryActorTick.TickInterval", "NoSuchProperty"]
+        assert all(len(row) == 4 and row[3] is None for row in data["rows"])
+        assert len(data["errors"]) == 1
+
+    def test_diff_from_defaults(self, test_suite, unique_name):
+        """diff_from_defaultsではCDOと同じ値がnullになる"""
+        names = spawn_mesh_actors(test_suite, unique_name("SM_Diff"), 1)
+        test_suite.add_cleanup("delete_actor", {"name": names[0]})
+
+        result = test_suite.run_command("get_properties_batch", {
+            "filter": {"names": names},
+            "properties": ["bHidden"],
+            "diff_from_defaults": True
+        })
+
+        assert_success(result, "get_properties_batch (diff_from_defaults)")
+        assert result.response["result"]["rows"][0][1] is None
+
+
+@pytest.mark.level
+class TestLevelSnapshot:
+    """export_level_snapshot テスト"""
+
+    def test_export_and_read_snapshot(self, test_suite, unique_name, tmp_path):
+        """スナップショットを書き出し、Pythonリーダーで読み込める"""
+        names = spawn_mesh_actors(test_suite, unique_name("SM_Snap"), 2)
+        for name in names:
+            test_suite.add_cleanup("delete_actor", {"name": name})
+
+        file_path = str(tmp_path / "snapshot.sbls")
+        result = test_suite.run_command("export_level_snapshot", {"file_path": file_path})
+        assert_success(result, "export_level_snapshot")
+
+        with LevelSnapshot.open(file_path) as snap:
+            assert len(snap) == result.response["result"]["actor_count"]
+            actors = {a["name"]: a for a in snap.actors()}
+            for name in names:
+                assert name in actors
+                assert actors[name]["mesh"] == CUBE_MESH
+
+    def test_diff_detects_added_and_moved(self, test_suite, unique_name, tmp_path):
+        """スナップショット差分で追加・移動したアクターを検出"""
+        moved_name = spawn_mesh_actors(test_suite, unique_name("SM_Move"), 1)[0]
+        test_suite.add_cleanup("delete_actor", {"name": moved_name})
+
+        file_path = str(tmp_path / "before.sbls")
+        assert_success(test_suite.run_command("export_level_snapshot", {"file_path": file_path}),
+                       "export_level_snapshot")
+
+        added_name = spawn_mesh_actors(test_suite, unique_name("SM_Add"), 1)[0]
+        test_suite.add_cleanup("delete_actor", {"name": added_name})
+        test_suite.run_command("set_actor_transform", {"name": moved_name, "location": [0.0, 500.0, 0.0]})
+
+        result = test_suite.run_command("diff_level_snapshots", {"snapshot_a": file_path})
+
+        assert_success(result, "diff_level_snapshots")
+        diff = result.response["result"]
+        assert added_name in [a["name"] for a in diff["added"]]
+        assert moved_name in [a["name"] for a in diff["moved"]]
+
+    def test_diff_rejects_different_maps(self, test_suite, tmp_path):
+        """マップ名が異なるスナップショットの差分はallow_map_mismatchなしでエラー"""
+        file_a = str(tmp_path / "map_a.sbls")
+        assert_success(test_suite.run_command("export_level_snapshot", {"file_path": file_a}),
+                       "export_level_snapshot")
+
+        # ヘッダーのmap_name(文字列インデックス, オフセット20)を空文字列(0)に書き換え
+        file_b = str(tmp_path / "map_b.sbls")
+        shutil.copyfile(file_a, file_b)
+        with open(file_b, "r+b") as f:
+            f.seek(20)
+            f.write(struct.pack("<I", 0))
+
+        params = {"snapshot_a": file_a, "snapshot_b": file_b}
+        result = test_suite.run_command("diff_level_snapshots", params, expected_success=False)
+        assert_error_code(result, 1005)
+
+        result = test_suite.run_command("diff_level_snapshots", {**params, "allow_map_mismatch": True})
+        assert_success(result, "diff_level_snapshots")
+        assert result.response["result"]["added_count"] == 0
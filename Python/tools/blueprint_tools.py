@@ -388,6 +388,71 @@ def register_blueprint_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def compile_blueprints_batch(
+        ctx: Context,
+        blueprints: List[str] = None,
+        path: str = "/Game/Blueprints",
+        folder: str = "",
+        recursive: bool = True,
+        dirty_only: bool = False,
+        mode: str = "batch",
+        include_messages: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Compile many Blueprints in one compilation-manager pass.
+
+        Shared work (skeleton regeneration, reinstancing of common dependencies) is done once
+        for the whole set instead of once per Blueprint.
+
+        Args:
+            blueprints: Blueprint names (resolved under path) or full asset paths ("/Game/...")
+            path: Content browser path used for short names
+            folder: Compile every Blueprint under this content folder
+            recursive: Include subfolders of folder
+            dirty_only: Only compile Blueprints that are out of date or have unsaved changes.
+                        Without blueprints/folder, scans all loaded Blueprints
+            mode: "batch" (one pass, elapsed_ms is the shared pass time) or
+                  "sequential" (one pass per Blueprint, individual elapsed_ms)
+            include_messages: Include warning/error message text per Blueprint
+
+        Returns:
+            Dict with per-Blueprint status, warnings and time, compiled/failed counts and not_found
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "path": path,
+                "recursive": recursive,
+                "dirty_only": dirty_only,
+                "mode": mode,
+                "include_messages": include_messages
+            }
+            if blueprints is not None:
+                params["blueprints"] = blueprints
+            if folder:
+                params["folder"] = folder
+
+            logger.info(f"Compiling blueprints batch: {params}")
+            response = unreal.send_command("compile_blueprints_batch", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            return response
+
+        except Exception as e:
+            error_msg = f"Error compiling blueprints batch: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     @mcp.tool()
     def set_blueprint_property(
         ctx: Context,
@@ -584,23 +649,45 @@ def register_blueprint_tools(mcp: FastMCP):
     def get_blueprint_graph(
         ctx: Context,
         blueprint_name: str,
-        path: str = "/Game/Blueprints"
+        path: str = "/Game/Blueprints",
+        graphs: List[str] = None,
+        include_pins: bool = True,
+        include_pin_defaults: bool = False,
+        include_titles: bool = False,
+        if_none_match: Dict[str, str] = None
     ) -> Dict[str, Any]:
         """
         Get the node graph structure of an existing Blueprint.
 
+        Covers the event graph pages, function graphs and macro graphs. Every graph
+        carries a content hash; pass the hashes from a previous call in
+        if_none_match and graphs that have not changed come back as
+        {"status": "unchanged"} without nodes or connections.
+
         Args:
             blueprint_name: Name of the Blueprint to analyze
             path: Content browser path where the Blueprint is located (default: "/Game/Blueprints")
+            graphs: Only return these graphs by name (default: all)
+            include_pins: Include the pin list of each node (default: True)
+            include_pin_defaults: Include default values of unconnected input pins (default: False)
+            include_titles: Include display titles; slow on large graphs (default: False)
+            if_none_match: {graph_name: hash} from a previous call
 
         Returns:
-            dict: Result containing nodes, connections, variables, and components
+            dict: Result containing graphs (name, graph_type, hash, status, nodes,
+                  connections), unchanged_count, variables, and components
 
         Example:
-            get_blueprint_graph(
+            first = get_blueprint_graph(
                 blueprint_name="BP_Enemy",
                 path="/Game/Blueprints/Characters"
             )
+            hashes = {g["name"]: g["hash"] for g in first["result"]["graphs"]}
+            get_blueprint_graph(
+                blueprint_name="BP_Enemy",
+                path="/Game/Blueprints/Characters",
+                if_none_match=hashes
+            )
         """
         from unreal_mcp_server import get_unreal_connection
 
@@ -612,8 +699,15 @@ def register_blueprint_tools(mcp: FastMCP):
 
             params = {
                 "blueprint_name": blueprint_name,
-                "path": path
+                "path": path,
+                "include_pins": include_pins,
+                "include_pin_defaults": include_pin_defaults,
+                "include_titles": include_titles
             }
+            if graphs:
+                params["graphs"] = graphs
+            if if_none_match:
+                params["if_none_match"] = if_none_match
 
             response = unreal.send_command("get_blueprint_graph", params)
             return response
@@ -632,11 +726,16 @@ def register_blueprint_tools(mcp: FastMCP):
         path_filter: str = None,
         include_engine: bool = False,
         exclude_reinst: bool = True,
-        blueprint_type: str = None
+        blueprint_type: str = None,
+        offset: int = 0,
+        limit: int = 0
     ) -> Dict[str, Any]:
         """
         Scan the project for C++ classes and Blueprint assets.
 
+        Results are cached per filter set and only rebuilt after a module load,
+        hot reload or Blueprint asset change, so repeat scans are cheap.
+
         This is useful for discovering available classes to inherit from,
         finding existing Blueprints, or understanding the project structure.
 
@@ -658,6 +757,8 @@ def register_blueprint_tools(mcp: FastMCP):
                 - "character": Character Blueprints
                 - "pawn": Pawn Blueprints
                 - None: No filter (default)
+            offset: Skip this many entries of each list (default: 0)
+            limit: Return at most this many entries of each list (default: 0 = all)
 
         Returns:
             Dict containing:
@@ -665,6 +766,8 @@ def register_blueprint_tools(mcp: FastMCP):
             - blueprints: List of Blueprint assets with name, path, parent
             - total_cpp: Count of C++ classes found
             - total_blueprints: Count of Blueprints found
+            - has_more: True when a later page has more entries
+            - cached: True when served from the cached scan
 
         Examples:
             # Get all project classes (excluding REINST by default)
@@ -685,6 +788,9 @@ def register_blueprint_tools(mcp: FastMCP):
 
             # Include REINST classes (for debugging)
             scan_project_classes(exclude_reinst=False)
+
+            # Page through Blueprints 100 at a time
+            scan_project_classes(class_type="blueprint", offset=100, limit=100)
         """
         from unreal_mcp_server import get_unreal_connection
 
@@ -703,6 +809,10 @@ def register_blueprint_tools(mcp: FastMCP):
                 params["path_filter"] = path_filter
             if blueprint_type:
                 params["blueprint_type"] = blueprint_type
+            if offset:
+                params["offset"] = offset
+            if limit:
+                params["limit"] = limit
 
             unreal = get_unreal_connection()
             if not unreal:
@@ -724,6 +834,222 @@ def register_blueprint_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def search_blueprints(
+        ctx: Context,
+        query: str,
+        path: str = "",
+        offset: int = 0,
+        limit: int = 50,
+        wait: bool = True,
+        rebuild: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Find Blueprints that call a function, use a variable or contain a node, without loading them.
+
+        Searches the Find-in-Blueprints metadata stored in asset registry tags. The index
+        is built in the background at editor start and updated when Blueprints are saved.
+        Tokens are case-insensitive identifier words; all terms must match, and a
+        trailing * matches by prefix. Blueprints never saved by this engine version
+        have no search data and match by asset name only (see without_search_data).
+
+        Args:
+            query: Search terms, e.g. "GetAllActorsOfClass" or "Health Apply*"
+            path: Only Blueprints under this content path (default: all)
+            offset: Pagination offset (default: 0)
+            limit: Maximum number of results (default: 50, 0 for all)
+            wait: Wait for a running index build instead of using the previous index (default: True)
+            rebuild: Rebuild the index from the asset registry first (default: False)
+
+        Returns:
+            dict: results (name, path, parent, matched tokens), total, has_more,
+                  indexing, indexed_count, without_search_data, elapsed_ms
+
+        Example:
+            search_blueprints(query="GetAllActorsOfClass", path="/Game/Characters")
+            search_blueprints(query="Damage*", offset=50, limit=50)
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "query": query,
+                "offset": offset,
+                "limit": limit,
+                "wait": wait,
+                "rebuild": rebuild
+            }
+            if path:
+                params["path"] = path
+
+            response = unreal.send_command("search_blueprints", params)
+            return response
+
+        except Exception as e:
+            error_msg = f"Error searching blueprints: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def analyze_blueprint_performance(
+        ctx: Context,
+        blueprint_name: str = "",
+        path: str = "/Game/Blueprints",
+        blueprints: List[str] = None,
+        folder: str = "",
+        recursive: bool = True,
+        parent_class: str = "",
+        min_severity: str = "info",
+        include_clean: bool = False,
+        parallel: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Flag expensive runtime patterns in Blueprints and estimate per-tick node counts.
+
+        Rules: event_tick (connected Tick event, with per-tick node estimate),
+        empty_tick, expensive_call (GetAllActorsOfClass and friends in tick or loops),
+        cast_in_hot_path, spawn_in_hot_path, loop_in_tick, and actor/component_tick_unused
+        (Can Ever Tick on with no Tick implementation). Graphs are read in parallel.
+
+        Args:
+            blueprint_name: Single Blueprint to analyze (resolved under path)
+            path: Content browser path used for short names
+            blueprints: Blueprint names or full asset paths ("/Game/...")
+            folder: Analyze every Blueprint under this content folder
+            recursive: Include subfolders of folder
+            parent_class: Only Blueprints derived from this class (with folder, or all of /Game)
+            min_severity: "info", "warning" or "error"
+            include_clean: Also list Blueprints without findings
+            parallel: Analyze Blueprints on worker threads (default: True)
+
+        Returns:
+            dict: blueprints (findings with rule, severity, message, graph, node_id, component;
+                  tick_events with per_tick_nodes), analyzed, clean, findings_by_severity,
+                  ticking_actors, ticking_components, not_found, elapsed_ms
+
+        Example:
+            analyze_blueprint_performance(folder="/Game/Characters", min_severity="warning")
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "path": path,
+                "recursive": recursive,
+                "min_severity": min_severity,
+                "include_clean": include_clean,
+                "parallel": parallel
+            }
+            if blueprint_name:
+                params["blueprint_name"] = blueprint_name
+            if blueprints:
+                params["blueprints"] = blueprints
+            if folder:
+                params["folder"] = folder
+            if parent_class:
+                params["parent_class"] = parent_class
+
+            response = unreal.send_command("analyze_blueprint_performance", params)
+            return response
+
+        except Exception as e:
+            error_msg = f"Error analyzing blueprint performance: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def set_tick_policy_batch(
+        ctx: Context,
+        actor: Dict[str, Any] = None,
+        components: Dict[str, Any] = None,
+        blueprint_name: str = "",
+        path: str = "/Game/Blueprints",
+        blueprints: List[str] = None,
+        folder: str = "",
+        recursive: bool = True,
+        parent_class: str = "",
+        compile: bool = True,
+        dry_run: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Change actor and component tick settings across many Blueprints in one pass.
+
+        Settings go to each Blueprint's class defaults (actor tick, or component tick for
+        component Blueprints) and to the component templates added in the Blueprint.
+        Inherited components are edited in the Blueprint that adds them. Edited Blueprints
+        are compiled in one pass and saved in one flush.
+
+        Args:
+            actor: Actor tick settings: enabled (Can Ever Tick), start_enabled,
+                   interval (seconds, 0 = every frame), tick_group ("PrePhysics",
+                   "DuringPhysics", "PostPhysics", "PostUpdateWork", ...)
+            components: Component tick settings (same keys), plus optional
+                        component_class (only templates of this class) and
+                        only_unused (only components whose class has no Tick implementation)
+            blueprint_name: Single Blueprint (resolved under path)
+            path: Content browser path used for short names
+            blueprints: Blueprint names or full asset paths ("/Game/...")
+            folder: Every Blueprint under this content folder
+            recursive: Include subfolders of folder
+            parent_class: Only Blueprints derived from this class
+            compile: Compile edited Blueprints (default: True)
+            dry_run: Report what would change without editing
+
+        Returns:
+            dict: before / after counts (actors/components that can ever tick and start enabled),
+                  blueprints with per-target changed fields, matched, modified, not_found,
+                  compiled / compile_failures, elapsed_ms
+
+        Example:
+            set_tick_policy_batch(folder="/Game/Props", actor={"enabled": False},
+                                  components={"enabled": False, "only_unused": True})
+            set_tick_policy_batch(parent_class="BP_EnemyBase", actor={"interval": 0.1})
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "path": path,
+                "recursive": recursive,
+                "compile": compile,
+                "dry_run": dry_run
+            }
+            if actor:
+                params["actor"] = actor
+            if components:
+                params["components"] = components
+            if blueprint_name:
+                params["blueprint_name"] = blueprint_name
+            if blueprints:
+                params["blueprints"] = blueprints
+            if folder:
+                params["folder"] = folder
+            if parent_class:
+                params["parent_class"] = parent_class
+
+            response = unreal.send_command("set_tick_policy_batch", params)
+            return response
+
+        except Exception as e:
+            error_msg = f"Error setting tick policy: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     @mcp.tool()
     def set_blueprint_class_array(
         ctx: Context,
@@ -1387,6 +1713,104 @@ def register_blueprint_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def upsert_datatable_rows(
+        ctx: Context,
+        datatable_name: str,
+        path: str = "/Game/Data",
+        row_struct: str = "",
+        file_path: str = "",
+        rows: Optional[Any] = None,
+        csv: str = "",
+        format: str = "",
+        key_field: str = "Name",
+        remove_missing: bool = False,
+        dry_run: bool = False,
+        max_errors: int = 100
+    ) -> Dict[str, Any]:
+        """
+        Insert or update many DataTable rows in one call and save the table once.
+
+        Rows come from exactly one source: a CSV/JSON file on disk (read in chunks,
+        so large balance sheets are fine), inline CSV text, or inline JSON rows.
+        Existing rows are updated in place; only the given fields change. A row with
+        a bad value is skipped and reported, the rest are still applied. A JSON file
+        whose array structure is malformed is rejected before any row is applied.
+
+        Args:
+            datatable_name: Name of the DataTable (e.g., "DT_Weapons")
+            path: Content browser path of the DataTable (default: "/Game/Data")
+            row_struct: Row struct name or path (e.g., "WeaponRow", "/Game/Data/S_Weapon.S_Weapon").
+                        Required to create the table when it does not exist
+            file_path: CSV or JSON file, absolute or relative to the project directory.
+                       JSON files use the DataTable export format: [{"Name": "Row_1", ...}, ...]
+            rows: Inline rows - a list of objects with a key_field, or {"RowName": {...}}
+            csv: Inline CSV text; the first line is the header
+            format: "csv" or "json"; defaults to the file extension
+            key_field: Column holding the row name (CSV falls back to the first column)
+            remove_missing: Remove rows that are not in the input (rows that fail to import are kept)
+            dry_run: Validate every row without changing or creating the table
+            max_errors: Maximum number of per-row errors to return
+
+        Returns:
+            Dict with inserted/updated/failed/removed counts, row_count and per-row errors
+            ({"row", "name", "column", "message"})
+
+        Example:
+            upsert_datatable_rows(
+                datatable_name="DT_Weapons",
+                row_struct="WeaponRow",
+                file_path="Data/Balance/weapons.csv"
+            )
+
+            upsert_datatable_rows(
+                datatable_name="DT_Weapons",
+                rows=[{"Name": "Pistol", "Damage": 12}, {"Name": "Rifle", "Damage": 30}]
+            )
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "datatable_name": datatable_name,
+                "path": path,
+                "key_field": key_field,
+                "remove_missing": remove_missing,
+                "dry_run": dry_run,
+                "max_errors": max_errors
+            }
+            if row_struct:
+                params["row_struct"] = row_struct
+            if file_path:
+                params["file_path"] = file_path
+            if rows is not None:
+                params["rows"] = rows
+            if csv:
+                params["csv"] = csv
+            if format:
+                params["format"] = format
+
+            logger.info(f"Upserting rows into DataTable '{datatable_name}'")
+            response = unreal.send_command("upsert_datatable_rows", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Upsert DataTable rows response: inserted={response.get('inserted')}, "
+                        f"updated={response.get('updated')}, failed={response.get('failed')}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error upserting DataTable rows: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     @mcp.tool()
     def batch_set_properties(
         ctx: Context,
@@ -1456,4 +1880,84 @@ def register_blueprint_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def batch_set_properties_multi(
+        ctx: Context,
+        properties: Dict[str, Any],
+        assets: List[str] = None,
+        folder: str = "",
+        class_name: str = "",
+        parent_class: str = "",
+        recursive: bool = True,
+        compile: bool = True,
+        dry_run: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Apply the same property values to many Blueprints and data assets at once.
+
+        Blueprints are edited through their class defaults (CDO). Edited Blueprints
+        are compiled in one pass and all packages are saved in one flush.
+
+        Args:
+            properties: Dictionary of property names (or nested struct paths) to values
+            assets: Explicit asset object paths or unique asset names; a name shared
+                    by several assets fails the call with AssetAmbiguous (1106) and the candidates
+            folder: Content folder to query (default "/Game" when other query fields are set)
+            class_name: Only assets of this class (e.g. "PrimaryDataAsset", "Blueprint")
+            parent_class: Only Blueprints deriving from this class and data assets of
+                classes deriving from it (e.g. "BP_EnemyBase", "WeaponData")
+            recursive: Include sub-folders (default: True)
+            compile: Compile edited Blueprints (default: True)
+            dry_run: Only list the matched assets
+
+        Returns:
+            Dict containing:
+            - matched / succeeded / failed: Asset counts
+            - assignments_applied: Number of property values written
+            - assets: Per-asset results (or "matched_assets" when dry_run)
+            - not_found: Names in "assets" that did not resolve
+            - compiled / compile_failures: Blueprint compile summary
+
+        Example:
+            batch_set_properties_multi(
+                parent_class="BP_EnemyBase",
+                folder="/Game/Enemies",
+                properties={"MaxHealth": 150.0}
+            )
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "properties": properties,
+                "recursive": recursive,
+                "compile": compile,
+                "dry_run": dry_run
+            }
+            if assets:
+                params["assets"] = assets
+            if folder:
+                params["folder"] = folder
+            if class_name:
+                params["class_name"] = class_name
+            if parent_class:
+                params["parent_class"] = parent_class
+
+            logger.info(f"Batch setting {len(properties)} properties on multiple assets: {params}")
+            response = unreal.send_command("batch_set_properties_multi", params)
+
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            return response
+
+        except Exception as e:
+            error_msg = f"Error batch setting properties on multiple assets: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     logger.info("Blueprint tools registered successfully") 
\ No newline at end of file
@@ -0,0 +1,372 @@
+"""
+Bridge Tools for Unreal MCP.
+
+This module provides tools that control how the bridge itself executes commands:
+batched execution in a single round trip and a single undo transaction, and when
+edited assets are recompiled and written to disk.
+"""
+
+import logging
+from typing import Dict, Any, List
+from mcp.server.fastmcp import FastMCP, Context
+
+logger = logging.getLogger("SpirrowBridge")
+
+
+def register_bridge_tools(mcp: FastMCP):
+    """Register bridge tools with the MCP server."""
+
+    @mcp.tool()
+    def execute_batch(
+        ctx: Context,
+        commands: List[Dict[str, Any]],
+        stop_on_error: bool = True,
+        rollback_on_error: bool = False,
+        compile: bool = True,
+        save: bool = True,
+        include_results: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Run several bridge commands in one round trip and one undo transaction.
+
+        Each entry is {"command": "<command type>", "params": {...}}. A param value
+        that is exactly "$N.field" (N = 0-based index of an earlier entry) is replaced
+        by that field of the earlier result, keeping its JSON type. Nested fields and
+        array elements are reachable with dots: "$0.actors.2.name".
+        Blueprints touched by the batch are compiled once and touched assets are saved
+        once after the last command.
+
+        Args:
+            commands: Ordered list of {"command": str, "params": dict}
+            stop_on_error: Stop at the first failing command (default: True)
+            rollback_on_error: Undo the whole batch transaction if a command failed.
+                               Deferred saves run after the undo, so they store the reverted
+                               state. Undo cannot revert assets that were created, deleted or
+                               renamed, or packages a command saved itself; these are listed
+                               in "irreversible".
+            compile: Compile touched Blueprints at the end (default: True)
+            save: Save touched, dirty assets at the end (default: True, maps are never saved).
+                  With the deferred or manual save policy they are queued instead.
+            include_results: Include each command's full result (default: True)
+
+        Returns:
+            Dict containing:
+            - results: Per-command {index, command, success, result | error, error_code}
+            - succeeded / failed / skipped counts, aborted, rolled_back
+            - irreversible: With rolled_back, the {index, command, reason, asset} steps the
+              undo did not revert (empty when the rollback is complete)
+            - compiled / saved: Blueprints compiled and packages saved at the end
+            - compile_failed: Blueprints that compiled with errors
+            - save_failed, pending_saves: Packages that failed to save / are still queued
+
+        Example:
+            execute_batch(commands=[
+                {"command": "add_branch_node",
+                 "params": {"blueprint_name": "BP_Door", "node_position": [400, 0]}},
+                {"command": "add_print_string_node",
+                 "params": {"blueprint_name": "BP_Door", "message": "Open", "node_position": [700, 0]}},
+                {"command": "connect_blueprint_nodes",
+                 "params": {"blueprint_name": "BP_Door",
+                            "source_node_id": "$0.node_id", "source_pin": "then",
+                            "target_node_id": "$1.node_id", "target_pin": "execute"}}
+            ])
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "commands": commands,
+                "stop_on_error": stop_on_error,
+                "rollback_on_error": rollback_on_error,
+                "compile": compile,
+                "save": save,
+                "include_results": include_results
+            }
+
+            logger.info(f"Executing batch of {len(commands)} commands")
+            response = unreal.send_command("execute_batch", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error executing batch: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def set_save_policy(
+        ctx: Context,
+        policy: str,
+        idle_seconds: float = None
+    ) -> Dict[str, Any]:
+        """
+        Choose when assets edited by bridge commands are written to disk.
+
+        - immediate: every command saves its asset (default)
+        - deferred: commands only mark packages dirty; the dirty set is saved once the
+          bridge has been idle for idle_seconds, or by flush_saves
+        - manual: commands only mark packages dirty; only flush_saves writes
+
+        Fifty edits of the same asset cost one save under deferred or manual.
+        Switching back to immediate flushes anything still pending.
+
+        Args:
+            policy: "immediate", "deferred" or "manual"
+            idle_seconds: Idle time before a deferred flush (default: 2.0)
+
+        Returns:
+            Dict containing policy, idle_seconds, pending and pending_packages
+
+        Example:
+            set_save_policy(policy="manual")
+            # ... many edits ...
+            flush_saves()
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {"policy": policy}
+            if idle_seconds is not None:
+                params["idle_seconds"] = idle_seconds
+
+            response = unreal.send_command("set_save_policy", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error setting save policy: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def flush_saves(ctx: Context, concurrent: bool = True) -> Dict[str, Any]:
+        """
+        Write every package queued by the deferred or manual save policy.
+
+        Args:
+            concurrent: Serialize independent asset packages in parallel (default: True).
+                        Maps and packages the concurrent pass fails on are saved one by one.
+
+        Returns:
+            Dict containing:
+            - saved: Package names written
+            - failed: Package names that could not be saved; they stay pending for the next flush
+            - packages: Per-package {package, success, concurrent, bytes, elapsed_ms}
+            - concurrent_count, total_bytes, elapsed_ms
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            response = unreal.send_command("flush_saves", {"concurrent": concurrent})
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error flushing saves: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def save_packages(
+        ctx: Context,
+        packages: List[str],
+        concurrent: bool = True,
+        only_dirty: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Save specific packages, serializing independent ones in parallel.
+
+        Args:
+            packages: Package names or object paths (e.g. "/Game/AI/BB_Enemy")
+            concurrent: Use the engine's concurrent save for asset packages (default: True).
+                        Maps and packages that fail concurrently are saved sequentially.
+            only_dirty: Skip packages without unsaved changes (default: True)
+
+        Returns:
+            Dict containing:
+            - packages: Per-package {package, success, concurrent, bytes, elapsed_ms}.
+              For concurrently saved packages elapsed_ms is the time of the whole pass.
+            - saved / failed / not_found: Package names
+            - concurrent_count, total_bytes, elapsed_ms
+
+        Example:
+            save_packages(packages=["/Game/AI/BB_Enemy", "/Game/AI/BT_Enemy"])
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "packages": packages,
+                "concurrent": concurrent,
+                "only_dirty": only_dirty
+            }
+
+            response = unreal.send_command("save_packages", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error saving packages: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def get_save_status(ctx: Context) -> Dict[str, Any]:
+        """
+        Get the current save policy and the packages waiting to be saved.
+
+        Returns:
+            Dict containing policy, idle_seconds, pending, pending_packages,
+            total_requests and total_saves
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            response = unreal.send_command("get_save_status", {})
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error getting save status: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def set_compile_policy(
+        ctx: Context,
+        policy: str,
+        idle_seconds: float = None,
+        tick_budget_ms: float = None
+    ) -> Dict[str, Any]:
+        """
+        Choose when Blueprints edited by bridge commands are recompiled.
+
+        - immediate: every command compiles the Blueprint it changed (default)
+        - deferred: commands queue the Blueprint; the queue is compiled by compile_pending,
+          at the end of execute_batch, or in tick-budgeted slices once the bridge is idle
+
+        Building a 40-element HUD under deferred compiles the widget once instead of 40 times.
+        Commands that need the generated class (spawn_blueprint_actor, add_widget_to_viewport,
+        bind_widget_component_event, ...) compile their Blueprint first. Any command also accepts
+        "compile_now": true to compile the whole queue right after it runs.
+
+        Args:
+            policy: "immediate" or "deferred"
+            idle_seconds: Idle time before queued compiles start (default: 0.5)
+            tick_budget_ms: Compile time spent per editor tick while draining (default: 50)
+
+        Returns:
+            Dict containing policy, pending and pending_blueprints
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {"policy": policy}
+            if idle_seconds is not None:
+                params["idle_seconds"] = idle_seconds
+            if tick_budget_ms is not None:
+                params["tick_budget_ms"] = tick_budget_ms
+
+            response = unreal.send_command("set_compile_policy", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error setting compile policy: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def compile_pending(ctx: Context) -> Dict[str, Any]:
+        """
+        Compile every Blueprint queued by the deferred compile policy.
+
+        Returns:
+            Dict containing:
+            - compiled: Per-Blueprint results, each with:
+                - blueprint: Blueprint object path
+                - success: False if the compile produced errors
+                - status: "up_to_date", "warnings" or "error"
+                - warning_count / error_count: Number of compiler messages of each severity
+                - warnings / errors: Compiler message texts (lists of strings)
+                - batched: True if compiled in one pass with other Blueprints
+                - elapsed_ms: Time of this Blueprint, or of the whole pass when batched
+            - failed: Number of Blueprints that compiled with errors
+            - elapsed_ms: Total time
+            - policy, pending, pending_blueprints and the other get_compile_status fields
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            response = unreal.send_command("compile_pending", {})
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error compiling pending Blueprints: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def get_compile_status(ctx: Context) -> Dict[str, Any]:
+        """
+        Get the current compile policy and the Blueprints waiting to be compiled.
+
+        Returns:
+            Dict containing policy, idle_seconds, tick_budget_ms, pending, pending_blueprints,
+            total_requests and total_compiles
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            response = unreal.send_command("get_compile_status", {})
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error getting compile status: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def get_asset_cache_status(ctx: Context, clear: bool = False) -> Dict[str, Any]:
+        """
+        Get statistics of the bridge's resolved-asset cache (name + path + class lookups).
+
+        Args:
+            clear: Drop all cached entries and reset the counters after reporting
+
+        Returns:
+            Dict containing entries, hits, misses and invalidations
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            response = unreal.send_command("get_asset_cache_status", {"clear": clear})
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error getting asset cache status: {e}")
+            return {"success": False, "error": str(e)}
+
+    logger.info("Bridge tools registered successfully")
@@ -15,8 +15,23 @@ def register_editor_tools(mcp: FastMCP):
     """Register editor tools with the MCP server."""
     
     @mcp.tool()
-    def get_actors_in_level(ctx: Context) -> List[Dict[str, Any]]:
-        """Get a list of all actors in the current level."""
+    def get_actors_in_level(
+        ctx: Context,
+        source: str = "loaded",
+        bounds: Dict[str, List[float]] = None
+    ) -> List[Dict[str, Any]]:
+        """Get a list of all actors in the current level.
+        
+        Args:
+            ctx: The MCP context
+            source: "loaded" for actors in memory (default), or "descriptors" to read
+                    World Partition actor descriptors without loading any cell
+                    (class, label, bounds, data_layers, references, loaded flag)
+            bounds: Optional spatial filter {"min": [x, y, z], "max": [x, y, z]}
+            
+        Returns:
+            List of actors
+        """
         from unreal_mcp_server import get_unreal_connection
         
         try:
@@ -25,7 +40,10 @@ def register_editor_tools(mcp: FastMCP):
                 logger.warning("Failed to connect to Unreal Engine")
                 return []
                 
-            response = unreal.send_command("get_actors_in_level", {})
+            params = {"source": source}
+            if bounds:
+                params["bounds"] = bounds
+            response = unreal.send_command("get_actors_in_level", params)
             
             if not response:
                 logger.warning("No response from Unreal Engine")
@@ -52,12 +70,20 @@ def register_editor_tools(mcp: FastMCP):
             return []
 
     @mcp.tool()
-    def find_actors_by_name(ctx: Context, pattern: str) -> Dict[str, Any]:
+    def find_actors_by_name(
+        ctx: Context,
+        pattern: str,
+        source: str = "loaded",
+        bounds: Dict[str, List[float]] = None
+    ) -> Dict[str, Any]:
         """Find actors by name pattern.
         
         Args:
             ctx: The MCP context
-            pattern: Name pattern to search for (partial match)
+            pattern: Name or label pattern to search for (partial match)
+            source: "loaded" (default) or "descriptors" to search unloaded
+                    World Partition actors
+            bounds: Optional spatial filter {"min": [x, y, z], "max": [x, y, z]}
             
         Returns:
             Dict containing matching actors list
@@ -70,9 +96,13 @@ def register_editor_tools(mcp: FastMCP):
                 logger.warning("Failed to connect to Unreal Engine")
                 return {"success": False, "actors": [], "message": "Failed to connect to Unreal Engine"}
                 
-            response = unreal.send_command("find_actors_by_name", {
-                "pattern": pattern
-            })
+            params = {
+                "pattern": pattern,
+                "source": source
+            }
+            if bounds:
+                params["bounds"] = bounds
+            response = unreal.send_command("find_actors_by_name", params)
             
             if not response:
                 return {"success": False, "actors": [], "message": "No response from Unreal Engine"}
@@ -91,7 +121,8 @@ def register_editor_tools(mcp: FastMCP):
                 "success": True,
                 "actors": actors,
                 "count": len(actors),
-                "pattern": pattern
+                "pattern": pattern,
+                "source": source
             }
             
         except Exception as e:
@@ -27,6 +27,7 @@ class ErrorCode(IntEnum):
     ASSET_CREATION_FAILED = 1103
     ASSET_DELETE_FAILED = 1104
     INVALID_ASSET_PATH = 1105
+    ASSET_AMBIGUOUS = 1106
     
     # Blueprint errors (1200-1299)
     BLUEPRINT_NOT_FOUND = 1200
@@ -0,0 +1,155 @@
+"""
+Reader for level snapshot files (.sbls) written by `export_level_snapshot`.
+
+The file is columnar (one contiguous array per field) and 8-byte aligned, so
+columns are exposed as zero-copy memoryviews over a memory-mapped file:
+
+    with LevelSnapshot.open("Saved/LevelSnapshots/Main_20250101_120000.sbls") as snap:
+        xs = snap.column("location")[0::3]
+        for actor in snap.actors():
+            print(actor["label"], actor["location"])
+
+With numpy installed, `numpy.frombuffer(snap.column("location"), dtype="<f8").reshape(-1, 3)`
+turns any column into an array without copying.
+
+Layout (little-endian), mirrored from FSpirrowBridgeLevelSnapshot:
+    Header (64 bytes): magic "SBLS", version, actor_count, column_count, string_count,
+        map_name, string_offsets_offset, string_data_offset, string_data_size,
+        column_directory_offset, capture_time
+    Column directory: name[16], type, components, count, offset (40 bytes each)
+    String table: u32 offsets[string_count + 1] into a UTF-8 blob, string 0 is ""
+    Lists (materials, tags): "*_start" holds actor_count + 1 offsets into "*_ids"
+"""
+
+import mmap
+import struct
+from typing import Any, Dict, Iterator, List
+
+MAGIC = b"SBLS"
+VERSION = 1
+
+_HEADER = struct.Struct("<4sIIIIIQQQQq")
+_DIRECTORY_ENTRY = struct.Struct("<16sIIQQ")
+
+# Column type id -> memoryview format
+_COLUMN_FORMATS = {1: "I", 2: "Q", 3: "f", 4: "d"}
+
+_STRING_COLUMNS = ("name", "label", "class", "level", "folder", "mesh")
+
+
+class LevelSnapshot:
+    """Memory-mapped view of a level snapshot file."""
+
+    def __init__(self, path: str):
+        self.path = path
+        self._file = open(path, "rb")
+        self._map = mmap.mmap(self._file.fileno(), 0, access=mmap.ACCESS_READ)
+        self._view = memoryview(self._map)
+        self._strings: Dict[int, str] = {}
+        self._columns: Dict[str, memoryview] = {}
+        self._string_offsets = None
+
+        (magic, version, self.actor_count, column_count, self.string_count, map_name_index,
+         self._string_offsets_offset, self._string_data_offset, self._string_data_size,
+         directory_offset, self.capture_time) = _HEADER.unpack_from(self._map, 0)
+
+        if magic != MAGIC:
+            self.close()
+            raise ValueError(f"Not a level snapshot file: {path}")
+        if version != VERSION:
+            self.close()
+            raise ValueError(f"Unsupported snapshot version {version} (expected {VERSION})")
+
+        self.columns: Dict[str, Dict[str, int]] = {}
+        for i in range(column_count):
+            name, col_type, components, count, offset = _DIRECTORY_ENTRY.unpack_from(
+                self._map, directory_offset + i * _DIRECTORY_ENTRY.size)
+            self.columns[name.rstrip(b"\0").decode("ascii")] = {
+                "type": col_type, "components": components, "count": count, "offset": offset
+            }
+
+        self._string_offsets = self._view[
+            self._string_offsets_offset:self._string_offsets_offset + (self.string_count + 1) * 4
+        ].cast("I")
+        self.map_name = self.string(map_name_index)
+
+    @classmethod
+    def open(cls, path: str) -> "LevelSnapshot":
+        return cls(path)
+
+    def close(self):
+        # Views must be released before the mapping can be closed
+        for view in self._columns.values():
+            view.release()
+        self._columns.clear()
+        if getattr(self, "_string_offsets", None) is not None:
+            self._string_offsets.release()
+            self._string_offsets = None
+        if self._view is not None:
+            self._view.release()
+            self._view = None
+        if self._map is not None:
+            self._map.close()
+            self._map = None
+        if self._file is not None:
+            self._file.close()
+            self._file = None
+
+    def __enter__(self) -> "LevelSnapshot":
+        return self
+
+    def __exit__(self, exc_type, exc, tb):
+        self.close()
+
+    def __len__(self) -> int:
+        return self.actor_count
+
+    def column(self, name: str) -> memoryview:
+        """Flat zero-copy view of a column (vectors are interleaved x, y, z)."""
+        view = self._columns.get(name)
+        if view is None:
+            info = self.columns[name]
+            fmt = _COLUMN_FORMATS[info["type"]]
+            size = info["count"] * info["components"] * struct.calcsize(fmt)
+            view = self._view[info["offset"]:info["offset"] + size].cast(fmt)
+            self._columns[name] = view
+        return view
+
+    def string(self, index: int) -> str:
+        """Look up an entry of the string table."""
+        cached = self._strings.get(index)
+        if cached is None:
+            begin = self._string_offsets[index]
+            end = self._string_offsets[index + 1]
+            start = self._string_data_offset
+            cached = bytes(self._view[start + begin:start + end]).decode("utf-8")
+            self._strings[index] = cached
+        return cached
+
+    def _list(self, prefix: str, row: int) -> List[str]:
+        starts = self.column(f"{prefix}_start")
+        ids = self.column(f"{prefix}_ids")
+        return [self.string(ids[i]) for i in range(starts[row], starts[row + 1])]
+
+    def actor(self, row: int) -> Dict[str, Any]:
+        """Decode one row into a dict."""
+        result: Dict[str, Any] = {"id": self.column("id")[row]}
+        for name in _STRING_COLUMNS:
+            result[name] = self.string(self.column(name)[row])
+        for name in ("location", "rotation", "scale", "bounds_min", "bounds_max"):
+            values = self.column(name)
+            result[name] = [values[row * 3], values[row * 3 + 1], values[row * 3 + 2]]
+        result["materials"] = self._list("material", row)
+        result["tags"] = self._list("tag", row)
+        return result
+
+    def actors(self) -> Iterator[Dict[str, Any]]:
+        """Iterate over all rows as dicts."""
+        for row in range(self.actor_count):
+            yield self.actor(row)
+
+
+def read_level_snapshot(path: str) -> List[Dict[str, Any]]:
+    """Load a whole snapshot into a list of actor dicts."""
+    with LevelSnapshot.open(path) as snap:
+        return list(snap.actors())
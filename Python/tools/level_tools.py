@@ -0,0 +1,407 @@
+"""
+Level Tools for Unreal MCP.
+
+This module provides bulk level operations that run server-side in a single pass:
+instancing of repeated static meshes, filtered bulk edits and level snapshots.
+
+Most tools accept an actor `filter` dict. All given keys must match:
+    - names: List of actor names or labels
+    - selected: Only actors selected in the editor
+    - class: Actor class ("StaticMeshActor", "/Script/Engine.PointLight" or a Blueprint path)
+    - label: Wildcard pattern on the actor label (e.g. "SM_Rock_*")
+    - tag: Actor tag
+    - folder: World Outliner folder (sub-folders included)
+    - bounds: {"min": [x, y, z], "max": [x, y, z]}
+    - all: True to match every actor. update_actors_where refuses a filter without
+      any criterion unless this is set. Unknown keys are rejected
+    - load_region: World Partition only. Load the cells covering `bounds` first,
+      so the command operates on actors that are not loaded yet. Commands that
+      edit actors keep the region loaded (free it with unload_world_partition_region
+      after saving); read-only commands and dry runs unload it again
+"""
+
+import logging
+from typing import Dict, Any, List
+from mcp.server.fastmcp import FastMCP, Context
+
+logger = logging.getLogger("SpirrowBridge")
+
+
+def register_level_tools(mcp: FastMCP):
+    """Register level tools with the MCP server."""
+
+    @mcp.tool()
+    def consolidate_to_instances(
+        ctx: Context,
+        filter: Dict[str, Any] = None,
+        min_instances: int = 2,
+        delete_originals: bool = True,
+        name_prefix: str = "HISM_",
+        target_folder: str = "",
+        dry_run: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Replace repeated StaticMeshActors with Hierarchical Instanced Static Mesh actors.
+
+        Matching actors are grouped by level, mesh and material set. Each group with at
+        least `min_instances` members becomes one actor holding a
+        HierarchicalInstancedStaticMeshComponent that keeps every per-instance transform.
+        The whole operation is a single undoable transaction.
+
+        Args:
+            filter: Actor filter (see module docs). Class defaults to StaticMeshActor.
+            min_instances: Minimum group size to consolidate (default: 2)
+            delete_originals: Delete the source actors after instancing (default: True)
+            name_prefix: Prefix for the created actors (default: "HISM_")
+            target_folder: Outliner folder for the created actors (default: folder of the first source actor)
+            dry_run: Only report the grouping and the predicted counts without changing the level
+
+        Returns:
+            Dict containing:
+            - groups: Per-group mesh, materials, instance_count and actor_name
+            - level_actors_before / level_actors_after: Actor counts in the world
+            - components_before / components_after: Component counts of the affected actors
+              (after includes the originals kept when delete_originals is False)
+            - skipped: Actors that matched the filter but could not be instanced
+              (including actors attached to another actor)
+
+        Example:
+            consolidate_to_instances(
+                filter={"folder": "Generated/Rocks", "label": "SM_Rock_*"},
+                min_instances=5
+            )
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "min_instances": min_instances,
+                "delete_originals": delete_originals,
+                "name_prefix": name_prefix,
+                "dry_run": dry_run
+            }
+            if filter:
+                params["filter"] = filter
+            if target_folder:
+                params["target_folder"] = target_folder
+
+            logger.info(f"Consolidating static mesh actors to instances: {params}")
+            response = unreal.send_command("consolidate_to_instances", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error consolidating to instances: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def update_actors_where(
+        ctx: Context,
+        filter: Dict[str, Any] = None,
+        properties: Dict[str, Any] = None,
+        component_properties: List[Dict[str, Any]] = None,
+        dry_run: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Apply the same property assignments to every actor matching a filter.
+
+        The filter is evaluated once in the editor and all edits share a single
+        undo transaction, replacing a find_actors + set_actor_property loop.
+
+        Args:
+            filter: Actor filter (see module docs) with at least one criterion.
+                    Pass {"all": True} to target every actor.
+            properties: Actor property map, e.g. {"bHidden": True}
+            component_properties: List of component assignments, each with
+                "component" (component name) and/or "component_class"
+                (e.g. "PointLightComponent") and a "properties" map
+            dry_run: Only report matching actors without changing them
+
+        Returns:
+            Dict containing:
+            - matched / succeeded / failed: Actor counts
+            - assignments_applied: Number of property values written
+            - actors_changed: Actors where a value actually changed (only these are
+              recorded for undo and marked dirty)
+            - failures: Per-actor errors (or "actors" with the matched names when dry_run)
+
+        Example:
+            update_actors_where(
+                filter={"class": "PointLight", "folder": "Lighting/Street"},
+                component_properties=[
+                    {"component_class": "PointLightComponent", "properties": {"Intensity": 2000.0}}
+                ]
+            )
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {"dry_run": dry_run}
+            if filter:
+                params["filter"] = filter
+            if properties:
+                params["properties"] = properties
+            if component_properties:
+                params["component_properties"] = component_properties
+
+            logger.info(f"Updating actors where: {params}")
+            response = unreal.send_command("update_actors_where", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error updating actors: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def get_properties_batch(
+        ctx: Context,
+        properties: List[str],
+        objects: List[str] = None,
+        filter: Dict[str, Any] = None,
+        diff_from_defaults: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Read the same properties from many assets or actors as one table.
+
+        Replaces a get_actor_properties / get_blueprint_properties loop: property
+        paths are resolved once per class and values come back as export text.
+
+        Args:
+            properties: Property paths, nested struct paths allowed
+                (e.g. ["Health", "PrimaryActorTick.TickInterval"])
+            objects: Asset object paths (e.g. "/Game/Data/DA_Sword");
+                Blueprints are read from their class defaults
+            filter: Actor filter (see module docs); {} targets every actor
+            diff_from_defaults: Emit null for values equal to the class default
+                (for Blueprint assets, the parent class default)
+
+        Returns:
+            Dict containing:
+            - columns: ["object", <property paths>...]
+            - rows: One list per object, [name, value...]; null for missing properties
+              or, with diff_from_defaults, default values
+            - count: Number of rows
+            - errors: Objects not found and properties missing per class
+
+        Example:
+            get_properties_batch(
+                properties=["Intensity", "LightColor"],
+                filter={"class": "PointLight"},
+                diff_from_defaults=True
+            )
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {"properties": properties, "diff_from_defaults": diff_from_defaults}
+            if objects:
+                params["objects"] = objects
+            if filter is not None:
+                params["filter"] = filter
+
+            logger.info(f"Reading properties batch: {params}")
+            response = unreal.send_command("get_properties_batch", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error reading properties batch: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def export_level_snapshot(
+        ctx: Context,
+        file_path: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Write a compact binary snapshot of every actor in the current level.
+
+        The file stores names, classes, levels, folders, transforms, bounds, mesh and
+        material references and tags column by column with a shared string table.
+        Read it with `tools.level_snapshot.LevelSnapshot` (memory-mapped, no JSON).
+
+        Args:
+            file_path: Output path on the editor machine
+                       (default: Saved/LevelSnapshots/<Map>_<timestamp>.sbls)
+
+        Returns:
+            Dict containing:
+            - file_path: Absolute path of the written snapshot
+            - actor_count / string_count / file_size
+            - capture_ms / write_ms: Timings of the capture and the file write
+
+        Example:
+            export_level_snapshot()
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {}
+            if file_path:
+                params["file_path"] = file_path
+
+            logger.info(f"Exporting level snapshot: {params}")
+            response = unreal.send_command("export_level_snapshot", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error exporting level snapshot: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def diff_level_snapshots(
+        ctx: Context,
+        snapshot_a: str,
+        snapshot_b: str = "",
+        tolerance: float = 0.01,
+        max_results: int = 1000,
+        allow_map_mismatch: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Compare two level snapshots and list added, removed, moved and changed actors.
+
+        Actors are matched by their stable id (hash of the actor path), so the diff is
+        linear in the number of actors. Use it to verify that an editing session only
+        touched what it was supposed to.
+
+        Args:
+            snapshot_a: Path of the "before" snapshot (from export_level_snapshot)
+            snapshot_b: Path of the "after" snapshot (default: capture the current level)
+            tolerance: Transform comparison tolerance (default: 0.01)
+            max_results: Maximum entries per list; counts are always complete (default: 1000)
+            allow_map_mismatch: Diff snapshots of different maps instead of failing (default: False)
+
+        Returns:
+            Dict containing:
+            - added / removed: Actors present in only one snapshot
+            - moved: Actors whose location, rotation or scale changed (with a/b values)
+            - changed: Actors whose label, class, folder, mesh, materials, tags or bounds changed
+            - added_count / removed_count / moved_count / changed_count
+            - truncated: True if any list was cut at max_results
+
+        Example:
+            before = export_level_snapshot()
+            # ... edits ...
+            diff_level_snapshots(snapshot_a=before["result"]["file_path"])
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "snapshot_a": snapshot_a,
+                "tolerance": tolerance,
+                "max_results": max_results
+            }
+            if snapshot_b:
+                params["snapshot_b"] = snapshot_b
+            if allow_map_mismatch:
+                params["allow_map_mismatch"] = True
+
+            logger.info(f"Diffing level snapshots: {params}")
+            response = unreal.send_command("diff_level_snapshots", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error diffing level snapshots: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def load_world_partition_region(
+        ctx: Context,
+        bounds: Dict[str, List[float]]
+    ) -> Dict[str, Any]:
+        """
+        Load a region of a World Partition map so its actors can be edited.
+
+        The region is registered like a user "Load Region" in the World Partition
+        editor and stays loaded until unload_world_partition_region is called. Loading
+        the same bounds again reuses the region. Use get_actors_in_level with
+        source="descriptors" to inspect the map first without loading anything.
+
+        Args:
+            bounds: Region to load, {"min": [x, y, z], "max": [x, y, z]}
+
+        Returns:
+            Dict containing:
+            - actors_loaded: Number of actors in the region that were newly loaded
+
+        Example:
+            load_world_partition_region(bounds={"min": [0, 0, -1000], "max": [25600, 25600, 5000]})
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {"bounds": bounds}
+
+            logger.info(f"Loading World Partition region: {params}")
+            response = unreal.send_command("load_world_partition_region", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error loading World Partition region: {e}")
+            return {"success": False, "error": str(e)}
+
+    @mcp.tool()
+    def unload_world_partition_region(
+        ctx: Context,
+        bounds: Dict[str, List[float]] = None
+    ) -> Dict[str, Any]:
+        """
+        Unload World Partition regions loaded by load_world_partition_region or filter.load_region.
+
+        Regions that still contain unsaved actors are kept; save them first.
+
+        Args:
+            bounds: Region to unload, {"min": [x, y, z], "max": [x, y, z]} as passed when loading.
+                    Omit to unload every region loaded through the bridge.
+
+        Returns:
+            Dict containing:
+            - regions_unloaded: Number of regions unloaded
+            - regions_with_unsaved_changes: Number of regions kept because of unsaved actors
+
+        Example:
+            unload_world_partition_region(bounds={"min": [0, 0, -1000], "max": [25600, 25600, 5000]})
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "error": "Failed to connect to Unreal Engine"}
+
+            params = {}
+            if bounds:
+                params["bounds"] = bounds
+
+            logger.info(f"Unloading World Partition region: {params}")
+            response = unreal.send_command("unload_world_partition_region", params)
+            return response or {"success": False, "error": "No response from Unreal Engine"}
+
+        except Exception as e:
+            logger.error(f"Error unloading World Partition region: {e}")
+            return {"success": False, "error": str(e)}
+
+    logger.info("Level tools registered successfully")
@@ -1277,4 +1277,160 @@ def register_blueprint_node_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
     
+    @mcp.tool()
+    def apply_graph_patch(
+        ctx: Context,
+        blueprint_name: str,
+        nodes: List[Dict[str, Any]],
+        links: Optional[List[Dict[str, Any]]] = None,
+        graph_name: str = "",
+        path: str = "/Game/Blueprints",
+        compile: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Build or extend a Blueprint graph in one call: nodes, pin defaults and links
+        are applied in a single transaction with one compile. On any error the created
+        nodes are removed and touched pins of existing nodes are restored.
+
+        Args:
+            blueprint_name: Name of the target Blueprint
+            nodes: Nodes with local ids. Each entry has "id" and either "node_id" (GUID of an
+                   existing node) or "type" plus type fields:
+                   - event: "name" (e.g. "ReceiveBeginPlay"); an existing handler in the same graph
+                     is reused, one in another graph is an error
+                   - custom_event: "name" (reused the same way)
+                   - function: "name", optional "target" class (defaults to the Blueprint,
+                     then KismetSystemLibrary/KismetMathLibrary/KismetStringLibrary/GameplayStatics)
+                   - variable_get / variable_set: "name"
+                   - branch, self, sequence ("num_outputs"), macro ("name", e.g. "ForLoopWithBreak")
+                   Optional "position": [x, y] and "pins": {"PinName": value} for input defaults
+            links: Connections {"from": id, "from_pin": name, "to": id, "to_pin": name}.
+                   Omitted pin names mean the first exec output/input
+            graph_name: Graph to patch (default: the event graph); function and macro graphs work too
+            path: Content browser path where the blueprint is located (default: "/Game/Blueprints")
+            compile: Compile once after the patch (queued under the deferred compile policy)
+
+        Returns:
+            Dict with node_ids mapping local ids to node GUIDs, plus created/pin/link counts,
+            compile_pending and, once the compile has run, compile_errors
+
+        Example:
+            apply_graph_patch(
+                blueprint_name="BP_Door",
+                nodes=[
+                    {"id": "begin", "type": "event", "name": "ReceiveBeginPlay"},
+                    {"id": "print", "type": "function", "name": "PrintString", "pins": {"InString": "Open"}},
+                    {"id": "delay", "type": "function", "name": "Delay", "pins": {"Duration": 2.0}}
+                ],
+                links=[
+                    {"from": "begin", "to": "print"},
+                    {"from": "print", "to": "delay"}
+                ]
+            )
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "nodes": nodes,
+                "links": links or [],
+                "path": path,
+                "compile": compile
+            }
+            if graph_name:
+                params["graph_name"] = graph_name
+
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            logger.info(f"Applying graph patch to '{blueprint_name}' ({len(nodes)} nodes, {len(links or [])} links)")
+            response = unreal.send_command("apply_graph_patch", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Graph patch response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error applying graph patch: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def auto_layout_blueprint_graph(
+        ctx: Context,
+        blueprint_name: str,
+        graph_name: str = "",
+        node_ids: Optional[List[str]] = None,
+        path: str = "/Game/Blueprints",
+        horizontal_spacing: float = 80.0,
+        vertical_spacing: float = 48.0
+    ) -> Dict[str, Any]:
+        """
+        Lay out a Blueprint graph left to right by execution flow.
+
+        Exec nodes are placed in layers (columns) by their distance from the event,
+        ordered within each column to reduce crossing wires. Pure data nodes (getters,
+        math) are placed in a block to the left of the first node that reads them.
+        Separate event chains are stacked top to bottom in their original order.
+        Comment boxes are not moved. The change is one undoable transaction.
+
+        Args:
+            blueprint_name: Name of the target Blueprint
+            graph_name: Graph to lay out (default: the event graph, or the graph of node_ids)
+            node_ids: Only move these nodes (e.g. the node_ids returned by apply_graph_patch).
+                      Other nodes stay where they are; the new nodes are placed next to the
+                      existing nodes they are linked to, without overlapping them
+            path: Content browser path where the blueprint is located (default: "/Game/Blueprints")
+            horizontal_spacing: Gap between columns (default: 80)
+            vertical_spacing: Gap between nodes in a column (default: 48)
+
+        Returns:
+            Dict with nodes_laid_out, nodes_moved, data_nodes, components, layers,
+            comments_skipped, bounds and elapsed_ms
+
+        Example:
+            auto_layout_blueprint_graph(blueprint_name="BP_Door")
+            result = apply_graph_patch(blueprint_name="BP_Door", nodes=[...], links=[...])
+            auto_layout_blueprint_graph(blueprint_name="BP_Door",
+                                        node_ids=list(result["node_ids"].values()))
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "path": path,
+                "horizontal_spacing": horizontal_spacing,
+                "vertical_spacing": vertical_spacing
+            }
+            if graph_name:
+                params["graph_name"] = graph_name
+            if node_ids:
+                params["node_ids"] = node_ids
+
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            logger.info(f"Auto-layouting graph of '{blueprint_name}'")
+            response = unreal.send_command("auto_layout_blueprint_graph", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            return response
+
+        except Exception as e:
+            error_msg = f"Error auto-layouting blueprint graph: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     logger.info("Blueprint node tools registered successfully")
\ No newline at end of file
@@ -421,6 +421,55 @@ def register_project_tools(mcp: FastMCP):
             logger.error(error_msg)
             return {"success": False, "message": error_msg}
 
+    @mcp.tool()
+    def find_assets_by_name(
+        ctx: Context,
+        name: str,
+        class_name: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Find assets by short name anywhere under /Game, without knowing their folder.
+
+        Uses the bridge's asset registry name index, so the lookup does not scan content.
+        Commands that take a Blueprint/BehaviorTree/Blackboard name also fall back to this
+        index when the asset is not at the given path; when several assets match they fail
+        with error 1106 (AssetAmbiguous) and list the candidates in details.candidates.
+
+        Args:
+            name: Short asset name (e.g., "BP_Player")
+            class_name: Optional asset class filter, subclasses included
+                        (e.g., "Blueprint", "WidgetBlueprint", "BehaviorTree")
+
+        Returns:
+            Dict with 'found', 'ambiguous' and 'assets' (asset_path, object_path, path)
+
+        Example:
+            find_assets_by_name(name="BT_Enemy", class_name="BehaviorTree")
+        """
+        from unreal_mcp_server import get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {"name": name}
+            if class_name:
+                params["class_name"] = class_name
+
+            logger.info(f"Finding assets by name: '{name}'")
+            response = unreal.send_command("find_assets_by_name", params)
+
+            if not response:
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            return response
+
+        except Exception as e:
+            error_msg = f"Error finding assets by name: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
     @mcp.tool()
     def create_content_folder(
         ctx: Context,
@@ -290,6 +290,8 @@ from tools.ai_tools import register_ai_tools
 from tools.perception_tools import register_perception_tools
 from tools.eqs_tools import register_eqs_tools
 from tools.image_gen_tools import register_image_gen_tools
+from tools.level_tools import register_level_tools
+from tools.bridge_tools import register_bridge_tools
 
 # Register tools
 register_editor_tools(mcp)
@@ -306,6 +308,8 @@ register_ai_tools(mcp)
 register_perception_tools(mcp)
 register_eqs_tools(mcp)
 register_image_gen_tools(mcp)
+register_level_tools(mcp)
+register_bridge_tools(mcp)
 
 @mcp.prompt()
 def info():
@@ -333,12 +337,32 @@ def info():
     - `take_screenshot(filename, show_ui, resolution)` - Capture screenshots
 
     ### Actor Management
-    - `get_actors_in_level()` - List all actors in current level
-    - `find_actors_by_name(pattern)` - Find actors by name pattern
+    - `get_actors_in_level(source="loaded", bounds=None)` - List actors (source="descriptors" reads unloaded World Partition actors)
+    - `find_actors_by_name(pattern, source="loaded", bounds=None)` - Find actors by name pattern
     - `spawn_actor(name, type, location=[0,0,0], rotation=[0,0,0], scale=[1,1,1])` - Create actors
     - `delete_actor(name)` - Remove actors
     - `set_actor_transform(name, location, rotation, scale)` - Modify actor transform
     - `get_actor_properties(name)` - Get actor properties
+
+    ### Batch Execution
+    - `execute_batch(commands, stop_on_error=True)` - Run many commands in one round trip and one transaction ("$N.field" references)
+    - `set_save_policy(policy)` - immediate / deferred / manual asset saving
+    - `flush_saves(concurrent=True)` - Write all packages queued by the deferred or manual policy
+    - `save_packages(packages, concurrent=True)` - Save specific packages in parallel with per-package timing and size
+    - `get_save_status()` - Current save policy and pending packages
+    - `set_compile_policy(policy)` - immediate / deferred Blueprint compilation
+    - `compile_pending()` - Compile all Blueprints queued by the deferred policy
+    - `get_compile_status()` - Current compile policy and queued Blueprints
+    - `get_asset_cache_status(clear=False)` - Hit/miss counters of the resolved-asset cache
+
+    ### Level Bulk Operations
+    - `consolidate_to_instances(filter, min_instances=2)` - Merge repeated StaticMeshActors into HISM actors
+    - `update_actors_where(filter, properties, component_properties)` - Bulk property edit on filtered actors
+    - `get_properties_batch(properties, objects, filter, diff_from_defaults=False)` - Table of property values across many objects
+    - `export_level_snapshot(file_path="")` - Write a columnar binary snapshot of all actors
+    - `diff_level_snapshots(snapshot_a, snapshot_b="")` - Added/removed/moved/changed actors between snapshots
+    - `load_world_partition_region(bounds)` - Load a World Partition region for editing
+    - `unload_world_partition_region(bounds=None)` - Unload regions loaded by the bridge
     
     ## Blueprint Management
     - `create_blueprint(name, parent_class)` - Create new Blueprint classes
@@ -346,6 +370,12 @@ def info():
     - `set_static_mesh_properties(blueprint_name, component_name, static_mesh)` - Configure meshes
     - `set_physics_properties(blueprint_name, component_name)` - Configure physics
     - `compile_blueprint(blueprint_name)` - Compile Blueprint changes
+    - `compile_blueprints_batch(blueprints=None, folder="", dirty_only=False)` - Compile many Blueprints in one pass
+    - `batch_set_properties_multi(properties, assets=None, folder="", parent_class="")` - Same property values on many Blueprint CDOs / data assets
+    - `upsert_datatable_rows(datatable_name, row_struct="", file_path="", rows=None, csv="")` - Bulk insert/update DataTable rows from CSV/JSON with one save
+    - `search_blueprints(query, path="", offset=0, limit=50)` - Find Blueprints by function/variable/node names without loading them
+    - `analyze_blueprint_performance(blueprint_name="", folder="", min_severity="info")` - Flag Tick / hot-path patterns and estimate per-tick node counts
+    - `set_tick_policy_batch(actor=None, components=None, folder="", parent_class="")` - Bulk tick enable/interval/group on CDOs and component templates
     - `set_blueprint_property(blueprint_name, property_name, property_value)` - Set properties
     - `set_pawn_properties(blueprint_name)` - Configure Pawn settings
     - `spawn_blueprint_actor(blueprint_name, actor_name)` - Spawn Blueprint actors
@@ -359,9 +389,12 @@ def info():
     - `add_blueprint_get_self_component_reference(blueprint_name, component_name)` - Add component refs
     - `add_blueprint_self_reference(blueprint_name)` - Add self references
     - `find_blueprint_nodes(blueprint_name, node_type, event_type)` - Find nodes
+    - `apply_graph_patch(blueprint_name, nodes, links)` - Create nodes, pin defaults and links in one transaction with one compile
+    - `auto_layout_blueprint_graph(blueprint_name, graph_name="", node_ids=None)` - Layered layout by exec flow with data nodes beside their consumers
     
     ## Project Tools
     - `create_input_mapping(action_name, key, input_type)` - Create input mappings
+    - `find_assets_by_name(name, class_name="")` - Locate assets by short name without knowing the folder
 
     ## RAG Knowledge Tools
     - `search_knowledge(query, n_results=3, category=None)` - Search the RAG knowledge base